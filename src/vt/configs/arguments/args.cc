@@ -74,6 +74,15 @@ namespace vt { namespace arguments {
 /*static*/ std::string ArgConfig::vt_trace_file         = "";
 /*static*/ std::string ArgConfig::vt_trace_dir          = "";
 /*static*/ int32_t     ArgConfig::vt_trace_mod          = 0;
+/*static*/ bool        ArgConfig::vt_trace_stream       = false;
+/*static*/ int32_t     ArgConfig::vt_trace_stream_buffer = 64;
+/*static*/ std::string ArgConfig::vt_trace_stream_policy = "block";
+/*static*/ bool        ArgConfig::vt_trace_binary       = false;
+/*static*/ std::string ArgConfig::vt_trace_filter       = "";
+/*static*/ int32_t     ArgConfig::vt_trace_phase_first  = -1;
+/*static*/ int32_t     ArgConfig::vt_trace_phase_last   = -1;
+/*static*/ std::string ArgConfig::vt_trace_ranks        = "";
+/*static*/ int32_t     ArgConfig::vt_trace_sample       = 1;
 
 /*static*/ bool        ArgConfig::vt_lb                 = false;
 /*static*/ bool        ArgConfig::vt_lb_file            = false;
@@ -84,6 +93,43 @@ namespace vt { namespace arguments {
 /*static*/ bool        ArgConfig::vt_lb_stats           = false;
 /*static*/ std::string ArgConfig::vt_lb_stats_dir       = "vt_lb_stats";
 /*static*/ std::string ArgConfig::vt_lb_stats_file      = "stats";
+/*static*/ bool        ArgConfig::vt_lb_stats_binary    = false;
+/*static*/ bool        ArgConfig::vt_lb_stats_compress  = false;
+/*static*/ int32_t     ArgConfig::vt_lb_gossip_fanout   = 6;
+/*static*/ int32_t     ArgConfig::vt_lb_gossip_rounds   = 0;
+/*static*/ int32_t     ArgConfig::vt_lb_gossip_iters    = 4;
+/*static*/ int32_t     ArgConfig::vt_lb_greedy_group_size = 0;
+/*static*/ std::string ArgConfig::vt_lb_model           = "persistence";
+/*static*/ double      ArgConfig::vt_lb_model_alpha     = 0.5;
+/*static*/ int32_t     ArgConfig::vt_lb_model_window    = 4;
+/*static*/ int32_t     ArgConfig::vt_lb_model_period    = 0;
+/*static*/ int32_t     ArgConfig::vt_lb_migration_horizon   = 0;
+/*static*/ double      ArgConfig::vt_lb_migration_bandwidth = 1e9;
+/*static*/ std::string ArgConfig::vt_lb_timer           = "mpi";
+/*static*/ std::string ArgConfig::vt_lb_load            = "wall";
+/*static*/ bool        ArgConfig::vt_lb_cpu_time        = false;
+/*static*/ bool        ArgConfig::vt_lb_async           = false;
+/*static*/ int64_t     ArgConfig::vt_lb_memory_capacity = 0;
+/*static*/ std::string ArgConfig::vt_lb_stats_json      = "";
+/*static*/ int32_t     ArgConfig::vt_lb_stats_top_k     = 10;
+
+/*static*/ int64_t     ArgConfig::vt_loc_cache_size     = 4096;
+/*static*/ bool        ArgConfig::vt_loc_cache_stats    = false;
+/*static*/ int32_t     ArgConfig::vt_loc_max_subscribers = 8;
+/*static*/ bool        ArgConfig::vt_loc_route_stats    = false;
+
+/*static*/ bool        ArgConfig::vt_no_local_fast_path = false;
+/*static*/ bool        ArgConfig::vt_msg_metrics        = false;
+/*static*/ int32_t     ArgConfig::vt_msg_metrics_interval = 0;
+/*static*/ bool        ArgConfig::vt_msg_latency        = false;
+/*static*/ bool        ArgConfig::vt_comm_matrix        = false;
+/*static*/ std::string ArgConfig::vt_comm_matrix_dir    = "vt_comm_matrix";
+/*static*/ std::string ArgConfig::vt_comm_matrix_file   = "comm";
+
+/*static*/ bool        ArgConfig::vt_sched_metrics       = false;
+/*static*/ int32_t     ArgConfig::vt_sched_idle_timeline = 1024;
+/*static*/ bool        ArgConfig::vt_sched_poll_compat   = false;
+/*static*/ int32_t     ArgConfig::vt_sched_max_backoff   = 32;
 
 /*static*/ bool        ArgConfig::vt_term_rooted_use_ds = false;
 /*static*/ bool        ArgConfig::vt_term_rooted_use_wave = false;
@@ -221,11 +267,38 @@ namespace vt { namespace arguments {
   auto o = app.add_option("--vt_trace_file",    vt_trace_file,      tfile, "");
   auto p = app.add_option("--vt_trace_dir",     vt_trace_dir,       tdir,  "");
   auto q = app.add_option("--vt_trace_mod",     vt_trace_mod,       tmod,  1);
+  auto tstream = "Stream trace chunks to the trace file from a background thread";
+  auto tbuffer = "Memory budget (MiB) for trace chunks waiting on the writer";
+  auto tpolicy = "When the trace writer falls behind: block, drop or sample";
+  auto q1 = app.add_flag("--vt_trace_stream",          vt_trace_stream,        tstream);
+  auto q2 = app.add_option("--vt_trace_stream_buffer", vt_trace_stream_buffer, tbuffer, 64);
+  auto q3 = app.add_option("--vt_trace_stream_policy", vt_trace_stream_policy, tpolicy, "block");
+  auto tbinary = "Write binary traces (convert with vt_trace_convert)";
+  auto q4 = app.add_flag("--vt_trace_binary",          vt_trace_binary,        tbinary);
+  auto tfilter = "Only trace handlers whose name contains one of these (comma-separated)";
+  auto tpfirst = "First phase to trace (-1 traces from the start)";
+  auto tplast  = "Last phase to trace (-1 traces until the end)";
+  auto tranks  = "Ranks to trace, e.g. 0-3,8 (empty traces all ranks)";
+  auto tsample = "Trace one in N executions of each handler";
+  auto q5 = app.add_option("--vt_trace_filter",      vt_trace_filter,        tfilter, "");
+  auto q6 = app.add_option("--vt_trace_phase_first", vt_trace_phase_first,   tpfirst, -1);
+  auto q7 = app.add_option("--vt_trace_phase_last",  vt_trace_phase_last,    tplast,  -1);
+  auto q8 = app.add_option("--vt_trace_ranks",       vt_trace_ranks,         tranks,  "");
+  auto q9 = app.add_option("--vt_trace_sample",      vt_trace_sample,        tsample, 1);
   auto traceGroup = "Tracing Configuration";
   n->group(traceGroup);
   o->group(traceGroup);
   p->group(traceGroup);
   q->group(traceGroup);
+  q1->group(traceGroup);
+  q2->group(traceGroup);
+  q3->group(traceGroup);
+  q4->group(traceGroup);
+  q5->group(traceGroup);
+  q6->group(traceGroup);
+  q7->group(traceGroup);
+  q8->group(traceGroup);
+  q9->group(traceGroup);
 
 
   /*
@@ -346,11 +419,44 @@ namespace vt { namespace arguments {
   auto lb_stats      = "Enable load balancing statistics";
   auto lb_stats_dir  = "Load balancing statistics output directory";
   auto lb_stats_file = "Load balancing statistics output file name";
+  auto lb_stats_bin  = "Stream load balancing statistics in binary, per phase";
+  auto lb_stats_gz   = "Compress binary load balancing statistics with zlib";
+  auto lb_gossip_f   = "GossipLB: number of peers informed per round";
+  auto lb_gossip_k   = "GossipLB: number of inform rounds (0 = log_fanout(P))";
+  auto lb_gossip_i   = "GossipLB: number of inform/transfer iterations";
+  auto lb_greedy_grp = "GreedyLB: ranks per group for hierarchical mode (0 = flat)";
+  auto lb_model      = "Load model predicting the next phase: persistence, ema, trend, periodic";
+  auto lb_model_a    = "Load model ema: weight of the latest phase";
+  auto lb_model_w    = "Load model trend/periodic: number of past phases considered";
+  auto lb_model_p    = "Load model periodic: period in phases (0 = max over the window)";
+  auto lb_mig_h      = "Only migrate objects whose savings over this many phases exceed the transfer time (0 = always migrate)";
+  auto lb_mig_bw     = "Bandwidth in bytes/sec assumed for the migration cost";
+  auto lb_timer      = "Clock timing elements for LB: mpi, tsc, monotonic";
+  auto lb_load       = "Time that drives LB decisions: wall, cpu";
+  auto lb_cpu_time   = "Record thread CPU time per element alongside wall time";
+  auto lb_async      = "Overlap LB with the next phase, migrating at the boundary after";
+  auto lb_mem_cap    = "Memory budget in bytes for the elements of each rank (0 = unconstrained)";
+  auto lb_json       = "Append a JSON line of LB statistics, histograms and heaviest objects to this file per LB";
+  auto lb_top_k      = "Number of heaviest objects listed in the JSON LB statistics";
   auto lbn = "NoLB";
   auto lbi = 1;
   auto lbf = "balance.in";
   auto lbd = "vt_lb_stats";
   auto lbs = "stats";
+  auto lgf = 6;
+  auto lgk = 0;
+  auto lgi = 4;
+  auto lgg = 0;
+  auto lmn = "persistence";
+  auto lma = 0.5;
+  auto lmw = 4;
+  auto lmp = 0;
+  auto lmh = 0;
+  auto lmb = 1e9;
+  auto ltm = "mpi";
+  auto lld = "wall";
+  auto lmc = 0;
+  auto ltk = 10;
   auto s  = app.add_flag("--vt_lb",              vt_lb,             lb);
   auto t  = app.add_flag("--vt_lb_file",         vt_lb_file,        lb_file);
   auto t1 = app.add_flag("--vt_lb_quiet",        vt_lb_quiet,       lb_quiet);
@@ -360,6 +466,25 @@ namespace vt { namespace arguments {
   auto ww = app.add_flag("--vt_lb_stats",        vt_lb_stats,       lb_stats);
   auto wx = app.add_option("--vt_lb_stats_dir",  vt_lb_stats_dir,   lb_stats_dir, lbd);
   auto wy = app.add_option("--vt_lb_stats_file", vt_lb_stats_file,  lb_stats_file,lbs);
+  auto wy1 = app.add_flag("--vt_lb_stats_binary",   vt_lb_stats_binary,   lb_stats_bin);
+  auto wy2 = app.add_flag("--vt_lb_stats_compress", vt_lb_stats_compress, lb_stats_gz);
+  auto wz = app.add_option("--vt_lb_gossip_fanout", vt_lb_gossip_fanout, lb_gossip_f, lgf);
+  auto wa = app.add_option("--vt_lb_gossip_rounds", vt_lb_gossip_rounds, lb_gossip_k, lgk);
+  auto wb = app.add_option("--vt_lb_gossip_iters",  vt_lb_gossip_iters,  lb_gossip_i, lgi);
+  auto wc = app.add_option("--vt_lb_greedy_group_size", vt_lb_greedy_group_size, lb_greedy_grp, lgg);
+  auto wd = app.add_option("--vt_lb_model",        vt_lb_model,        lb_model,   lmn);
+  auto we = app.add_option("--vt_lb_model_alpha",  vt_lb_model_alpha,  lb_model_a, lma);
+  auto wf = app.add_option("--vt_lb_model_window", vt_lb_model_window, lb_model_w, lmw);
+  auto wg = app.add_option("--vt_lb_model_period", vt_lb_model_period, lb_model_p, lmp);
+  auto wh = app.add_option("--vt_lb_migration_horizon",   vt_lb_migration_horizon,   lb_mig_h,  lmh);
+  auto wi = app.add_option("--vt_lb_migration_bandwidth", vt_lb_migration_bandwidth, lb_mig_bw, lmb);
+  auto wj = app.add_option("--vt_lb_timer",  vt_lb_timer,    lb_timer,    ltm);
+  auto wk = app.add_option("--vt_lb_load",   vt_lb_load,     lb_load,     lld);
+  auto wl = app.add_flag("--vt_lb_cpu_time", vt_lb_cpu_time, lb_cpu_time);
+  auto wm = app.add_flag("--vt_lb_async",    vt_lb_async,    lb_async);
+  auto wn = app.add_option("--vt_lb_memory_capacity", vt_lb_memory_capacity, lb_mem_cap, lmc);
+  auto wo = app.add_option("--vt_lb_stats_json",  vt_lb_stats_json,  lb_json,  "");
+  auto wp = app.add_option("--vt_lb_stats_top_k", vt_lb_stats_top_k, lb_top_k, ltk);
   auto debugLB = "Load Balancing";
   s->group(debugLB);
   t->group(debugLB);
@@ -370,6 +495,100 @@ namespace vt { namespace arguments {
   ww->group(debugLB);
   wx->group(debugLB);
   wy->group(debugLB);
+  wy1->group(debugLB);
+  wy2->group(debugLB);
+  wz->group(debugLB);
+  wa->group(debugLB);
+  wb->group(debugLB);
+  wc->group(debugLB);
+  wd->group(debugLB);
+  we->group(debugLB);
+  wf->group(debugLB);
+  wg->group(debugLB);
+  wh->group(debugLB);
+  wi->group(debugLB);
+  wj->group(debugLB);
+  wk->group(debugLB);
+  wl->group(debugLB);
+  wm->group(debugLB);
+  wn->group(debugLB);
+  wo->group(debugLB);
+  wp->group(debugLB);
+
+  /*
+   * Flags for configuring the location manager
+   */
+
+  auto loc_cache_size  = "Maximum number of entries in each location cache";
+  auto loc_cache_stats = "Print location cache hit/miss/eviction counts at finalize";
+  auto loc_max_subs    = "Number of recent senders per entity that are sent its new location after migration (0 disables)";
+  auto loc_route_stats = "Print location routing (forwarding hop) counts at finalize";
+  auto lcs = 4096;
+  auto lms = 8;
+  auto lc  = app.add_option("--vt_loc_cache_size", vt_loc_cache_size, loc_cache_size, lcs);
+  auto lc1 = app.add_flag("--vt_loc_cache_stats",  vt_loc_cache_stats, loc_cache_stats);
+  auto lc2 = app.add_option("--vt_loc_max_subscribers", vt_loc_max_subscribers, loc_max_subs, lms);
+  auto lc3 = app.add_flag("--vt_loc_route_stats",  vt_loc_route_stats, loc_route_stats);
+  auto locGroup = "Location Manager";
+  lc->group(locGroup);
+  lc1->group(locGroup);
+  lc2->group(locGroup);
+  lc3->group(locGroup);
+
+  /*
+   * Flags for configuring collections
+   */
+
+  auto local_fast = "Route sends to local collection elements through the location manager instead of the local ready queue";
+  auto cl = app.add_flag("--vt_no_local_fast_path", vt_no_local_fast_path, local_fast);
+  auto collGroup = "Collections";
+  cl->group(collGroup);
+
+  /*
+   * Flags for reporting messaging metrics
+   */
+
+  auto msg_metrics  = "Print per-handler and per-destination message metrics at finalize";
+  auto msg_interval = "Also print the metrics for each interval of this many seconds (0 disables)";
+  auto am1 = app.add_flag("--vt_msg_metrics",            vt_msg_metrics,          msg_metrics);
+  auto am2 = app.add_option("--vt_msg_metrics_interval", vt_msg_metrics_interval, msg_interval, 0);
+  auto msg_latency  = "Print message queue-wait and execution time histograms at finalize";
+  auto am3 = app.add_flag("--vt_msg_latency",            vt_msg_latency,          msg_latency);
+  auto comm_matrix  = "Write this rank's row of the communication matrix at each phase";
+  auto comm_dir     = "Name of directory to write the communication matrix";
+  auto comm_file    = "Name of the communication matrix file (one CSV per rank)";
+  auto cmd = "vt_comm_matrix";
+  auto cmf = "comm";
+  auto am4 = app.add_flag("--vt_comm_matrix",            vt_comm_matrix,          comm_matrix);
+  auto am5 = app.add_option("--vt_comm_matrix_dir",      vt_comm_matrix_dir,      comm_dir,  cmd);
+  auto am6 = app.add_option("--vt_comm_matrix_file",     vt_comm_matrix_file,     comm_file, cmf);
+  auto msgGroup = "Messaging Metrics";
+  am1->group(msgGroup);
+  am2->group(msgGroup);
+  am3->group(msgGroup);
+  am4->group(msgGroup);
+  am5->group(msgGroup);
+  am6->group(msgGroup);
+
+  /*
+   * Flags for profiling the scheduler
+   */
+
+  auto sched_metrics = "Count polls, empty polls and cycles per scheduler component, record idle intervals (also as trace user events) and print them at finalize";
+  auto sched_idle    = "Number of most recent idle intervals kept in the scheduler idle timeline";
+  auto sched_compat  = "Poll every scheduler component twice per scheduler call, disabling adaptive polling (backoff and wakeup hints)";
+  auto sched_backoff = "Maximum number of scheduler passes an idle component is skipped for under adaptive polling";
+  auto sit = 1024;
+  auto smb = 32;
+  auto as1 = app.add_flag("--vt_sched_metrics",         vt_sched_metrics,       sched_metrics);
+  auto as2 = app.add_option("--vt_sched_idle_timeline", vt_sched_idle_timeline, sched_idle, sit);
+  auto as3 = app.add_flag("--vt_sched_poll_compat",     vt_sched_poll_compat,   sched_compat);
+  auto as4 = app.add_option("--vt_sched_max_backoff",   vt_sched_max_backoff,   sched_backoff, smb);
+  auto schedGroup = "Scheduler";
+  as1->group(schedGroup);
+  as2->group(schedGroup);
+  as3->group(schedGroup);
+  as4->group(schedGroup);
 
   /*
    * Flags for controlling termination
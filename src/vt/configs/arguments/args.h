@@ -77,6 +77,15 @@ public:
   static std::string vt_trace_file;
   static std::string vt_trace_dir;
   static int32_t vt_trace_mod;
+  static bool vt_trace_stream;
+  static int32_t vt_trace_stream_buffer;
+  static std::string vt_trace_stream_policy;
+  static bool vt_trace_binary;
+  static std::string vt_trace_filter;
+  static int32_t vt_trace_phase_first;
+  static int32_t vt_trace_phase_last;
+  static std::string vt_trace_ranks;
+  static int32_t vt_trace_sample;
 
   static bool vt_lb;
   static bool vt_lb_file;
@@ -87,6 +96,43 @@ public:
   static bool vt_lb_stats;
   static std::string vt_lb_stats_dir;
   static std::string vt_lb_stats_file;
+  static bool vt_lb_stats_binary;
+  static bool vt_lb_stats_compress;
+  static int32_t vt_lb_gossip_fanout;
+  static int32_t vt_lb_gossip_rounds;
+  static int32_t vt_lb_gossip_iters;
+  static int32_t vt_lb_greedy_group_size;
+  static std::string vt_lb_model;
+  static double vt_lb_model_alpha;
+  static int32_t vt_lb_model_window;
+  static int32_t vt_lb_model_period;
+  static int32_t vt_lb_migration_horizon;
+  static double vt_lb_migration_bandwidth;
+  static std::string vt_lb_timer;
+  static std::string vt_lb_load;
+  static bool vt_lb_cpu_time;
+  static bool vt_lb_async;
+  static int64_t vt_lb_memory_capacity;
+  static std::string vt_lb_stats_json;
+  static int32_t vt_lb_stats_top_k;
+
+  static int64_t vt_loc_cache_size;
+  static bool vt_loc_cache_stats;
+  static int32_t vt_loc_max_subscribers;
+  static bool vt_loc_route_stats;
+
+  static bool vt_no_local_fast_path;
+  static bool vt_msg_metrics;
+  static int32_t vt_msg_metrics_interval;
+  static bool vt_msg_latency;
+  static bool vt_comm_matrix;
+  static std::string vt_comm_matrix_dir;
+  static std::string vt_comm_matrix_file;
+
+  static bool vt_sched_metrics;
+  static int32_t vt_sched_idle_timeline;
+  static bool vt_sched_poll_compat;
+  static int32_t vt_sched_max_backoff;
 
   static bool vt_no_detect_hang;
   static bool vt_term_rooted_use_ds;
@@ -44,6 +44,7 @@
 
 #include "vt/event/event.h"
 #include "vt/messaging/active.h"
+#include "vt/scheduler/scheduler.h"
 
 namespace vt { namespace event {
 
@@ -179,8 +180,7 @@ void AsyncEvent::cleanup() {
 }
 
 bool AsyncEvent::scheduler() {
-  theEvent()->testEventsTrigger();
-  return false;
+  return theEvent()->testEventsTrigger();
 }
 
 bool AsyncEvent::isLocalTerm() {
@@ -204,8 +204,8 @@ EventType AsyncEvent::createEvent(
 
   auto et = std::make_unique<EventRecordType>(type, event);
 
-  auto& container = needsPolling(type)
-    ? polling_event_container_ : event_container_;
+  bool const polling = needsPolling(type);
+  auto& container = polling ? polling_event_container_ : event_container_;
 
   container.emplace_front(EventHolderType(std::move(et)));
 
@@ -215,6 +215,10 @@ EventType AsyncEvent::createEvent(
     std::forward_as_tuple(container.begin())
   );
 
+  if (polling) {
+    sched::wakeup(sched::SchedComponent::Event);
+  }
+
   return event;
 }
 
@@ -277,7 +281,7 @@ AsyncEvent::EventStateType AsyncEvent::testEventComplete(EventType const& event)
   }
 }
 
-void AsyncEvent::testEventsTrigger(int const& num_events) {
+bool AsyncEvent::testEventsTrigger(int const& num_events) {
   int cur = 0;
   auto& cont = polling_event_container_;
   for (auto iter = cont.begin(); iter != cont.end(); iter++) {
@@ -288,7 +292,7 @@ void AsyncEvent::testEventsTrigger(int const& num_events) {
       holder.executeActions();
       polling_event_container_.erase(iter);
       lookup_container_.erase(id);
-      return;
+      return true;
     }
 
     cur++;
@@ -296,6 +300,7 @@ void AsyncEvent::testEventsTrigger(int const& num_events) {
       break;
     }
   }
+  return false;
 }
 
 }} //end namespace vt::event
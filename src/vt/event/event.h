@@ -97,7 +97,7 @@ struct AsyncEvent {
   void removeEventID(EventType const& event);
   EventStateType testEventComplete(EventType const& event);
   EventType attachAction(EventType const& event, ActionType callable);
-  void testEventsTrigger(int const& num_events = num_check_actions);
+  bool testEventsTrigger(int const& num_events = num_check_actions);
   bool scheduler();
   bool isLocalTerm();
 
@@ -50,6 +50,8 @@
 #include "vt/termination/term_headers.h"
 #include "vt/group/group_manager_active_attorney.h"
 #include "vt/runnable/general.h"
+#include "vt/timing/timing.h"
+#include "vt/configs/arguments/args.h"
 
 namespace vt { namespace messaging {
 
@@ -61,6 +63,10 @@ ActiveMessenger::ActiveMessenger()
    * stack during execution until the AM's destructor is invoked
    */
   pushEpoch(term::any_epoch_sentinel);
+
+  if (arguments::ArgConfig::vt_comm_matrix) {
+    comm_matrix_ = std::make_unique<CommMatrix>();
+  }
 }
 
 /*virtual*/ ActiveMessenger::~ActiveMessenger() {
@@ -76,6 +82,21 @@ ActiveMessenger::ActiveMessenger()
     ret_epoch, term::any_epoch_sentinel, epoch_stack_.size()
   );
   vtAssertExpr(epoch_stack_.size() == 0);
+
+  if (arguments::ArgConfig::vt_msg_metrics) {
+    printMetrics("finalize");
+  }
+  if (arguments::ArgConfig::vt_msg_latency) {
+    vt_print(active, "DeliveryLatency:\n{}", latency_.toString());
+  }
+}
+
+void ActiveMessenger::printMetrics(std::string const& label) {
+  auto const snap = metrics_.snapshot();
+  if (snap.handlers_.empty() and snap.ranks_.empty()) {
+    return;
+  }
+  HandlerMetrics::print(snap, label);
 }
 
 void ActiveMessenger::packMsg(
@@ -210,6 +231,13 @@ EventType ActiveMessenger::sendMsgBytes(
     theTerm()->produce(epoch,1,dest);
   }
 
+  metrics_.recordSend(dest, msg_size);
+
+  // Not in send_listen_: the LB clears those after each element handler
+  if (comm_matrix_ != nullptr) {
+    comm_matrix_->send(dest, msg_size, is_bcast);
+  }
+
   for (auto&& l : send_listen_) {
     l->send(dest, msg_size, is_bcast);
   }
@@ -454,7 +482,7 @@ NodeType ActiveMessenger::getFromNodeCurrentHandler() const {
 
 bool ActiveMessenger::handleActiveMsg(
   MsgSharedPtr<BaseMsgType> const& base, NodeType const& from,
-  MsgSizeType const& size, bool insert
+  MsgSizeType const& size, bool insert, double const arrival_time
 ) {
   using ::vt::group::GroupActiveAttorney;
 
@@ -466,6 +494,8 @@ bool ActiveMessenger::handleActiveMsg(
 
   auto const is_term = envelopeIsTerm(msg->env);
 
+  metrics_.recordRecv(envelopeGetHandler(msg->env), size);
+
   if (!is_term || backend_check_enabled(print_term_msgs)) {
     debug_print(
       active, node,
@@ -474,12 +504,12 @@ bool ActiveMessenger::handleActiveMsg(
     );
   }
 
-  return deliver ? deliverActiveMsg(base,from,insert) : false;
+  return deliver ? deliverActiveMsg(base,from,insert,arrival_time) : false;
 }
 
 bool ActiveMessenger::deliverActiveMsg(
   MsgSharedPtr<BaseMsgType> const& base, NodeType const& in_from_node,
-  bool insert
+  bool insert, double const arrival_time
 ) {
   using MsgType = ShortMessage;
   auto msg = base.to<MsgType>().get();
@@ -556,8 +586,27 @@ bool ActiveMessenger::deliverActiveMsg(
       ep_stack_size = epochPreludeHandler(cur_epoch);
     }
 
+    // Handlers of location and collection messages refine the category
+    auto const prev_category = current_category_;
+    current_category_ =
+      is_term ? MsgCategory::Termination :
+      is_obj  ? MsgCategory::ObjGroup    : MsgCategory::Active;
+
+    auto const start_time = timing::Timing::getCurrentTime();
+
     runnable::Runnable<MsgType>::run(handler,active_fun,msg,from_node,tag);
 
+    auto const end_time = timing::Timing::getCurrentTime();
+    metrics_.recordExecution(handler, end_time - start_time);
+    if (arrival_time != 0.0) {
+      latency_.add(
+        current_category_,
+        static_cast<int64_t>((start_time - arrival_time) * 1e9),
+        static_cast<int64_t>((end_time - start_time) * 1e9)
+      );
+    }
+    current_category_ = prev_category;
+
     // unset current handler
     current_handler_context_  = uninitialized_handler;
     current_node_context_     = uninitialized_destination;
@@ -581,10 +630,12 @@ bool ActiveMessenger::deliverActiveMsg(
         pending_handler_msgs_.emplace(
           std::piecewise_construct,
           std::forward_as_tuple(handler),
-          std::forward_as_tuple(MsgContType{BufferedMsgType{base,from_node}})
+          std::forward_as_tuple(
+            MsgContType{BufferedMsgType{base,from_node,arrival_time}}
+          )
         );
       } else {
-        iter->second.push_back(BufferedMsgType{base,from_node});
+        iter->second.push_back(BufferedMsgType{base,from_node,arrival_time});
       }
     }
   }
@@ -618,6 +669,8 @@ bool ActiveMessenger::tryProcessIncomingMessage() {
       theContext()->getComm(), MPI_STATUS_IGNORE
     );
 
+    auto const arrival_time = timing::Timing::getCurrentTime();
+
     auto msg = reinterpret_cast<MessageType>(buf);
     messageConvertToShared(msg);
     auto base = promoteMsgOwner(msg);
@@ -661,14 +714,14 @@ bool ActiveMessenger::tryProcessIncomingMessage() {
           put_tag, sender,
           [=](RDMA_GetType ptr, ActionType deleter){
             envelopeSetPutPtr(base->env, std::get<0>(ptr), std::get<1>(ptr));
-            handleActiveMsg(base, sender, num_probe_bytes, true);
+            handleActiveMsg(base, sender, num_probe_bytes, true, arrival_time);
           }
         );
       }
     }
 
     if (!is_put || put_finished) {
-      handleActiveMsg(base, sender, msg_bytes, true);
+      handleActiveMsg(base, sender, msg_bytes, true, arrival_time);
     }
 
     return true;
@@ -682,6 +735,23 @@ bool ActiveMessenger::scheduler() {
   bool const processed_data_msg = processDataMsgRecv();
   processMaybeReadyHanTag();
 
+  auto const interval = arguments::ArgConfig::vt_msg_metrics_interval;
+  if (interval > 0) {
+    auto const now = timing::Timing::getCurrentTime();
+    if (last_metrics_.time_ == 0.0) {
+      last_metrics_.time_ = now;
+    } else if (now - last_metrics_.time_ >= interval) {
+      auto const snap = metrics_.snapshot();
+      auto const delta = snap.diff(last_metrics_);
+      if (not delta.handlers_.empty() or not delta.ranks_.empty()) {
+        HandlerMetrics::print(
+          delta, fmt::format("last {:.1f}s", now - last_metrics_.time_)
+        );
+      }
+      last_metrics_ = snap;
+    }
+  }
+
   return processed or processed_data_msg;
 }
 
@@ -744,7 +814,10 @@ void ActiveMessenger::deliverPendingMsgsHandler(
           "deliverPendingMsgsHandler: msg={}, from={}\n",
           print_ptr(cur->buffered_msg.get()), cur->from_node
         );
-        if (deliverActiveMsg(cur->buffered_msg, cur->from_node, false)) {
+        auto const delivered = deliverActiveMsg(
+          cur->buffered_msg, cur->from_node, false, cur->arrival_time
+        );
+        if (delivered) {
           cur = iter->second.erase(cur);
         } else {
           ++cur;
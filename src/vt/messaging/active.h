@@ -55,6 +55,9 @@
 #include "vt/messaging/message/smart_ptr.h"
 #include "vt/messaging/pending_send.h"
 #include "vt/messaging/listener.h"
+#include "vt/messaging/handler_metrics.h"
+#include "vt/messaging/latency_histogram.h"
+#include "vt/messaging/comm_matrix.h"
 #include "vt/event/event.h"
 #include "vt/registry/registry.h"
 #include "vt/registry/auto/auto_registry_interface.h"
@@ -102,10 +105,13 @@ struct BufferedActiveMsg {
 
   MessageType buffered_msg;
   NodeType from_node;
+  double arrival_time = 0.0;
 
   BufferedActiveMsg(
-    MessageType const& in_buffered_msg, NodeType const& in_from_node
-  ) : buffered_msg(in_buffered_msg), from_node(in_from_node)
+    MessageType const& in_buffered_msg, NodeType const& in_from_node,
+    double const in_arrival_time = 0.0
+  ) : buffered_msg(in_buffered_msg), from_node(in_from_node),
+      arrival_time(in_arrival_time)
   { }
 };
 
@@ -495,13 +501,39 @@ struct ActiveMessenger {
     trace::TraceEventIDType getCurrentTraceEvent() const;
   #endif
 
+  /*
+   * Per-handler and per-destination metrics, always collected; snapshot(),
+   * diff() and reset() them to measure a region of the program
+   */
+  HandlerMetrics& getMetrics() { return metrics_; }
+  HandlerMetrics const& getMetrics() const { return metrics_; }
+
+  /*
+   * Queue-wait (MPI receive to handler start) and execution time histograms
+   * of delivered messages, by category; reduce with PlusOp<DeliveryLatency>
+   * to merge them across ranks
+   */
+  DeliveryLatency const& getLatency() const { return latency_; }
+  void resetLatency() { latency_ = DeliveryLatency{}; }
+
+  /*
+   * Called from inside a handler to refine the category its message is
+   * recorded under (the innermost call wins)
+   */
+  void setCurrentCategory(MsgCategory const cat) { current_category_ = cat; }
+
+  /*
+   * The communication matrix row, when enabled with --vt_comm_matrix
+   */
+  CommMatrix* getCommMatrix() { return comm_matrix_.get(); }
+
   bool handleActiveMsg(
     MsgSharedPtr<BaseMsgType> const& base, NodeType const& sender,
-    MsgSizeType const& size, bool insert
+    MsgSizeType const& size, bool insert, double const arrival_time = 0.0
   );
   bool deliverActiveMsg(
     MsgSharedPtr<BaseMsgType> const& base, NodeType const& from_node,
-    bool insert
+    bool insert, double const arrival_time = 0.0
   );
   void deliverPendingMsgsHandler(
     HandlerType const& han, TagType const& tag = no_tag
@@ -577,6 +609,8 @@ struct ActiveMessenger {
 private:
   using EpochStackSizeType = typename EpochStackType::size_type;
 
+  void printMetrics(std::string const& label);
+
   inline EpochStackSizeType epochPreludeHandler(EpochType const& epoch);
   inline void epochEpilogHandler(
     EpochType const& epoch, EpochStackSizeType const& prev_stack_size
@@ -599,6 +633,11 @@ private:
   TagType cur_direct_buffer_tag_         = starting_direct_buffer_tag;
   EpochStackType epoch_stack_;
   std::vector<ListenerType> send_listen_ = {};
+  HandlerMetrics metrics_;
+  MetricsSnapshot last_metrics_          = {};
+  DeliveryLatency latency_;
+  MsgCategory current_category_          = MsgCategory::Active;
+  std::unique_ptr<CommMatrix> comm_matrix_ = nullptr;
 };
 
 }} // end namespace vt::messaging
@@ -0,0 +1,141 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                comm_matrix.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#include "vt/config.h"
+#include "vt/context/context.h"
+#include "vt/messaging/comm_matrix.h"
+#include "vt/configs/arguments/args.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <sys/stat.h>
+
+namespace vt { namespace messaging {
+
+/*virtual*/ CommMatrix::~CommMatrix() {
+  writeRow(next_phase_);
+  if (file_ != nullptr) {
+    fclose(file_);
+    file_ = nullptr;
+  }
+}
+
+void CommMatrix::send(NodeType dest, MsgSizeType size, bool bcast) {
+  auto& entry = row_[dest];
+  entry.messages_++;
+  entry.bytes_ += static_cast<uint64_t>(size);
+  if (bcast) {
+    entry.bcasts_++;
+  }
+}
+
+void CommMatrix::endPhase(PhaseType const phase) {
+  writeRow(phase);
+  next_phase_ = phase + 1;
+}
+
+void CommMatrix::writeRow(PhaseType const phase) {
+  using ArgType = vt::arguments::ArgConfig;
+
+  if (row_.empty()) {
+    return;
+  }
+
+  auto const this_node = theContext()->getNode();
+
+  if (file_ == nullptr) {
+    // Rows are written from inside the LB release handler, so there is no
+    // barrier to wait for node 0 to create the directory; an existing
+    // directory is fine
+    auto const dir = std::string(ArgType::vt_comm_matrix_dir);
+    mkdir(dir.c_str(), S_IRWXU);
+
+    auto const file_name = fmt::format(
+      "{}/{}.{}.csv", dir, ArgType::vt_comm_matrix_file, this_node
+    );
+
+    debug_print(
+      active, node,
+      "CommMatrix: writeRow: opening file={}\n", file_name
+    );
+
+    file_ = fopen(file_name.c_str(), "w");
+    vtAssert(file_ != nullptr, "Must be able to open the comm matrix file");
+    fprintf(file_, "phase,from,to,messages,bytes,bcasts\n");
+  }
+
+  auto const out = formatRow(phase, this_node, row_);
+  fwrite(out.data(), 1, out.size(), file_);
+  fflush(file_);
+
+  row_.clear();
+}
+
+/*static*/ std::string CommMatrix::formatRow(
+  PhaseType const phase, NodeType const from, RowType const& row
+) {
+  using EntryType = std::pair<NodeType, CommMatrixEntry>;
+
+  std::vector<EntryType> entries(row.begin(), row.end());
+  std::sort(
+    entries.begin(), entries.end(),
+    [](EntryType const& a, EntryType const& b) { return a.first < b.first; }
+  );
+
+  std::string out;
+  for (auto&& elm : entries) {
+    out += fmt::format(
+      "{},{},{},{},{},{}\n", phase, from, elm.first, elm.second.messages_,
+      elm.second.bytes_, elm.second.bcasts_
+    );
+  }
+  return out;
+}
+
+}} /* end namespace vt::messaging */
@@ -0,0 +1,109 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                comm_matrix.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#if !defined INCLUDED_VT_MESSAGING_COMM_MATRIX_H
+#define INCLUDED_VT_MESSAGING_COMM_MATRIX_H
+
+#include "vt/config.h"
+#include "vt/messaging/listener.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+
+namespace vt { namespace messaging {
+
+struct CommMatrixEntry {
+  uint64_t messages_ = 0;
+  uint64_t bytes_    = 0;
+  uint64_t bcasts_   = 0;
+};
+
+/*
+ * This rank's row of the rank x rank communication matrix: messages and bytes
+ * sent to each destination, counted from the send listener and kept sparse.
+ * At each phase boundary the row is appended to
+ * "<vt_comm_matrix_dir>/<vt_comm_matrix_file>.<node>.csv" as
+ *   phase,from,to,messages,bytes,bcasts
+ * and reset; whatever is sent after the last phase is written at finalize.
+ */
+struct CommMatrix : Listener {
+  using RowType = std::unordered_map<NodeType, CommMatrixEntry>;
+
+  CommMatrix() = default;
+  CommMatrix(CommMatrix const&) = delete;
+  CommMatrix& operator=(CommMatrix const&) = delete;
+
+  virtual ~CommMatrix();
+
+  void send(NodeType dest, MsgSizeType size, bool bcast) override;
+
+  /*
+   * Write the row for `phase' and start counting the next one
+   */
+  void endPhase(PhaseType const phase);
+
+  RowType const& getRow() const { return row_; }
+
+  /*
+   * CSV lines for a row, sorted by destination
+   */
+  static std::string formatRow(
+    PhaseType const phase, NodeType const from, RowType const& row
+  );
+
+private:
+  void writeRow(PhaseType const phase);
+
+private:
+  RowType row_;
+  PhaseType next_phase_ = 0;
+  FILE* file_           = nullptr;
+};
+
+}} /* end namespace vt::messaging */
+
+#endif /*INCLUDED_VT_MESSAGING_COMM_MATRIX_H*/
@@ -0,0 +1,222 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              handler_metrics.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#include "vt/config.h"
+#include "vt/context/context.h"
+#include "vt/messaging/handler_metrics.h"
+#include "vt/handler/handler.h"
+#include "vt/registry/auto/auto_registry_interface.h"
+#include "vt/timing/timing.h"
+
+#if backend_check_enabled(trace_enabled)
+  #include "vt/trace/trace_registry.h"
+#endif
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace vt { namespace messaging {
+
+void HandlerStats::merge(HandlerStats const& other) {
+  count_ += other.count_;
+  total_time_ += other.total_time_;
+  min_time_ = std::min(min_time_, other.min_time_);
+  max_time_ = std::max(max_time_, other.max_time_);
+  bytes_recv_ += other.bytes_recv_;
+}
+
+void MetricsSnapshot::merge(MetricsSnapshot const& other) {
+  for (auto&& elm : other.handlers_) {
+    handlers_[elm.first].merge(elm.second);
+  }
+  for (auto&& elm : other.ranks_) {
+    ranks_[elm.first].merge(elm.second);
+  }
+  time_ = std::max(time_, other.time_);
+}
+
+MetricsSnapshot MetricsSnapshot::diff(MetricsSnapshot const& earlier) const {
+  MetricsSnapshot out;
+  out.time_ = time_;
+
+  for (auto&& elm : handlers_) {
+    auto stats = elm.second;
+    auto iter = earlier.handlers_.find(elm.first);
+    if (iter != earlier.handlers_.end()) {
+      auto const& prev = iter->second;
+      stats.count_ -= std::min(stats.count_, prev.count_);
+      stats.total_time_ = std::max(0.0, stats.total_time_ - prev.total_time_);
+      stats.bytes_recv_ -= std::min(stats.bytes_recv_, prev.bytes_recv_);
+    }
+    if (stats.count_ != 0 or stats.bytes_recv_ != 0) {
+      out.handlers_[elm.first] = stats;
+    }
+  }
+
+  for (auto&& elm : ranks_) {
+    auto stats = elm.second;
+    auto iter = earlier.ranks_.find(elm.first);
+    if (iter != earlier.ranks_.end()) {
+      stats.messages_ -= std::min(stats.messages_, iter->second.messages_);
+      stats.bytes_ -= std::min(stats.bytes_, iter->second.bytes_);
+    }
+    if (stats.messages_ != 0) {
+      out.ranks_[elm.first] = stats;
+    }
+  }
+
+  return out;
+}
+
+HandlerMetrics::HandlerMetrics()
+  : slots_(1)
+{ }
+
+void HandlerMetrics::initWorkers(WorkerCountType const num_workers) {
+  slots_.resize(static_cast<std::size_t>(num_workers) + 1);
+}
+
+MetricsSnapshot& HandlerMetrics::getSlot() {
+  auto const worker = theContext()->getWorker();
+  if (worker == worker_id_comm_thread or worker == no_worker_id) {
+    return slots_[0];
+  }
+
+  auto const slot = static_cast<std::size_t>(worker) + 1;
+  vtAssert(slot < slots_.size(), "Metrics must be initialized for each worker");
+  return slots_[slot];
+}
+
+MetricsSnapshot HandlerMetrics::snapshot() const {
+  MetricsSnapshot out;
+  for (auto&& slot : slots_) {
+    out.merge(slot);
+  }
+  out.time_ = timing::Timing::getCurrentTime();
+  return out;
+}
+
+void HandlerMetrics::reset() {
+  for (auto&& slot : slots_) {
+    slot = MetricsSnapshot{};
+  }
+}
+
+/*static*/ std::string HandlerMetrics::getHandlerName(HandlerType const han) {
+  #if backend_check_enabled(trace_enabled)
+    using auto_registry::RegistryTypeEnum;
+
+    if (HandlerManager::isHandlerAuto(han)) {
+      auto const reg_type = HandlerManager::isHandlerObjGroup(han) ?
+        RegistryTypeEnum::RegObjGroup : RegistryTypeEnum::RegGeneral;
+      auto const ep = auto_registry::theTraceID(han, reg_type);
+      auto const name = trace::TraceRegistry::getEventFullName(ep);
+      if (name != "") {
+        return name;
+      }
+    }
+  #endif
+
+  return fmt::format("{:x}", han);
+}
+
+/*static*/ void HandlerMetrics::print(
+  MetricsSnapshot const& snap, std::string const& label
+) {
+  using HandlerEntryType = std::pair<HandlerType, HandlerStats>;
+  using RankEntryType = std::pair<NodeType, RankStats>;
+
+  std::vector<HandlerEntryType> handlers(
+    snap.handlers_.begin(), snap.handlers_.end()
+  );
+  std::sort(
+    handlers.begin(), handlers.end(),
+    [](HandlerEntryType const& a, HandlerEntryType const& b) {
+      return a.second.total_time_ > b.second.total_time_;
+    }
+  );
+
+  std::vector<RankEntryType> ranks(snap.ranks_.begin(), snap.ranks_.end());
+  std::sort(
+    ranks.begin(), ranks.end(),
+    [](RankEntryType const& a, RankEntryType const& b) {
+      return a.first < b.first;
+    }
+  );
+
+  vt_print(
+    active,
+    "HandlerMetrics ({}): {} handlers, {} destinations\n",
+    label, handlers.size(), ranks.size()
+  );
+  vt_print(
+    active,
+    "  {:>10} {:>12} {:>12} {:>12} {:>12} {:>14}  {}\n",
+    "count", "total(s)", "avg(s)", "min(s)", "max(s)", "bytes_recv", "handler"
+  );
+  for (auto&& elm : handlers) {
+    auto const& stats = elm.second;
+    auto const min_time = stats.count_ == 0 ? 0.0 : stats.min_time_;
+    vt_print(
+      active,
+      "  {:>10} {:>12.6f} {:>12.6f} {:>12.6f} {:>12.6f} {:>14}  {}\n",
+      stats.count_, stats.total_time_, stats.avgTime(), min_time,
+      stats.max_time_, stats.bytes_recv_, getHandlerName(elm.first)
+    );
+  }
+  vt_print(
+    active, "  {:>10} {:>14}  {}\n", "messages", "bytes_sent", "dest"
+  );
+  for (auto&& elm : ranks) {
+    vt_print(
+      active, "  {:>10} {:>14}  {}\n",
+      elm.second.messages_, elm.second.bytes_, elm.first
+    );
+  }
+}
+
+}} /* end namespace vt::messaging */
@@ -0,0 +1,159 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              handler_metrics.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#if !defined INCLUDED_VT_MESSAGING_HANDLER_METRICS_H
+#define INCLUDED_VT_MESSAGING_HANDLER_METRICS_H
+
+#include "vt/config.h"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vt { namespace messaging {
+
+struct HandlerStats {
+  void add(double const time) {
+    count_++;
+    total_time_ += time;
+    min_time_ = time < min_time_ ? time : min_time_;
+    max_time_ = time > max_time_ ? time : max_time_;
+  }
+  void merge(HandlerStats const& other);
+
+  double avgTime() const {
+    return count_ == 0 ? 0.0 : total_time_ / static_cast<double>(count_);
+  }
+
+  uint64_t count_      = 0;
+  double total_time_   = 0.0;
+  double min_time_     = std::numeric_limits<double>::max();
+  double max_time_     = 0.0;
+  uint64_t bytes_recv_ = 0;
+};
+
+struct RankStats {
+  void merge(RankStats const& other) {
+    messages_ += other.messages_;
+    bytes_ += other.bytes_;
+  }
+
+  uint64_t messages_ = 0;
+  uint64_t bytes_    = 0;
+};
+
+/*
+ * Handler executions (keyed by handler) and sends (keyed by destination rank)
+ * counted since the last reset, as of time_
+ */
+struct MetricsSnapshot {
+  using HandlerMapType = std::unordered_map<HandlerType, HandlerStats>;
+  using RankMapType = std::unordered_map<NodeType, RankStats>;
+
+  void merge(MetricsSnapshot const& other);
+
+  /*
+   * What was counted after `earlier': counts, times and bytes are subtracted;
+   * min/max times cannot be, so they are those of this snapshot
+   */
+  MetricsSnapshot diff(MetricsSnapshot const& earlier) const;
+
+  HandlerMapType handlers_;
+  RankMapType ranks_;
+  double time_ = 0.0;
+};
+
+/*
+ * Always-on, per-handler runtime metrics: invocation count, total/min/max
+ * execution time and bytes received per handler, plus messages and bytes sent
+ * per destination rank.
+ *
+ * Each thread (the communication thread and every worker) counts into its own
+ * slot without synchronization; slots are only combined when a snapshot is
+ * taken. As with the worker memory pools, snapshot() and reset() must be
+ * called from the communication thread while the workers are idle.
+ */
+struct HandlerMetrics {
+  HandlerMetrics();
+
+  HandlerMetrics(HandlerMetrics const&) = delete;
+  HandlerMetrics& operator=(HandlerMetrics const&) = delete;
+
+  void initWorkers(WorkerCountType const num_workers);
+
+  void recordExecution(HandlerType const han, double const time) {
+    getSlot().handlers_[han].add(time);
+  }
+  void recordRecv(HandlerType const han, MsgSizeType const bytes) {
+    getSlot().handlers_[han].bytes_recv_ += bytes;
+  }
+  void recordSend(NodeType const dest, MsgSizeType const bytes) {
+    auto& rank = getSlot().ranks_[dest];
+    rank.messages_++;
+    rank.bytes_ += bytes;
+  }
+
+  MetricsSnapshot snapshot() const;
+  void reset();
+
+  /*
+   * Print a summary table, busiest handlers first
+   */
+  static void print(MetricsSnapshot const& snap, std::string const& label);
+  static std::string getHandlerName(HandlerType const han);
+
+private:
+  MetricsSnapshot& getSlot();
+
+private:
+  // Slot 0 is the communication thread, slot i + 1 is worker i
+  std::vector<MetricsSnapshot> slots_;
+};
+
+}} /* end namespace vt::messaging */
+
+#endif /*INCLUDED_VT_MESSAGING_HANDLER_METRICS_H*/
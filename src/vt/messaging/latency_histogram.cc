@@ -0,0 +1,200 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             latency_histogram.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#include "vt/config.h"
+#include "vt/messaging/latency_histogram.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+
+namespace vt { namespace messaging {
+
+LatencyHistogram::LatencyHistogram()
+  : counts_(latency_hist_buckets, 0)
+{ }
+
+/*static*/ std::size_t LatencyHistogram::bucketOf(int64_t const ns) {
+  if (ns <= 0) {
+    return 0;
+  }
+
+  auto const value = static_cast<uint64_t>(ns);
+  if (value < latency_hist_sub_count) {
+    return static_cast<std::size_t>(value);
+  }
+
+  int exp = 0;
+  while ((value >> (exp + 1)) != 0) {
+    exp++;
+  }
+  if (exp > latency_hist_max_exp) {
+    return latency_hist_buckets - 1;
+  }
+
+  auto const shift = exp - latency_hist_sub_bits;
+  auto const sub = (value >> shift) - latency_hist_sub_count;
+  return (shift + 1) * latency_hist_sub_count + static_cast<std::size_t>(sub);
+}
+
+/*static*/ int64_t LatencyHistogram::bucketLower(std::size_t const bucket) {
+  if (bucket < latency_hist_sub_count) {
+    return static_cast<int64_t>(bucket);
+  }
+  auto const shift = bucket / latency_hist_sub_count - 1;
+  auto const sub = bucket % latency_hist_sub_count;
+  return static_cast<int64_t>((latency_hist_sub_count + sub) << shift);
+}
+
+/*static*/ int64_t LatencyHistogram::bucketUpper(std::size_t const bucket) {
+  if (bucket + 1 >= latency_hist_buckets) {
+    return std::numeric_limits<int64_t>::max();
+  }
+  return bucketLower(bucket + 1) - 1;
+}
+
+void LatencyHistogram::add(int64_t const ns) {
+  counts_[bucketOf(ns)]++;
+  count_++;
+  sum_ += ns;
+  min_ = std::min(min_, ns);
+  max_ = std::max(max_, ns);
+}
+
+LatencyHistogram operator+(LatencyHistogram h1, LatencyHistogram const& h2) {
+  vtAssert(
+    h1.counts_.size() == h2.counts_.size(), "Histograms must have equal buckets"
+  );
+  for (std::size_t i = 0; i < h1.counts_.size(); i++) {
+    h1.counts_[i] += h2.counts_[i];
+  }
+  h1.count_ += h2.count_;
+  h1.sum_ += h2.sum_;
+  h1.min_ = std::min(h1.min_, h2.min_);
+  h1.max_ = std::max(h1.max_, h2.max_);
+  return h1;
+}
+
+int64_t LatencyHistogram::percentile(double const q) const {
+  if (count_ == 0) {
+    return 0;
+  }
+
+  auto const clamped = std::min(1.0, std::max(0.0, q));
+  auto const rank = std::max(
+    int64_t{1},
+    static_cast<int64_t>(std::ceil(clamped * static_cast<double>(count_)))
+  );
+
+  int64_t seen = 0;
+  for (std::size_t i = 0; i < counts_.size(); i++) {
+    seen += counts_[i];
+    if (seen >= rank) {
+      return std::min(bucketUpper(i), max_);
+    }
+  }
+  return max_;
+}
+
+std::string getCategoryName(MsgCategory const cat) {
+  switch (cat) {
+  case MsgCategory::Active:      return "active";
+  case MsgCategory::Collection:  return "collection";
+  case MsgCategory::ObjGroup:    return "objgroup";
+  case MsgCategory::Termination: return "termination";
+  case MsgCategory::Location:    return "location";
+  default:                       return "unknown";
+  }
+}
+
+DeliveryLatency::DeliveryLatency()
+  : wait_(num_msg_categories), exec_(num_msg_categories)
+{ }
+
+void DeliveryLatency::add(
+  MsgCategory const cat, int64_t const wait_ns, int64_t const exec_ns
+) {
+  auto const idx = static_cast<std::size_t>(cat);
+  wait_[idx].add(wait_ns);
+  exec_[idx].add(exec_ns);
+}
+
+DeliveryLatency operator+(DeliveryLatency d1, DeliveryLatency const& d2) {
+  for (std::size_t i = 0; i < num_msg_categories; i++) {
+    d1.wait_[i] = d1.wait_[i] + d2.wait_[i];
+    d1.exec_[i] = d1.exec_[i] + d2.exec_[i];
+  }
+  return d1;
+}
+
+std::string DeliveryLatency::toString() const {
+  std::string out = fmt::format(
+    "{:>12} {:>5} {:>10} {:>12} {:>12} {:>12} {:>12} {:>12}\n",
+    "category", "", "count", "mean(ns)", "p50(ns)", "p90(ns)", "p99(ns)",
+    "max(ns)"
+  );
+
+  auto row = [&](std::string const& name, char const* kind,
+                 LatencyHistogram const& hist) {
+    out += fmt::format(
+      "{:>12} {:>5} {:>10} {:>12.0f} {:>12} {:>12} {:>12} {:>12}\n",
+      name, kind, hist.count(), hist.mean(), hist.percentile(0.5),
+      hist.percentile(0.9), hist.percentile(0.99), hist.max()
+    );
+  };
+
+  for (std::size_t i = 0; i < num_msg_categories; i++) {
+    if (wait_[i].count() == 0) {
+      continue;
+    }
+    auto const name = getCategoryName(static_cast<MsgCategory>(i));
+    row(name, "wait", wait_[i]);
+    row(name, "exec", exec_[i]);
+  }
+  return out;
+}
+
+}} /* end namespace vt::messaging */
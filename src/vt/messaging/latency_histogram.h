@@ -0,0 +1,165 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             latency_histogram.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#if !defined INCLUDED_VT_MESSAGING_LATENCY_HISTOGRAM_H
+#define INCLUDED_VT_MESSAGING_LATENCY_HISTOGRAM_H
+
+#include "vt/config.h"
+
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+
+namespace vt { namespace messaging {
+
+/*
+ * Latencies are bucketed HDR-style: values below 2^latency_hist_sub_bits ns
+ * get a bucket each, and every power of two above is split into
+ * 2^latency_hist_sub_bits linear sub-buckets, so a bucket is never wider than
+ * 1/8 of its value. Values above 2^latency_hist_max_exp ns (~18 minutes) land
+ * in the last bucket.
+ */
+static constexpr int const latency_hist_sub_bits = 3;
+static constexpr int const latency_hist_max_exp = 40;
+static constexpr std::size_t const latency_hist_sub_count =
+  std::size_t{1} << latency_hist_sub_bits;
+static constexpr std::size_t const latency_hist_buckets =
+  (latency_hist_max_exp - latency_hist_sub_bits + 2) * latency_hist_sub_count;
+
+struct LatencyHistogram {
+  LatencyHistogram();
+
+  void add(int64_t const ns);
+
+  friend LatencyHistogram operator+(
+    LatencyHistogram h1, LatencyHistogram const& h2
+  );
+
+  int64_t count() const { return count_; }
+  int64_t min() const { return count_ == 0 ? 0 : min_; }
+  int64_t max() const { return max_; }
+  double mean() const {
+    return count_ == 0 ? 0.0 :
+      static_cast<double>(sum_) / static_cast<double>(count_);
+  }
+
+  /*
+   * Highest value that falls in the same bucket as the q-th quantile (q in
+   * [0,1]), capped at the largest recorded value
+   */
+  int64_t percentile(double const q) const;
+
+  static std::size_t bucketOf(int64_t const ns);
+  static int64_t bucketLower(std::size_t const bucket);
+  static int64_t bucketUpper(std::size_t const bucket);
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | counts_ | count_ | sum_ | min_ | max_;
+  }
+
+  std::vector<int64_t> counts_;
+  int64_t count_ = 0;
+  int64_t sum_   = 0;
+  int64_t min_   = std::numeric_limits<int64_t>::max();
+  int64_t max_   = 0;
+};
+
+/*
+ * What a delivered message was, for the latency histograms. The default comes
+ * from the envelope (termination) and handler (objgroup); location and
+ * collection handlers refine it with ActiveMessenger::setCurrentCategory.
+ */
+enum struct MsgCategory : int8_t {
+  Active      = 0,
+  Collection  = 1,
+  ObjGroup    = 2,
+  Termination = 3,
+  Location    = 4
+};
+
+static constexpr std::size_t const num_msg_categories = 5;
+
+std::string getCategoryName(MsgCategory const cat);
+
+/*
+ * Per category, how long messages waited between arriving from MPI and their
+ * handler starting (buffering for a handler, put data), and how long the
+ * handler ran. Merge across ranks with a PlusOp reduction.
+ */
+struct DeliveryLatency {
+  DeliveryLatency();
+
+  void add(MsgCategory const cat, int64_t const wait_ns, int64_t const exec_ns);
+
+  friend DeliveryLatency operator+(
+    DeliveryLatency d1, DeliveryLatency const& d2
+  );
+
+  LatencyHistogram const& getWait(MsgCategory const cat) const {
+    return wait_[static_cast<std::size_t>(cat)];
+  }
+  LatencyHistogram const& getExec(MsgCategory const cat) const {
+    return exec_[static_cast<std::size_t>(cat)];
+  }
+
+  /*
+   * A table of count, mean and percentiles for each non-empty histogram
+   */
+  std::string toString() const;
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | wait_ | exec_;
+  }
+
+  std::vector<LatencyHistogram> wait_;
+  std::vector<LatencyHistogram> exec_;
+};
+
+}} /* end namespace vt::messaging */
+
+#endif /*INCLUDED_VT_MESSAGING_LATENCY_HISTOGRAM_H*/
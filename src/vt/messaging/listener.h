@@ -50,6 +50,7 @@
 namespace vt { namespace messaging {
 
 struct Listener {
+  virtual ~Listener() = default;
   virtual void send(NodeType dest, MsgSizeType size, bool bcast) = 0;
 };
 
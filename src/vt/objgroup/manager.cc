@@ -49,6 +49,7 @@
 #include "vt/objgroup/type_registry/registry.h"
 #include "vt/context/context.h"
 #include "vt/messaging/message/smart_ptr_virtual.h"
+#include "vt/scheduler/scheduler.h"
 
 namespace vt { namespace objgroup {
 
@@ -141,6 +142,7 @@ void scheduleMsg(MsgVirtualPtrAny msg, HandlerType han, EpochType epoch) {
     theObjGroup()->dispatch(msg,han);
     theTerm()->consume(epoch);
   });
+  sched::wakeup(sched::SchedComponent::ObjGroup);
 }
 
 }} /* end namespace vt::objgroup */
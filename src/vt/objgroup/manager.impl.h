@@ -58,6 +58,7 @@
 #include "vt/registry/auto/auto_registry.h"
 #include "vt/collective/collective_alg.h"
 #include "vt/messaging/active.h"
+#include "vt/scheduler/scheduler.h"
 
 #include <memory>
 
@@ -184,6 +185,7 @@ void ObjGroupManager::regObjProxy(ObjT* obj, ObjGroupProxyType proxy) {
       });
     }
     pending_.erase(pending_iter);
+    sched::wakeup(sched::SchedComponent::ObjGroup);
   }
 }
 
@@ -62,6 +62,7 @@
 #include "vt/vrt/context/context_vrtmanager.h"
 #include "vt/vrt/collection/collection_headers.h"
 #include "vt/worker/worker_headers.h"
+#include "vt/timing/timing.h"
 #include "vt/configs/generated/vt_git_revision.h"
 #include "vt/configs/debug/debug_colorize.h"
 #include "vt/configs/arguments/args.h"
@@ -434,15 +435,70 @@ void Runtime::printStartupBanner() {
       auto a2 = opt_on("--vt_lb_interval", a1);
       fmt::print("{}\t{}{}", vt_pre, a2, reset);
     }
+    if (ArgType::vt_lb_model != "persistence") {
+      auto a5 = fmt::format("Load model: \"{}\"", ArgType::vt_lb_model);
+      auto a6 = opt_on("--vt_lb_model", a5);
+      fmt::print("{}\t{}{}", vt_pre, a6, reset);
+    }
+    if (ArgType::vt_lb_migration_horizon > 0) {
+      auto a7 = fmt::format(
+        "Migration cost aware over {} phases at {} bytes/sec",
+        ArgType::vt_lb_migration_horizon, ArgType::vt_lb_migration_bandwidth
+      );
+      auto a8 = opt_on("--vt_lb_migration_horizon", a7);
+      fmt::print("{}\t{}{}", vt_pre, a8, reset);
+    }
+    if (ArgType::vt_lb_timer != "mpi") {
+      auto a9 = fmt::format("LB timer: \"{}\"", ArgType::vt_lb_timer);
+      auto a10 = opt_on("--vt_lb_timer", a9);
+      fmt::print("{}\t{}{}", vt_pre, a10, reset);
+    }
+    if (ArgType::vt_lb_load == "cpu") {
+      auto a11 = opt_on("--vt_lb_load", "Balancing on thread CPU time");
+      fmt::print("{}\t{}{}", vt_pre, a11, reset);
+    }
+    if (ArgType::vt_lb_async) {
+      auto a12 = opt_on(
+        "--vt_lb_async", "LB overlapped with the next phase, deferred migrations"
+      );
+      fmt::print("{}\t{}{}", vt_pre, a12, reset);
+    }
+    if (ArgType::vt_lb_memory_capacity > 0) {
+      auto a13 = fmt::format(
+        "Element memory per rank capped at {} bytes",
+        ArgType::vt_lb_memory_capacity
+      );
+      auto a14 = opt_on("--vt_lb_memory_capacity", a13);
+      fmt::print("{}\t{}{}", vt_pre, a14, reset);
+    }
+    if (ArgType::vt_lb_stats_json != "") {
+      auto a15 = fmt::format(
+        "LB statistics as JSON lines in \"{}\"", ArgType::vt_lb_stats_json
+      );
+      auto a16 = opt_on("--vt_lb_stats_json", a15);
+      fmt::print("{}\t{}{}", vt_pre, a16, reset);
+    }
   }
 
   if (ArgType::vt_lb_stats) {
     auto f9 = opt_on("--vt_lb_stats", "Load balancing statistics collection");
     fmt::print("{}\t{}{}", vt_pre, f9, reset);
 
+    if (ArgType::vt_lb_stats_binary) {
+      auto f11 = fmt::format(
+        "LB stats streamed in binary per phase{}",
+        ArgType::vt_lb_stats_compress ? ", zlib compressed" : ""
+      );
+      auto f12 = opt_on("--vt_lb_stats_binary", f11);
+      fmt::print("{}\t{}{}", vt_pre, f12, reset);
+    }
+
     auto const fname = ArgType::vt_lb_stats_file;
     if (fname != "") {
-      auto f11 = fmt::format("LB stats file name \"{}.0.out\"", fname);
+      auto const ext = not ArgType::vt_lb_stats_binary ? "out" : (
+        ArgType::vt_lb_stats_compress ? "bin.gz" : "bin"
+      );
+      auto f11 = fmt::format("LB stats file name \"{}.0.{}\"", fname, ext);
       auto f12 = opt_on("--vt_lb_stats_file", f11);
       fmt::print("{}\t{}{}", vt_pre, f12, reset);
     }
@@ -496,6 +552,47 @@ void Runtime::printStartupBanner() {
       auto f12 = opt_on("--vt_trace_mod", f11);
       fmt::print("{}\t{}{}", vt_pre, f12, reset);
     }
+    if (ArgType::vt_trace_stream) {
+      auto f11 = fmt::format(
+        "Streaming traces, {} MiB buffer, policy \"{}\" when the writer is behind",
+        ArgType::vt_trace_stream_buffer, ArgType::vt_trace_stream_policy
+      );
+      auto f12 = opt_on("--vt_trace_stream", f11);
+      fmt::print("{}\t{}{}", vt_pre, f12, reset);
+    }
+    if (ArgType::vt_trace_binary) {
+      auto f11 = fmt::format("Writing binary traces");
+      auto f12 = opt_on("--vt_trace_binary", f11);
+      fmt::print("{}\t{}{}", vt_pre, f12, reset);
+    }
+    if (ArgType::vt_trace_filter != "") {
+      auto f11 = fmt::format(
+        "Tracing only handlers matching \"{}\"", ArgType::vt_trace_filter
+      );
+      auto f12 = opt_on("--vt_trace_filter", f11);
+      fmt::print("{}\t{}{}", vt_pre, f12, reset);
+    }
+    if (ArgType::vt_trace_phase_first != -1 or
+        ArgType::vt_trace_phase_last != -1) {
+      auto f11 = fmt::format(
+        "Tracing phases {} to {}", ArgType::vt_trace_phase_first,
+        ArgType::vt_trace_phase_last
+      );
+      auto f12 = opt_on("--vt_trace_phase_first/last", f11);
+      fmt::print("{}\t{}{}", vt_pre, f12, reset);
+    }
+    if (ArgType::vt_trace_ranks != "") {
+      auto f11 = fmt::format("Tracing ranks {}", ArgType::vt_trace_ranks);
+      auto f12 = opt_on("--vt_trace_ranks", f11);
+      fmt::print("{}\t{}{}", vt_pre, f12, reset);
+    }
+    if (ArgType::vt_trace_sample > 1) {
+      auto f11 = fmt::format(
+        "Tracing one in {} executions of each handler", ArgType::vt_trace_sample
+      );
+      auto f12 = opt_on("--vt_trace_sample", f11);
+      fmt::print("{}\t{}{}", vt_pre, f12, reset);
+    }
   }
   #endif
 
@@ -900,6 +997,9 @@ void Runtime::finalizeContext() {
 void Runtime::initializeComponents() {
   debug_print(runtime, node, "begin: initializeComponents\n");
 
+  // Select (and calibrate) the clocks timing collection elements
+  timing::Timing::initializeLBTimers();
+
   // Helper components: not allowed to send messages during construction
   theRegistry = std::make_unique<registry::Registry>();
   theEvent = std::make_unique<event::AsyncEvent>();
@@ -995,6 +1095,9 @@ void Runtime::initializeWorkers(WorkerCountType const num_workers) {
     // Initialize individual memory pool for each worker
     thePool->initWorkerPools(num_workers);
 
+    // Each worker counts messaging metrics in its own slot
+    theMsg->getMetrics().initWorkers(num_workers);
+
     theWorkerGrp = std::make_unique<worker::WorkerGroupType>();
 
     auto localTermFn = [](worker::eWorkerGroupEvent event){
@@ -0,0 +1,123 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                poll_backoff.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_SCHEDULER_POLL_BACKOFF_H
+#define INCLUDED_SCHEDULER_POLL_BACKOFF_H
+
+#include "vt/config.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+namespace vt { namespace sched {
+
+/*
+ * Exponential backoff for polling one scheduler component. Every empty poll
+ * doubles the number of scheduler passes the component is skipped for, up to
+ * the maximum interval; a productive poll resets it and a wakeup hint forces
+ * the next poll. A maximum interval of zero never skips.
+ *
+ * Hints may be posted from any thread; everything else is only touched by the
+ * communication thread. A lost or late hint only delays a poll until the
+ * current interval runs out.
+ */
+struct PollBackoff {
+  PollBackoff() = default;
+  explicit PollBackoff(uint32_t const in_max_interval)
+    : max_interval_(in_max_interval)
+  { }
+
+  PollBackoff(PollBackoff const&) = delete;
+  PollBackoff& operator=(PollBackoff const&) = delete;
+
+  void setMaxInterval(uint32_t const in_max_interval) {
+    max_interval_ = in_max_interval;
+    interval_ = std::min(interval_, max_interval_);
+    skip_ = std::min(skip_, interval_);
+  }
+
+  /*
+   * Whether the component is due to be polled on this pass: counts down the
+   * current interval and consumes a pending hint
+   */
+  bool shouldPoll() {
+    if (woken_.load(std::memory_order_relaxed)) {
+      woken_.store(false, std::memory_order_relaxed);
+      skip_ = 0;
+      return true;
+    }
+    if (skip_ > 0) {
+      skip_--;
+      return false;
+    }
+    return true;
+  }
+
+  void record(bool const productive) {
+    if (productive) {
+      interval_ = 0;
+    } else {
+      interval_ = std::min(interval_ == 0 ? 1 : interval_ * 2, max_interval_);
+    }
+    skip_ = interval_;
+  }
+
+  void wakeup() { woken_.store(true, std::memory_order_relaxed); }
+
+  uint32_t getInterval() const { return interval_; }
+  uint32_t getMaxInterval() const { return max_interval_; }
+
+private:
+  uint32_t max_interval_ = 0;
+  // current number of passes skipped after an empty poll
+  uint32_t interval_ = 0;
+  // passes left to skip before the next poll
+  uint32_t skip_ = 0;
+  std::atomic<bool> woken_{false};
+};
+
+}} /* end namespace vt::sched */
+
+#endif /*INCLUDED_SCHEDULER_POLL_BACKOFF_H*/
@@ -52,6 +52,12 @@
 #include "vt/worker/worker_headers.h"
 #include "vt/vrt/collection/manager.h"
 #include "vt/objgroup/manager.fwd.h"
+#include "vt/timing/timing.h"
+#include "vt/trace/trace_user.h"
+#include "vt/configs/arguments/args.h"
+
+#include <algorithm>
+#include <memory>
 
 namespace vt { namespace sched {
 
@@ -65,21 +71,113 @@ namespace vt { namespace sched {
 Scheduler::Scheduler() {
   event_triggers.resize(SchedulerEventType::SchedulerEventSize + 1);
   event_triggers_once.resize(SchedulerEventType::SchedulerEventSize + 1);
+
+  using ArgType = arguments::ArgConfig;
+  if (ArgType::vt_sched_metrics) {
+    auto const max_idle = std::max(0, ArgType::vt_sched_idle_timeline);
+    metrics_ = std::make_unique<SchedulerMetrics>(
+      static_cast<std::size_t>(max_idle)
+    );
+  }
+
+  adaptive_ = not ArgType::vt_sched_poll_compat;
+  auto const max_backoff = static_cast<uint32_t>(
+    std::max(0, ArgType::vt_sched_max_backoff)
+  );
+  for (auto&& backoff : backoff_) {
+    backoff.setMaxInterval(max_backoff);
+  }
+  // Never back off from probing MPI, nor from the workers, which are fed by
+  // other threads that post no hints
+  for (auto&& component : {
+    SchedComponent::Msg, SchedComponent::Workers, SchedComponent::WorkerComm
+  }) {
+    backoff_[static_cast<std::size_t>(component)].setMaxInterval(0);
+  }
+}
+
+Scheduler::~Scheduler() {
+  if (metrics_ != nullptr) {
+    SchedulerMetrics::print(metrics_->snapshot(), "finalize");
+  }
+}
+
+template <typename Callable>
+bool Scheduler::poll(SchedComponent const component, Callable&& fn) {
+  PollBackoff* backoff = nullptr;
+  if (adaptive_) {
+    backoff = &backoff_[static_cast<std::size_t>(component)];
+    // The hint and interval are consumed even when the pass is forced
+    bool const due = backoff->shouldPoll();
+    if (not due and not force_poll_) {
+      if (metrics_ != nullptr) {
+        metrics_->recordSkip(component);
+      }
+      return false;
+    }
+  }
+
+  bool work = false;
+  if (metrics_ == nullptr) {
+    work = fn();
+  } else {
+    auto const start = timing::Timing::getCycles();
+    work = fn();
+    metrics_->recordPoll(
+      component, work, timing::Timing::getCycles() - start
+    );
+  }
+
+  if (backoff != nullptr) {
+    backoff->record(work);
+  }
+  return work;
+}
+
+void Scheduler::endIdleInterval(double const time) {
+  IdleInterval interval;
+  if (metrics_->endIdle(time, &interval)) {
+    if (idle_event_ == 0) {
+      idle_event_ = trace::registerEventHashed("vt_sched_idle");
+    }
+    trace::addUserEventBracketed(idle_event_, interval.begin_, interval.end_);
+  }
 }
 
 bool Scheduler::schedulerImpl() {
   bool scheduled_work = false;
 
-  bool const msg_sch = theMsg()->scheduler();
-  bool const event_sch = theEvent()->scheduler();
-  bool const seq_sch = theSeq()->scheduler();
-  bool const vrt_seq_sch = theVirtualSeq()->scheduler();
-  bool const collection_sch = theCollection()->scheduler<>();
-  bool const objgroup_sch = objgroup::scheduler();
+  // Idle ends where the pass that finds work starts
+  auto const pass_start = metrics_ != nullptr and is_idle ?
+    timing::Timing::getCurrentTime() : 0.0;
+
+  bool const msg_sch = poll(SchedComponent::Msg, []{
+    return theMsg()->scheduler();
+  });
+  bool const event_sch = poll(SchedComponent::Event, []{
+    return theEvent()->scheduler();
+  });
+  bool const seq_sch = poll(SchedComponent::Seq, []{
+    return theSeq()->scheduler();
+  });
+  bool const vrt_seq_sch = poll(SchedComponent::VirtualSeq, []{
+    return theVirtualSeq()->scheduler();
+  });
+  bool const collection_sch = poll(SchedComponent::Collection, []{
+    return theCollection()->scheduler<>();
+  });
+  bool const objgroup_sch = poll(SchedComponent::ObjGroup, []{
+    return objgroup::scheduler();
+  });
+  // Worker progress does not report whether it did work: never productive
   bool const worker_sch =
-    theContext()->hasWorkers() ? theWorkerGrp()->progress(),false : false;
+    theContext()->hasWorkers() ? poll(SchedComponent::Workers, []{
+      return theWorkerGrp()->progress(),false;
+    }) : false;
   bool const worker_comm_sch =
-    theContext()->hasWorkers() ? theWorkerGrp()->commScheduler() : false;
+    theContext()->hasWorkers() ? poll(SchedComponent::WorkerComm, []{
+      return theWorkerGrp()->commScheduler();
+    }) : false;
 
   checkTermSingleNode();
 
@@ -88,6 +186,9 @@ bool Scheduler::schedulerImpl() {
     worker_sch or worker_comm_sch or collection_sch or objgroup_sch;
 
   if (scheduled_work) {
+    if (is_idle and metrics_ != nullptr) {
+      endIdleInterval(pass_start);
+    }
     is_idle = false;
   }
 
@@ -95,11 +196,31 @@ bool Scheduler::schedulerImpl() {
 }
 
 void Scheduler::scheduler() {
-  bool const scheduled_work1 = schedulerImpl();
-  bool const scheduled_work2 = schedulerImpl();
+  if (metrics_ != nullptr) {
+    metrics_->recordLoop();
+  }
+
+  bool scheduled_work = false;
+  if (adaptive_) {
+    // One pass while there is work; before going idle, confirm with a pass
+    // that polls every component regardless of its backoff
+    scheduled_work = schedulerImpl();
+    if (not scheduled_work and not is_idle) {
+      force_poll_ = true;
+      scheduled_work = schedulerImpl();
+      force_poll_ = false;
+    }
+  } else {
+    bool const scheduled_work1 = schedulerImpl();
+    bool const scheduled_work2 = schedulerImpl();
+    scheduled_work = scheduled_work1 or scheduled_work2;
+  }
 
-  if (not scheduled_work1 and not scheduled_work2 and not is_idle) {
+  if (not scheduled_work and not is_idle) {
     is_idle = true;
+    if (metrics_ != nullptr) {
+      metrics_->beginIdle(timing::Timing::getCurrentTime());
+    }
     // idle
     triggerEvent(SchedulerEventType::BeginIdle);
   }
@@ -146,6 +267,13 @@ void Scheduler::schedulerForever() {
   }
 }
 
+void wakeup(SchedComponent const component) {
+  auto const sched = theSched();
+  if (sched != nullptr) {
+    sched->wakeup(component);
+  }
+}
+
 }} //end namespace vt::scheduler
 
 namespace vt {
@@ -46,7 +46,11 @@
 #define INCLUDED_SCHEDULER_SCHEDULER_H
 
 #include "vt/config.h"
+#include "vt/scheduler/scheduler_metrics.h"
+#include "vt/scheduler/poll_backoff.h"
+#include "vt/trace/trace_common.h"
 
+#include <array>
 #include <cassert>
 #include <vector>
 #include <list>
@@ -68,6 +72,7 @@ struct Scheduler {
   using EventTriggerContType = std::vector<TriggerContainerType>;
 
   Scheduler();
+  ~Scheduler();
 
   static void checkTermSingleNode();
 
@@ -81,14 +86,54 @@ struct Scheduler {
   void triggerEvent(SchedulerEventType const& event);
   bool hasSchedRun() const { return has_executed_; }
 
+  /*
+   * The poll and idle profile, or nullptr without --vt_sched_metrics
+   */
+  SchedulerMetrics* getMetrics() const { return metrics_.get(); }
+
+  /*
+   * Hint that `component' has queued work so an adaptive scheduler polls it
+   * on the next pass instead of waiting out its backoff. Thread-safe.
+   */
+  void wakeup(SchedComponent const component) {
+    backoff_[static_cast<std::size_t>(component)].wakeup();
+  }
+
+  bool isAdaptive() const { return adaptive_; }
+  PollBackoff const& getBackoff(SchedComponent const component) const {
+    return backoff_[static_cast<std::size_t>(component)];
+  }
+
+private:
+  template <typename Callable>
+  bool poll(SchedComponent const component, Callable&& fn);
+
+  void endIdleInterval(double const time);
+
 private:
   bool has_executed_ = false;
   bool is_idle = false;
 
+  // Poll components with backoff unless --vt_sched_poll_compat is set
+  bool adaptive_ = true;
+  // Poll every component regardless of backoff, to confirm going idle
+  bool force_poll_ = false;
+  std::array<PollBackoff, num_sched_components> backoff_;
+
+  std::unique_ptr<SchedulerMetrics> metrics_ = nullptr;
+  trace::UserEventIDType idle_event_ = 0;
+
   EventTriggerContType event_triggers;
   EventTriggerContType event_triggers_once;
 };
 
+/*
+ * Post a wakeup hint for `component' from the communication thread, if the
+ * scheduler exists: producers may enqueue work before the scheduler is
+ * constructed or after it is destroyed
+ */
+void wakeup(SchedComponent const component);
+
 }} //end namespace vt::scheduler
 
 namespace vt {
@@ -0,0 +1,167 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             scheduler_metrics.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/scheduler/scheduler_metrics.h"
+#include "vt/timing/timing.h"
+
+#include <algorithm>
+#include <string>
+
+namespace vt { namespace sched {
+
+std::string getComponentName(SchedComponent const component) {
+  switch (component) {
+  case SchedComponent::Msg:        return "msg";
+  case SchedComponent::Event:      return "event";
+  case SchedComponent::Seq:        return "seq";
+  case SchedComponent::VirtualSeq: return "vrt_seq";
+  case SchedComponent::Collection: return "collection";
+  case SchedComponent::ObjGroup:   return "objgroup";
+  case SchedComponent::Workers:    return "workers";
+  case SchedComponent::WorkerComm: return "worker_comm";
+  default:                         return "unknown";
+  }
+}
+
+SchedulerMetrics::SchedulerMetrics(std::size_t const in_max_idle)
+  : max_idle_(in_max_idle)
+{ }
+
+void SchedulerMetrics::beginIdle(double const time) {
+  if (not isIdle()) {
+    idle_begin_ = time;
+  }
+}
+
+bool SchedulerMetrics::endIdle(double const time, IdleInterval* interval) {
+  if (not isIdle()) {
+    return false;
+  }
+
+  IdleInterval const cur{idle_begin_, std::max(time, idle_begin_)};
+  idle_begin_ = -1.0;
+  num_idle_++;
+  idle_time_ += cur.end_ - cur.begin_;
+
+  if (max_idle_ > 0) {
+    if (idle_timeline_.size() == max_idle_) {
+      idle_timeline_.pop_front();
+    }
+    idle_timeline_.push_back(cur);
+  }
+
+  if (interval != nullptr) {
+    *interval = cur;
+  }
+  return true;
+}
+
+SchedulerSnapshot SchedulerMetrics::snapshot() const {
+  SchedulerSnapshot out;
+  out.polls_ = polls_;
+  out.loops_ = loops_;
+  out.num_idle_ = num_idle_;
+  out.idle_time_ = idle_time_;
+  out.idle_timeline_.assign(idle_timeline_.begin(), idle_timeline_.end());
+  out.time_ = timing::Timing::getCurrentTime();
+  return out;
+}
+
+void SchedulerMetrics::reset() {
+  polls_ = {};
+  loops_ = 0;
+  num_idle_ = 0;
+  idle_time_ = 0.0;
+  idle_timeline_.clear();
+  // An open idle interval is kept: it is counted when it closes
+}
+
+/*static*/ void SchedulerMetrics::print(
+  SchedulerSnapshot const& snap, std::string const& label
+) {
+  vt_print(
+    gen,
+    "SchedulerMetrics ({}): {} loops, {} idle intervals, {:.6f}s idle\n",
+    label, snap.loops_, snap.num_idle_, snap.idle_time_
+  );
+  vt_print(
+    gen,
+    "  {:>12} {:>12} {:>12} {:>7} {:>16} {:>16} {:>10} {:>12}\n",
+    "component", "polls", "productive", "empty%", "cycles",
+    "empty_cycles", "cyc/poll", "skipped"
+  );
+  for (std::size_t i = 0; i < num_sched_components; i++) {
+    auto const& stats = snap.polls_[i];
+    if (stats.polls_ == 0 and stats.skipped_ == 0) {
+      continue;
+    }
+    auto const polls = std::max<uint64_t>(stats.polls_, 1);
+    auto const empty_pct = 100.0 * stats.emptyPolls() / polls;
+    auto const per_poll = static_cast<double>(stats.cycles_) / polls;
+    vt_print(
+      gen,
+      "  {:>12} {:>12} {:>12} {:>7.2f} {:>16} {:>16} {:>10.1f} {:>12}\n",
+      getComponentName(static_cast<SchedComponent>(i)), stats.polls_,
+      stats.productive_, empty_pct, stats.cycles_, stats.emptyCycles(),
+      per_poll, stats.skipped_
+    );
+  }
+
+  if (not snap.idle_timeline_.empty()) {
+    double longest = 0.0;
+    for (auto&& interval : snap.idle_timeline_) {
+      longest = std::max(longest, interval.end_ - interval.begin_);
+    }
+    vt_print(
+      gen,
+      "  idle timeline: {} most recent intervals, {:.6f}s to {:.6f}s, "
+      "longest {:.6f}s\n",
+      snap.idle_timeline_.size(), snap.idle_timeline_.front().begin_,
+      snap.idle_timeline_.back().end_, longest
+    );
+  }
+}
+
+}} /* end namespace vt::sched */
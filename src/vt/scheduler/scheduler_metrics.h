@@ -0,0 +1,172 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             scheduler_metrics.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_SCHEDULER_SCHEDULER_METRICS_H
+#define INCLUDED_SCHEDULER_SCHEDULER_METRICS_H
+
+#include "vt/config.h"
+
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+namespace vt { namespace sched {
+
+/*
+ * The components polled by each pass of the scheduler, in polling order
+ */
+enum struct SchedComponent : int8_t {
+  Msg         = 0,
+  Event       = 1,
+  Seq         = 2,
+  VirtualSeq  = 3,
+  Collection  = 4,
+  ObjGroup    = 5,
+  Workers     = 6,
+  WorkerComm  = 7
+};
+
+static constexpr std::size_t const num_sched_components = 8;
+
+std::string getComponentName(SchedComponent const component);
+
+struct PollStats {
+  uint64_t emptyPolls() const { return polls_ - productive_; }
+  uint64_t emptyCycles() const { return cycles_ - productive_cycles_; }
+
+  uint64_t polls_             = 0;
+  // polls that reported they did work
+  uint64_t productive_        = 0;
+  uint64_t cycles_            = 0;
+  uint64_t productive_cycles_ = 0;
+  // passes that skipped the component under adaptive polling
+  uint64_t skipped_           = 0;
+};
+
+struct IdleInterval {
+  double begin_ = 0.0;
+  double end_   = 0.0;
+};
+
+/*
+ * Poll and idle accounting since the last reset, as of time_
+ */
+struct SchedulerSnapshot {
+  using PollContainerType = std::array<PollStats, num_sched_components>;
+
+  PollStats const& get(SchedComponent const component) const {
+    return polls_[static_cast<std::size_t>(component)];
+  }
+
+  PollContainerType polls_ = {};
+  // calls to Scheduler::scheduler, each making one or two passes
+  uint64_t loops_ = 0;
+  uint64_t num_idle_ = 0;
+  double idle_time_ = 0.0;
+  // the most recent completed idle intervals, oldest first
+  std::vector<IdleInterval> idle_timeline_;
+  double time_ = 0.0;
+};
+
+/*
+ * Optional scheduler profiling, enabled with --vt_sched_metrics: per-component
+ * poll counts, productive versus empty polls and the cycles (TSC ticks) spent
+ * in each, plus a bounded timeline of the intervals the scheduler was idle.
+ *
+ * The scheduler only runs on the communication thread, so nothing here is
+ * synchronized.
+ */
+struct SchedulerMetrics {
+  explicit SchedulerMetrics(std::size_t const in_max_idle);
+
+  SchedulerMetrics(SchedulerMetrics const&) = delete;
+  SchedulerMetrics& operator=(SchedulerMetrics const&) = delete;
+
+  void recordPoll(
+    SchedComponent const component, bool const productive,
+    uint64_t const cycles
+  ) {
+    auto& stats = polls_[static_cast<std::size_t>(component)];
+    stats.polls_++;
+    stats.cycles_ += cycles;
+    if (productive) {
+      stats.productive_++;
+      stats.productive_cycles_ += cycles;
+    }
+  }
+
+  void recordSkip(SchedComponent const component) {
+    polls_[static_cast<std::size_t>(component)].skipped_++;
+  }
+
+  void recordLoop() { loops_++; }
+
+  void beginIdle(double const time);
+  /*
+   * Close the open idle interval, if any, returning it through `interval'
+   */
+  bool endIdle(double const time, IdleInterval* interval = nullptr);
+  bool isIdle() const { return idle_begin_ >= 0.0; }
+
+  SchedulerSnapshot snapshot() const;
+  void reset();
+
+  static void print(SchedulerSnapshot const& snap, std::string const& label);
+
+private:
+  std::array<PollStats, num_sched_components> polls_ = {};
+  uint64_t loops_ = 0;
+  uint64_t num_idle_ = 0;
+  double idle_time_ = 0.0;
+  // start of the open idle interval, negative when not idle
+  double idle_begin_ = -1.0;
+  std::size_t max_idle_ = 0;
+  std::deque<IdleInterval> idle_timeline_;
+};
+
+}} /* end namespace vt::sched */
+
+#endif /*INCLUDED_SCHEDULER_SCHEDULER_METRICS_H*/
@@ -50,6 +50,7 @@
 #include "vt/messaging/active.h"
 #include "vt/termination/termination.h"
 #include "vt/utils/container/concurrent_deque.h"
+#include "vt/scheduler/scheduler.h"
 
 #include "vt/sequence/sequencer_manager.h"
 #include "vt/sequence/seq_common.h"
@@ -98,6 +99,9 @@ struct TaggedSequencer {
   static std::unique_ptr<SeqManagerType> seq_manager;
 
   TaggedSequencer() = default;
+  explicit TaggedSequencer(sched::SchedComponent const in_component)
+    : sched_component_(in_component)
+  { }
 
   // Get the correct ID based on the type
   virtual SeqType getNextID();
@@ -189,6 +193,8 @@ protected:
   SeqContext* context_ = nullptr;
 
 private:
+  // the scheduler component woken when work is enqueued
+  sched::SchedComponent sched_component_ = sched::SchedComponent::Seq;
   SeqContextContainerType node_lookup_;
 
   SeqIDContainerType<SeqListType> seq_lookup_;
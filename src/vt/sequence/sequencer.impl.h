@@ -549,6 +549,7 @@ void TaggedSequencer<SeqTag, SeqTrigger>::enqueue(ActionType const& action) {
   );
 
   work_deque_.pushBack(action);
+  sched::wakeup(sched_component_);
 }
 
 template <typename SeqTag, template <typename> class SeqTrigger>
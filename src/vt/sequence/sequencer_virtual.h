@@ -70,6 +70,8 @@ struct TaggedSequencerVrt : TaggedSequencer<SeqTag, SeqTrigger> {
   template <typename VcT, typename MsgT, ActiveVrtTypedFnType<MsgT, VcT> *f>
   using SeqStateMatcherType = SeqMatcherVirtual<VcT, MsgT, f>;
 
+  TaggedSequencerVrt() : Base(sched::SchedComponent::VirtualSeq) { }
+
   SeqType createVirtualSeq(VirtualProxyType const& proxy);
   VirtualProxyType getCurrentVirtualProxy();
 
@@ -46,12 +46,112 @@
 #include "vt/timing/timing.h"
 #include "vt/timing/timing_type.h"
 
+#include "vt/configs/arguments/args.h"
+
+#include <cstdint>
+#include <string>
+#include <time.h>
+
 #include <mpi.h>
 
+#if defined(__x86_64__) || defined(__i386__)
+  #include <x86intrin.h>
+  #define vt_has_tsc 1
+#else
+  #define vt_has_tsc 0
+#endif
+
+#if !defined(CLOCK_MONOTONIC_RAW)
+  #define CLOCK_MONOTONIC_RAW CLOCK_MONOTONIC
+#endif
+
 namespace vt { namespace timing {
 
+/*static*/ TimerType Timing::lb_timer_ = TimerType::MPI;
+/*static*/ bool Timing::lb_cpu_time_ = false;
+/*static*/ bool Timing::lb_cpu_load_ = false;
+/*static*/ double Timing::tsc_per_sec_ = 0.0;
+
+static inline TimeType clockTime(clockid_t clock) {
+  struct timespec ts;
+  clock_gettime(clock, &ts);
+  return static_cast<TimeType>(ts.tv_sec) + ts.tv_nsec * 1e-9;
+}
+
 /*static*/ TimeType Timing::getCurrentTime() {
   return MPI_Wtime();
 }
 
+/*static*/ TimeType Timing::getLBTime() {
+  switch (lb_timer_) {
+  case TimerType::TSC:          return getTSCTime();
+  case TimerType::MonotonicRaw: return getMonotonicRawTime();
+  default:                      return getCurrentTime();
+  }
+}
+
+/*static*/ TimeType Timing::getThreadCPUTime() {
+  return clockTime(CLOCK_THREAD_CPUTIME_ID);
+}
+
+/*static*/ TimeType Timing::getMonotonicRawTime() {
+  return clockTime(CLOCK_MONOTONIC_RAW);
+}
+
+/*static*/ TimeType Timing::getTSCTime() {
+#if vt_has_tsc
+  return static_cast<TimeType>(__rdtsc()) / tsc_per_sec_;
+#else
+  return getMonotonicRawTime();
+#endif
+}
+
+/*static*/ uint64_t Timing::getCycles() {
+#if vt_has_tsc
+  return static_cast<uint64_t>(__rdtsc());
+#else
+  return static_cast<uint64_t>(getMonotonicRawTime() * 1e9);
+#endif
+}
+
+/*static*/ void Timing::initializeLBTimers() {
+  using ArgType = vt::arguments::ArgConfig;
+
+  auto const& timer = ArgType::vt_lb_timer;
+  if (timer == "tsc") {
+    lb_timer_ = TimerType::TSC;
+  } else if (timer == "monotonic") {
+    lb_timer_ = TimerType::MonotonicRaw;
+  } else {
+    vtAbortIf(
+      timer != "mpi",
+      fmt::format("Unknown timer \"{}\" for --vt_lb_timer", timer)
+    );
+    lb_timer_ = TimerType::MPI;
+  }
+
+  auto const& load = ArgType::vt_lb_load;
+  vtAbortIf(
+    load != "wall" and load != "cpu",
+    fmt::format("Unknown load \"{}\" for --vt_lb_load", load)
+  );
+  lb_cpu_load_ = load == "cpu";
+  lb_cpu_time_ = ArgType::vt_lb_cpu_time or lb_cpu_load_;
+
+#if vt_has_tsc
+  if (lb_timer_ == TimerType::TSC and tsc_per_sec_ == 0.0) {
+    // Count ticks over a short busy wait on the raw monotonic clock
+    auto const calibrate_secs = 0.02;
+    auto const t0 = getMonotonicRawTime();
+    auto const c0 = __rdtsc();
+    auto t1 = t0;
+    while (t1 - t0 < calibrate_secs) {
+      t1 = getMonotonicRawTime();
+    }
+    auto const c1 = __rdtsc();
+    tsc_per_sec_ = static_cast<double>(c1 - c0) / (t1 - t0);
+  }
+#endif
+}
+
 }} /* end namespace vt::timing */
@@ -50,8 +50,52 @@
 
 namespace vt { namespace timing {
 
+/*
+ * Wall clock used to time collection elements for the LB statistics
+ */
+enum struct TimerType : int8_t {
+  MPI          = 0,             // MPI_Wtime
+  TSC          = 1,             // rdtsc, calibrated at startup
+  MonotonicRaw = 2              // clock_gettime(CLOCK_MONOTONIC_RAW)
+};
+
 struct Timing {
   static TimeType getCurrentTime();
+
+  /*
+   * Wall time from the clock selected with --vt_lb_timer
+   */
+  static TimeType getLBTime();
+
+  /*
+   * CPU time consumed so far by the calling thread
+   */
+  static TimeType getThreadCPUTime();
+
+  static TimeType getMonotonicRawTime();
+  static TimeType getTSCTime();
+
+  /*
+   * Raw, uncalibrated cycle counter for cheap interval measurement; where
+   * there is no TSC this counts nanoseconds of the raw monotonic clock
+   */
+  static uint64_t getCycles();
+
+  /*
+   * Select the LB timers from the arguments; calibrates the TSC if it is
+   * selected. Called once the arguments are parsed
+   */
+  static void initializeLBTimers();
+
+  static TimerType getLBTimer() { return lb_timer_; }
+  static bool recordCPUTime() { return lb_cpu_time_; }
+  static bool balanceOnCPUTime() { return lb_cpu_load_; }
+
+private:
+  static TimerType lb_timer_;
+  static bool lb_cpu_time_;
+  static bool lb_cpu_load_;
+  static double tsc_per_sec_;
 };
 
 }} /* end namespace vt::timing */
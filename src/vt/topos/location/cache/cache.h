@@ -49,18 +49,37 @@
 #include "vt/topos/location/location_common.h"
 #include "vt/context/context.h"
 
-#include <list>
-#include <tuple>
-#include <unordered_map>
+#include <cstdint>
+#include <vector>
 
 namespace vt { namespace location {
 
+struct LocationCacheStats {
+  uint64_t hits_      = 0;
+  uint64_t misses_    = 0;
+  uint64_t evictions_ = 0;
+};
+
+template <typename KeyT, typename ValueT>
+struct CacheSlot {
+  KeyT key_ = {};
+  ValueT value_ = {};
+  bool occupied_ = false;
+  bool referenced_ = false;
+};
+
+/*
+ * The location cache is an open-addressing hash table (linear probing with
+ * backward-shift deletion) stored in a single flat array of slots. Eviction
+ * follows the CLOCK (second-chance) policy: a hand sweeps the slots, clearing
+ * the reference bit of recently used entries and evicting the first entry it
+ * finds that has not been referenced since the last sweep.
+ */
 template <typename KeyT, typename ValueT>
 struct LocationCache {
-  using LookupType = std::tuple<KeyT, ValueT>;
-  using CacheOrderedType = std::list<LookupType>;
-  using ValueIter = typename CacheOrderedType::iterator;
-  using LookupContainerType = std::unordered_map<KeyT, ValueIter>;
+  using SlotType = CacheSlot<KeyT, ValueT>;
+  using SlotContainerType = std::vector<SlotType>;
+  using StatsType = LocationCacheStats;
 
   explicit LocationCache(LocationSizeType const& in_max_size);
 
@@ -70,20 +89,43 @@ struct LocationCache {
 
   bool exists(KeyT const& key) const;
   LocationSizeType getSize() const;
+  LocationSizeType getNumEntries() const;
   ValueT const& get(KeyT const& key);
+  ValueT const* find(KeyT const& key);
   void remove(KeyT const& key);
   void insert(KeyT const& key, ValueT const& value);
   void printCache() const;
 
- private:
-  // container for quick lookup
-  LookupContainerType lookup_;
+  StatsType const& getStats() const { return stats_; }
+  void resetStats() { stats_ = StatsType{}; }
 
-  // the location records sorted in LRU cache
-  CacheOrderedType cache_;
+private:
+  LocationSizeType homeSlot(KeyT const& key) const;
+  LocationSizeType findSlot(KeyT const& key) const;
+  void eraseSlot(LocationSizeType const slot);
+  void evictOne();
+
+private:
+  static constexpr LocationSizeType const no_slot =
+    static_cast<LocationSizeType>(-1);
+
+  // the flat table of slots, always a power of two in size
+  SlotContainerType slots_;
+
+  // mask applied to the hash to produce a slot index
+  LocationSizeType mask_ = 0;
+
+  // current position of the CLOCK hand
+  LocationSizeType hand_ = 0;
+
+  // the number of occupied slots
+  LocationSizeType num_entries_ = 0;
 
   // the maximum size the cache is allowed to grow
   LocationSizeType max_size_;
+
+  // hit/miss/eviction counters for this cache
+  StatsType stats_;
 };
 
 }}  // end namespace vt::location
@@ -51,36 +51,128 @@
 #include "vt/context/context.h"
 
 #include <cstdint>
-#include <memory>
-#include <list>
-#include <tuple>
+#include <functional>
 #include <utility>
-#include <unordered_map>
 #include <iostream>
 #include <sstream>
 
 namespace vt { namespace location {
 
+template <typename KeyT, typename ValueT>
+/*static*/ constexpr LocationSizeType const LocationCache<KeyT, ValueT>::no_slot;
+
 template <typename KeyT, typename ValueT>
 LocationCache<KeyT, ValueT>::LocationCache(LocationSizeType const& in_max_size)
-  : max_size_(in_max_size)
-{ }
+  : max_size_(in_max_size == 0 ? 1 : in_max_size)
+{
+  // Keep the load factor at or below 3/4 so probe sequences stay short; this
+  // also guarantees that there is always at least one empty slot
+  LocationSizeType table_size = 1;
+  while (table_size * 3 < max_size_ * 4) {
+    table_size <<= 1;
+  }
+  slots_.resize(table_size);
+  mask_ = table_size - 1;
+}
+
+template <typename KeyT, typename ValueT>
+LocationSizeType LocationCache<KeyT, ValueT>::homeSlot(KeyT const& key) const {
+  // std::hash is the identity for integral keys: mix the bits before masking
+  uint64_t h = static_cast<uint64_t>(std::hash<KeyT>{}(key));
+  h ^= h >> 33;
+  h *= 0xff51afd7ed558ccdULL;
+  h ^= h >> 33;
+  return static_cast<LocationSizeType>(h) & mask_;
+}
+
+template <typename KeyT, typename ValueT>
+LocationSizeType LocationCache<KeyT, ValueT>::findSlot(KeyT const& key) const {
+  auto slot = homeSlot(key);
+  while (slots_[slot].occupied_) {
+    if (slots_[slot].key_ == key) {
+      return slot;
+    }
+    slot = (slot + 1) & mask_;
+  }
+  return no_slot;
+}
+
+template <typename KeyT, typename ValueT>
+void LocationCache<KeyT, ValueT>::eraseSlot(LocationSizeType const slot) {
+  auto hole = slot;
+  auto next = (hole + 1) & mask_;
+
+  // Backward-shift deletion: pull subsequent entries in the probe run into the
+  // hole unless that would move them before their home slot
+  while (slots_[next].occupied_) {
+    auto const home = homeSlot(slots_[next].key_);
+    auto const dist_home = (next - home) & mask_;
+    auto const dist_hole = (next - hole) & mask_;
+    if (dist_home >= dist_hole) {
+      slots_[hole] = std::move(slots_[next]);
+      hole = next;
+    }
+    next = (next + 1) & mask_;
+  }
+
+  slots_[hole] = SlotType{};
+  num_entries_--;
+}
+
+template <typename KeyT, typename ValueT>
+void LocationCache<KeyT, ValueT>::evictOne() {
+  vtAssert(num_entries_ > 0, "Cache must have an entry to evict");
+
+  while (true) {
+    auto const cur = hand_;
+    auto& slot = slots_[cur];
+    hand_ = (hand_ + 1) & mask_;
+
+    if (slot.occupied_) {
+      if (slot.referenced_) {
+        // second chance: clear the bit and move on
+        slot.referenced_ = false;
+      } else {
+        debug_print(
+          location, node,
+          "location cache: evict: slot={}, entity={}\n", cur, slot.key_
+        );
+        eraseSlot(cur);
+        stats_.evictions_++;
+        return;
+      }
+    }
+  }
+}
 
 template <typename KeyT, typename ValueT>
 bool LocationCache<KeyT, ValueT>::exists(KeyT const& key) const {
-  auto iter = lookup_.find(key);
-  return iter != lookup_.end();
+  return findSlot(key) != no_slot;
 }
 
 template <typename KeyT, typename ValueT>
 ValueT const& LocationCache<KeyT, ValueT>::get(KeyT const& key) {
-  auto iter = lookup_.find(key);
+  auto const slot = findSlot(key);
 
-  vtAssert(iter != lookup_.end(), "Key must exist in cache");
+  vtAssert(slot != no_slot, "Key must exist in cache");
 
-  cache_.splice(cache_.begin(), cache_, iter->second);
+  slots_[slot].referenced_ = true;
 
-  return std::get<1>(*iter->second);
+  return slots_[slot].value_;
+}
+
+template <typename KeyT, typename ValueT>
+ValueT const* LocationCache<KeyT, ValueT>::find(KeyT const& key) {
+  auto const slot = findSlot(key);
+
+  if (slot == no_slot) {
+    stats_.misses_++;
+    return nullptr;
+  } else {
+    stats_.hits_++;
+    slots_[slot].referenced_ = true;
+    return &slots_[slot].value_;
+  }
 }
 
 template <typename KeyT, typename ValueT>
@@ -88,42 +180,49 @@ LocationSizeType LocationCache<KeyT, ValueT>::getSize() const {
   return max_size_;
 }
 
+template <typename KeyT, typename ValueT>
+LocationSizeType LocationCache<KeyT, ValueT>::getNumEntries() const {
+  return num_entries_;
+}
+
 template <typename KeyT, typename ValueT>
 void LocationCache<KeyT, ValueT>::remove(KeyT const& key) {
-  auto iter = lookup_.find(key);
-  if (iter != lookup_.end()) {
-    cache_.erase(iter->second);
-    lookup_.erase(iter);
+  auto const slot = findSlot(key);
+  if (slot != no_slot) {
+    eraseSlot(slot);
   }
 }
 
 template <typename KeyT, typename ValueT>
 void LocationCache<KeyT, ValueT>::insert(KeyT const& key, ValueT const& value) {
-  auto iter = lookup_.find(key);
+  auto slot = findSlot(key);
 
   debug_print(
     location, node,
     "location cache: insert: found={}, size={}\n",
-    print_bool(iter != lookup_.end()), lookup_.size()
+    print_bool(slot != no_slot), num_entries_
   );
 
-  if (iter == lookup_.end()) {
-    if (lookup_.size() + 1 > max_size_) {
-      auto last_iter = cache_.crbegin();
-      lookup_.erase(std::get<0>(*last_iter));
-      cache_.pop_back();
+  if (slot == no_slot) {
+    if (num_entries_ + 1 > max_size_) {
+      evictOne();
     }
 
-    cache_.push_front(std::make_tuple(key, value));
+    slot = homeSlot(key);
+    while (slots_[slot].occupied_) {
+      slot = (slot + 1) & mask_;
+    }
 
-    lookup_.emplace(
-      std::piecewise_construct,
-      std::forward_as_tuple(key),
-      std::forward_as_tuple(cache_.begin())
-    );
+    // New entries start unreferenced so a burst of one-off lookups cannot
+    // push out entries that are repeatedly hit
+    slots_[slot].key_ = key;
+    slots_[slot].value_ = value;
+    slots_[slot].occupied_ = true;
+    slots_[slot].referenced_ = false;
+    num_entries_++;
   } else {
-    std::get<1>(*iter->second) = value;
-    cache_.splice(cache_.cbegin(), cache_, iter->second);
+    slots_[slot].value_ = value;
+    slots_[slot].referenced_ = true;
   }
 }
 
@@ -131,19 +230,23 @@ template <typename KeyT, typename ValueT>
 void LocationCache<KeyT, ValueT>::printCache() const {
   std::stringstream stream;
 
-  stream << "lookup_.size=" << lookup_.size() << ", "
-         << "cache_.size=" << cache_.size()
+  stream << "num_entries_=" << num_entries_ << ", "
+         << "slots_.size=" << slots_.size() << ", "
+         << "hits=" << stats_.hits_ << ", "
+         << "misses=" << stats_.misses_ << ", "
+         << "evictions=" << stats_.evictions_
          << "\n";
 
-  for (auto&& elm : lookup_) {
-    stream << "\t lookup val: entity=" << std::get<0>(elm) << "\n";
-  }
-
-  for (auto&& elm : cache_) {
-    stream << "\t cache val: "
-           << "entity=" << std::get<0>(elm) << ", "
-           << "val=" << std::get<1>(elm)
-           << "\n";
+  for (LocationSizeType i = 0; i < slots_.size(); i++) {
+    auto const& elm = slots_[i];
+    if (elm.occupied_) {
+      stream << "\t cache val: "
+             << "slot=" << i << ", "
+             << "entity=" << elm.key_ << ", "
+             << "val=" << elm.value_ << ", "
+             << "ref=" << elm.referenced_
+             << "\n";
+    }
   }
 
   debug_print(
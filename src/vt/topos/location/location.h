@@ -82,6 +82,9 @@ struct EntityLocationCoord : LocationCoord {
   using PendingLocLookupsType = std::unordered_map<EntityID, ActionListType>;
   using ActionContainerType = std::unordered_map<LocEventID, PendingType>;
   using LocMsgType = LocationMsg<EntityID>;
+  using LocSubscribersMsgType = LocSubscribersMsg<EntityID>;
+  using SubscriberListType = std::vector<NodeType>;
+  using SubscriberContType = std::unordered_map<EntityID, SubscriberListType>;
 
   template <typename MessageT>
   using EntityMsgType = EntityMsg<EntityID, MessageT>;
@@ -172,8 +175,11 @@ struct EntityLocationCoord : LocationCoord {
     LocEventID const& event_id, EntityID const& id, NodeType const& node
   );
   void printCurrentCache() const;
+  void printCacheStats() const;
+  void printRouteStats() const;
 
   bool isCached(EntityID const& id) const;
+  bool isLocal(EntityID const& id) const;
 
   template <typename MessageT>
   bool useEagerProtocol(MsgSharedPtr<MessageT> msg) const;
@@ -183,6 +189,21 @@ private:
   static void msgHandler(MessageT *msg);
   static void getLocationHandler(LocMsgType *msg);
   static void updateLocation(LocMsgType *msg);
+  static void subscribersHandler(LocSubscribersMsgType *msg);
+
+  /*
+   * Proactive location updates: the node where an entity resides tracks the
+   * nodes that recently sent to it. When the entity migrates, that list follows
+   * it to the new node, which pushes its location to each subscriber once the
+   * entity is registered, so their next message is routed directly.
+   */
+  void trackSender(EntityID const& id, NodeType const& from);
+  void sendSubscribers(EntityID const& id, NodeType const& new_node);
+  void incomingSubscribers(
+    EntityID const& id, NodeType const* nodes, int16_t const num_nodes,
+    NodeType const& from
+  );
+  void pushLocationUpdates(EntityID const& id, SubscriberListType const& nodes);
 
   template <typename MessageT>
   void routeMsgEager(
@@ -218,6 +239,19 @@ private:
 
   // pending lookup requests where this manager is the home node
   PendingLocLookupsType pending_lookups_;
+
+  // nodes that recently sent to locally registered entities
+  SubscriberContType subscribers_;
+
+  // subscribers that arrived before the migrated entity was registered
+  SubscriberContType pending_subscribers_;
+
+  // counters for messages routed by this manager
+  uint64_t delivered_msgs_ = 0;
+  uint64_t delivered_hops_ = 0;
+  uint64_t delivered_forwarded_ = 0;
+  uint64_t forwarded_msgs_ = 0;
+  uint64_t updates_pushed_ = 0;
 };
 
 }}  // end namespace vt::location
@@ -54,7 +54,9 @@
 #include "vt/context/context.h"
 #include "vt/messaging/active.h"
 #include "vt/runnable/general.h"
+#include "vt/configs/arguments/args.h"
 
+#include <algorithm>
 #include <cstdint>
 #include <memory>
 #include <unordered_map>
@@ -74,7 +76,12 @@ EntityLocationCoord<EntityID>::EntityLocationCoord(
 
 template <typename EntityID>
 EntityLocationCoord<EntityID>::EntityLocationCoord(LocInstType const identifier)
-  : this_inst(identifier), recs_(default_max_cache_size)
+  : this_inst(identifier),
+    recs_(
+      arguments::ArgConfig::vt_loc_cache_size > 0 ?
+      static_cast<LocationSizeType>(arguments::ArgConfig::vt_loc_cache_size) :
+      default_max_cache_size
+    )
 {
   debug_print(
     location, node,
@@ -89,6 +96,50 @@ EntityLocationCoord<EntityID>::EntityLocationCoord(LocInstType const identifier)
 
 template <typename EntityID>
 /*virtual*/ EntityLocationCoord<EntityID>::~EntityLocationCoord() {
+  if (arguments::ArgConfig::vt_loc_cache_stats) {
+    printCacheStats();
+  }
+  if (arguments::ArgConfig::vt_loc_route_stats) {
+    printRouteStats();
+  }
+}
+
+template <typename EntityID>
+void EntityLocationCoord<EntityID>::printCacheStats() const {
+  auto const& stats = recs_.getStats();
+  auto const lookups = stats.hits_ + stats.misses_;
+
+  if (lookups == 0) {
+    return;
+  }
+
+  vt_print(
+    location,
+    "EntityLocationCoord: cache stats: inst={}, capacity={}, entries={}, "
+    "hits={}, misses={}, evictions={}, hit_rate={:.2f}%\n",
+    this_inst, recs_.getSize(), recs_.getNumEntries(), stats.hits_,
+    stats.misses_, stats.evictions_,
+    100.0 * static_cast<double>(stats.hits_) / static_cast<double>(lookups)
+  );
+}
+
+template <typename EntityID>
+void EntityLocationCoord<EntityID>::printRouteStats() const {
+  if (delivered_msgs_ == 0 and forwarded_msgs_ == 0) {
+    return;
+  }
+
+  auto const avg_hops = delivered_msgs_ == 0 ? 0.0 :
+    static_cast<double>(delivered_hops_) / static_cast<double>(delivered_msgs_);
+
+  vt_print(
+    location,
+    "EntityLocationCoord: route stats: inst={}, delivered={}, "
+    "delivered_after_forward={}, avg_hops={:.2f}, forwarded={}, "
+    "updates_pushed={}\n",
+    this_inst, delivered_msgs_, delivered_forwarded_, avg_hops,
+    forwarded_msgs_, updates_pushed_
+  );
 }
 
 template <typename EntityID>
@@ -115,6 +166,18 @@ void EntityLocationCoord<EntityID>::registerEntity(
 
   recs_.insert(id, LocRecType{id, eLocState::Local, this_node});
 
+  if (migrated) {
+    // push the new location to senders that followed the entity here
+    auto subs_iter = pending_subscribers_.find(id);
+    if (subs_iter != pending_subscribers_.end()) {
+      auto nodes = std::move(subs_iter->second);
+      pending_subscribers_.erase(subs_iter);
+      incomingSubscribers(
+        id, nodes.data(), static_cast<int16_t>(nodes.size()), this_node
+      );
+    }
+  }
+
   if (msg_action != nullptr) {
     // vtAssert(
     //   local_registered_msg_han_.find(id) == local_registered_msg_han_.end(),
@@ -198,6 +261,9 @@ void EntityLocationCoord<EntityID>::unregisterEntity(EntityID const& id) {
     recs_.remove(id);
   }
 
+  subscribers_.erase(id);
+  pending_subscribers_.erase(id);
+
   auto reg_msg_han_iter = local_registered_msg_han_.find(id);
   if (reg_msg_han_iter != local_registered_msg_han_.end()) {
     local_registered_msg_han_.erase(reg_msg_han_iter);
@@ -221,6 +287,155 @@ void EntityLocationCoord<EntityID>::entityMigrated(
   }
 
   recs_.insert(id, LocRecType{id, eLocState::Remote, new_node});
+
+  sendSubscribers(id, new_node);
+}
+
+template <typename EntityID>
+void EntityLocationCoord<EntityID>::trackSender(
+  EntityID const& id, NodeType const& from
+) {
+  auto const max_subs = std::min(
+    static_cast<int32_t>(max_loc_subscribers),
+    arguments::ArgConfig::vt_loc_max_subscribers
+  );
+
+  if (
+    max_subs <= 0 or from == uninitialized_destination or
+    from == theContext()->getNode()
+  ) {
+    return;
+  }
+
+  auto& subs = subscribers_[id];
+  auto iter = std::find(subs.begin(), subs.end(), from);
+  if (iter != subs.end()) {
+    // move to the back so the list stays ordered by most recent send
+    subs.erase(iter);
+  } else if (subs.size() >= static_cast<std::size_t>(max_subs)) {
+    subs.erase(subs.begin());
+  }
+  subs.push_back(from);
+}
+
+template <typename EntityID>
+void EntityLocationCoord<EntityID>::sendSubscribers(
+  EntityID const& id, NodeType const& new_node
+) {
+  auto subs_iter = subscribers_.find(id);
+  if (subs_iter == subscribers_.end()) {
+    return;
+  }
+
+  auto const& subs = subs_iter->second;
+
+  debug_print(
+    location, node,
+    "EntityLocationCoord: sendSubscribers: id={}, new_node={}, num={}\n",
+    id, new_node, subs.size()
+  );
+
+  bool const has_subs = std::any_of(
+    subs.begin(), subs.end(), [&](NodeType sub) { return sub != new_node; }
+  );
+
+  if (has_subs) {
+    auto msg = makeSharedMessage<LocSubscribersMsgType>(this_inst, id);
+    for (auto&& sub : subs) {
+      if (sub != new_node and msg->num_subscribers < max_loc_subscribers) {
+        msg->subscribers[msg->num_subscribers++] = sub;
+      }
+    }
+    theMsg()->sendMsg<LocSubscribersMsgType, subscribersHandler>(new_node, msg);
+  }
+
+  subscribers_.erase(subs_iter);
+}
+
+template <typename EntityID>
+void EntityLocationCoord<EntityID>::incomingSubscribers(
+  EntityID const& id, NodeType const* nodes, int16_t const num_nodes,
+  NodeType const& from
+) {
+  auto reg_iter = local_registered_.find(id);
+
+  if (reg_iter == local_registered_.end()) {
+    // A record pointing anywhere but back at the sender means the entity has
+    // already been here and moved on: follow it instead of waiting
+    auto const rec = recs_.find(id);
+    if (rec != nullptr and rec->isRemote() and rec->getRemoteNode() != from) {
+      auto const to = rec->getRemoteNode();
+
+      debug_print(
+        location, node,
+        "EntityLocationCoord: incomingSubscribers: forward id={}, to={}\n",
+        id, to
+      );
+
+      auto msg = makeSharedMessage<LocSubscribersMsgType>(this_inst, id);
+      for (int16_t i = 0; i < num_nodes; i++) {
+        if (nodes[i] != to) {
+          msg->subscribers[msg->num_subscribers++] = nodes[i];
+        }
+      }
+      if (msg->num_subscribers > 0) {
+        theMsg()->sendMsg<LocSubscribersMsgType, subscribersHandler>(to, msg);
+      }
+      return;
+    }
+
+    // The entity has not arrived yet: hold on until it is registered. The
+    // updates are only a shortcut, so past the bound they are dropped
+    auto pending_iter = pending_subscribers_.find(id);
+    if (pending_iter == pending_subscribers_.end()) {
+      if (pending_subscribers_.size() >= max_pending_loc_subscribers) {
+        return;
+      }
+      pending_iter = pending_subscribers_.emplace(
+        id, SubscriberListType{}
+      ).first;
+    }
+    auto& pending = pending_iter->second;
+    pending.insert(pending.end(), nodes, nodes + num_nodes);
+    if (pending.size() > static_cast<std::size_t>(max_loc_subscribers)) {
+      pending.erase(pending.begin(), pending.end() - max_loc_subscribers);
+    }
+    return;
+  }
+
+  SubscriberListType to_update;
+  for (int16_t i = 0; i < num_nodes; i++) {
+    to_update.push_back(nodes[i]);
+    trackSender(id, nodes[i]);
+  }
+
+  pushLocationUpdates(id, to_update);
+}
+
+template <typename EntityID>
+void EntityLocationCoord<EntityID>::pushLocationUpdates(
+  EntityID const& id, SubscriberListType const& nodes
+) {
+  auto const& this_node = theContext()->getNode();
+
+  for (auto&& node : nodes) {
+    if (node == this_node) {
+      continue;
+    }
+
+    debug_print(
+      location, node,
+      "EntityLocationCoord: pushLocationUpdates: id={}, to={}\n", id, node
+    );
+
+    auto msg = makeSharedMessage<LocMsgType>(
+      this_inst, id, no_location_event_id, uninitialized_destination,
+      uninitialized_destination
+    );
+    msg->setResolvedNode(this_node);
+    theMsg()->sendMsg<LocMsgType, updateLocation>(node, msg);
+    updates_pushed_++;
+  }
 }
 
 template <typename EntityID>
@@ -237,6 +452,11 @@ bool EntityLocationCoord<EntityID>::isCached(EntityID const& id) const {
   return recs_.exists(id);
 }
 
+template <typename EntityID>
+bool EntityLocationCoord<EntityID>::isLocal(EntityID const& id) const {
+  return local_registered_.find(id) != local_registered_.end();
+}
+
 template <typename EntityID>
 template <typename MessageT>
 bool EntityLocationCoord<EntityID>::useEagerProtocol(MsgSharedPtr<MessageT> msg) const {
@@ -293,21 +513,19 @@ void EntityLocationCoord<EntityID>::routeMsgEager(
     recs_.insert(id, LocRecType{id, eLocState::Local, this_node});
     route_to_node = this_node;
   } else {
-    bool const& rec_exists = recs_.exists(id);
+    auto const rec = recs_.find(id);
 
-    if (not rec_exists) {
+    if (rec == nullptr) {
       if (home_node != this_node) {
         route_to_node = home_node;
       } else {
         route_to_node = this_node;
       }
     } else {
-      auto const& rec = recs_.get(id);
-
-      if (rec.isLocal()) {
+      if (rec->isLocal()) {
         route_to_node = this_node;
-      } else if (rec.isRemote()) {
-        route_to_node = rec.getRemoteNode();
+      } else if (rec->isRemote()) {
+        route_to_node = rec->getRemoteNode();
       }
     }
   }
@@ -345,7 +563,8 @@ void EntityLocationCoord<EntityID>::getLocation(
     action(this_node);
     return;
   } else {
-    bool const& rec_exists = recs_.exists(id);
+    auto const rec = recs_.find(id);
+    bool const rec_exists = rec != nullptr;
 
     debug_print(
       location, node,
@@ -372,18 +591,18 @@ void EntityLocationCoord<EntityID>::getLocation(
         insertPendingEntityAction(id, action);
       }
     } else {
-      auto const& rec = recs_.get(id);
-
-      if (rec.isLocal()) {
+      if (rec->isLocal()) {
         vtAssert(0, "Should be registered if this is the case!");
         action(this_node);
-      } else if (rec.isRemote()) {
+      } else if (rec->isRemote()) {
         debug_print(
           location, node,
           "EntityLocationCoord: getLocation: entity is remote\n"
         );
 
-        action(rec.getRemoteNode());
+        // copy out the node before the action may mutate the cache
+        auto const remote_node = rec->getRemoteNode();
+        action(remote_node);
       }
     }
   }
@@ -408,6 +627,11 @@ void EntityLocationCoord<EntityID>::routeMsgNode(
   );
 
   if (to_node != this_node) {
+    if (msg->getLocFromNode() != this_node) {
+      // this node is an intermediate hop for a stale or home-routed message
+      forwarded_msgs_++;
+    }
+    msg->incLocHops();
     // set the instance on the message to deliver to the correct manager
     msg->setLocInst(this_inst);
     // send to the node discovered by the location manager
@@ -426,6 +650,13 @@ void EntityLocationCoord<EntityID>::routeMsgNode(
     auto trigger_msg_handler_action = [=](EntityID const& hid) {
       bool const& has_handler = msg->hasHandler();
       auto const& from = msg->getLocFromNode();
+      auto const hops = msg->getLocHops();
+      delivered_msgs_++;
+      delivered_hops_ += hops;
+      if (hops > 1) {
+        delivered_forwarded_++;
+      }
+      trackSender(hid, from);
       if (has_handler) {
         auto const& handler = msg->getHandler();
         auto active_fn = auto_registry::getAutoHandler(handler);
@@ -560,6 +791,10 @@ void EntityLocationCoord<EntityID>::routeMsg(
   msg->setLocFromNode(from);
   msg->setSerialize(serialize);
 
+  if (from_node == uninitialized_destination) {
+    msg->setLocHops(0);
+  }
+
   auto const msg_size = sizeof(*msg);
   bool const use_eager = useEagerProtocol(msg);
   auto const epoch = theMsg()->getEpochContextMsg(msg);
@@ -649,6 +884,8 @@ LocInstType EntityLocationCoord<EntityID>::getInst() const {
 template <typename EntityID>
 template <typename MessageT>
 /*static*/ void EntityLocationCoord<EntityID>::msgHandler(MessageT *raw_msg) {
+  theMsg()->setCurrentCategory(messaging::MsgCategory::Location);
+
   auto msg = promoteMsg(raw_msg);
   auto const& entity_id = msg->getEntity();
   auto const& home_node = msg->getHomeNode();
@@ -680,6 +917,8 @@ template <typename EntityID>
 /*static*/ void EntityLocationCoord<EntityID>::getLocationHandler(
   LocMsgType* raw_msg
 ) {
+  theMsg()->setCurrentCategory(messaging::MsgCategory::Location);
+
   auto msg = promoteMsg(raw_msg);
   auto const& event_id = msg->loc_event;
   auto const& inst = msg->loc_man_inst;
@@ -724,10 +963,43 @@ template <typename EntityID>
   );
 }
 
+template <typename EntityID>
+/*static*/ void EntityLocationCoord<EntityID>::subscribersHandler(
+  LocSubscribersMsgType *raw_msg
+) {
+  theMsg()->setCurrentCategory(messaging::MsgCategory::Location);
+
+  auto msg = promoteMsg(raw_msg);
+  auto const& inst = msg->loc_man_inst;
+  auto const& entity = msg->entity;
+  auto const epoch = theMsg()->getEpochContextMsg(msg);
+  auto const from = theMsg()->getFromNodeCurrentHandler();
+
+  debug_print(
+    location, node,
+    "subscribersHandler: id={}, num={}, from={}, epoch={:x}\n",
+    entity, msg->num_subscribers, from, epoch
+  );
+
+  theTerm()->produce(epoch);
+  LocationManager::applyInstance<EntityLocationCoord<EntityID>>(
+    inst, [=](EntityLocationCoord<EntityID>* loc) {
+      theMsg()->pushEpoch(epoch);
+      loc->incomingSubscribers(
+        entity, &msg->subscribers[0], msg->num_subscribers, from
+      );
+      theMsg()->popEpoch(epoch);
+      theTerm()->consume(epoch);
+    }
+  );
+}
+
 template <typename EntityID>
 /*static*/ void EntityLocationCoord<EntityID>::updateLocation(
   LocMsgType *raw_msg
 ) {
+  theMsg()->setCurrentCategory(messaging::MsgCategory::Location);
+
   auto msg = promoteMsg(raw_msg);
   auto const& event_id = msg->loc_event;
   auto const& inst = msg->loc_man_inst;
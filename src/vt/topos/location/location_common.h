@@ -69,6 +69,12 @@ static constexpr LocationSizeType const default_max_cache_size = 4096;
 
 static constexpr ByteType const small_msg_max_size = 256;
 
+// upper bound on recent senders tracked per entity for proactive updates
+static constexpr int16_t const max_loc_subscribers = 32;
+
+// upper bound on entities whose subscribers wait here for the entity to arrive
+static constexpr std::size_t const max_pending_loc_subscribers = 4096;
+
 using LocInstType = int64_t;
 
 static constexpr LocInstType const no_loc_inst = -1;
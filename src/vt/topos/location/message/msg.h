@@ -73,6 +73,23 @@ struct LocationMsg : vt::Message {
   }
 };
 
+/*
+ * Carries the set of nodes that recently sent messages to an entity from the
+ * node it migrated away from to the node it migrated to, so the new node can
+ * push its location to them once the entity arrives.
+ */
+template <typename EntityID>
+struct LocSubscribersMsg : vt::Message {
+  LocInstType loc_man_inst = 0;
+  EntityID entity{};
+  int16_t num_subscribers = 0;
+  NodeType subscribers[max_loc_subscribers] = {};
+
+  LocSubscribersMsg(LocInstType const& in_loc_man_inst, EntityID const& in_entity)
+    : loc_man_inst(in_loc_man_inst), entity(in_entity)
+  { }
+};
+
 template <typename EntityID, typename ActiveMessageT>
 struct EntityMsg : ActiveMessageT {
   // By default, the `EntityMsg' is byte copyable for serialization
@@ -96,6 +113,9 @@ struct EntityMsg : ActiveMessageT {
   HandlerType getHandler() const { return handler_; }
   void setSerialize(bool const serialize) { serialize_ = serialize; }
   bool getSerialize() const { return serialize_; }
+  void setLocHops(int16_t const hops) { hops_ = hops; }
+  void incLocHops() { hops_++; }
+  int16_t getLocHops() const { return hops_; }
 
   // Explicitly write parent serialize so derived classes can have non-byte
   // serializers
@@ -113,6 +133,7 @@ struct EntityMsg : ActiveMessageT {
     s | loc_man_inst_;
     s | handler_;
     s | serialize_;
+    s | hops_;
   }
 
 private:
@@ -122,6 +143,7 @@ private:
   LocInstType loc_man_inst_ = no_loc_inst;
   HandlerType handler_ = uninitialized_handler;
   bool serialize_ = false;
+  int16_t hops_ = 0;
 };
 
 }}  // end namespace vt::location
@@ -56,6 +56,7 @@ template <typename EntityID>
 struct LocRecord {
   using LocStateType = eLocState;
 
+  LocRecord() = default;
   LocRecord(
     EntityID const& in_id, LocStateType const& in_state,
     NodeType const& in_node
@@ -71,7 +72,7 @@ struct LocRecord {
   friend std::ostream& operator<<(std::ostream& os, LocRecord<U> const& rec);
 
 private:
-  EntityID id_;
+  EntityID id_ = {};
   LocStateType state_ = eLocState::Invalid;
   NodeType cur_node_ = uninitialized_destination;
 };
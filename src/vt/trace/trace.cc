@@ -52,6 +52,7 @@
 #include <sys/stat.h>
 #include <unistd.h>
 #include <inttypes.h>
+#include <fcntl.h>
 
 namespace vt { namespace trace {
 
@@ -75,11 +76,15 @@ Trace::Trace() {
 }
 
 void Trace::initialize() {
-  traces_.reserve(trace_reserve_count);
-
   theSched()->registerTrigger(
     sched::SchedulerEvent::BeginIdle, traceBeginIdleTrigger
   );
+
+  filter_.setup(theContext()->getNode());
+}
+
+void Trace::setPhase(PhaseType const phase) {
+  filter_.setPhase(phase);
 }
 
 bool Trace::inIdleEvent() const {
@@ -124,6 +129,29 @@ void Trace::setupNames(
     full_trace_name = full_dir_name + "/" + trace_name;
     full_sts_name   = full_dir_name + "/" + prog_name + ".sts";
   }
+
+  // The binary trace is converted to "<name>.log.gz" by vt_trace_convert
+  std::string const log_ext = ".log.gz";
+  if (ArgType::vt_trace_binary) {
+    auto const len = full_trace_name.size();
+    if (len >= log_ext.size() and
+        full_trace_name.compare(len - log_ext.size(), log_ext.size(), log_ext) == 0) {
+      full_trace_name.resize(len - log_ext.size());
+    }
+    full_trace_name += ".vtb";
+  }
+
+  // Record the sampling weight so sampled profiles can be scaled back up; this
+  // bypasses the phase filter, which would otherwise drop it
+  if (filter_.getSampleWeight() > 1 and checkEnabled()) {
+    auto const type = TraceConstantsType::UserSuppliedNote;
+    auto const note =
+      fmt::format("vt_trace_sample={}", filter_.getSampleWeight());
+
+    TraceRecord rec{timeToNs(start_time_), type};
+    rec.aux_ = strings_.intern(note);
+    traces_.append(rec);
+  }
 }
 
 /*virtual*/ Trace::~Trace() {
@@ -137,15 +165,16 @@ void Trace::addUserNote(std::string const& note) {
     note
   );
 
+  if (not enabled_ || not checkEnabled()) {
+    return;
+  }
+
   auto const type = TraceConstantsType::UserSuppliedNote;
   auto const time = getCurrentTime();
 
-  LogPtrType log = new LogType(time, type);
-  logEvent(log);
-
-  editLastEntry([note](LogPtrType entry) {
-    entry->setUserNote(note);
-  });
+  TraceRecord rec{timeToNs(time), type};
+  rec.aux_ = strings_.intern(note);
+  logEvent(rec);
 }
 
 void Trace::addUserData(int32_t data) {
@@ -158,12 +187,9 @@ void Trace::addUserData(int32_t data) {
   auto const type = TraceConstantsType::UserSupplied;
   auto const time = getCurrentTime();
 
-  LogPtrType log = new LogType(time, type);
-  logEvent(log);
-
-  editLastEntry([data](LogPtrType entry) {
-    entry->setUserData(data);
-  });
+  TraceRecord rec{timeToNs(time), type};
+  rec.data_ = static_cast<uint64_t>(static_cast<uint32_t>(data));
+  logEvent(rec);
 }
 
 void Trace::addUserBracketedNote(
@@ -176,9 +202,16 @@ void Trace::addUserBracketedNote(
     begin, end, note, event
   );
 
+  if (not enabled_ || not checkEnabled()) {
+    return;
+  }
+
   auto const type = TraceConstantsType::UserSuppliedBracketedNote;
-  LogPtrType log = new LogType(begin, end, type, note, event);
-  logEvent(log);
+  TraceRecord rec{timeToNs(begin), type};
+  rec.data_ = static_cast<uint64_t>(timeToNs(end));
+  rec.aux_ = strings_.intern(note);
+  rec.event_ = event;
+  logEvent(rec);
 }
 
 UserEventIDType Trace::registerUserEventColl(std::string const& name) {
@@ -215,9 +248,11 @@ void Trace::addUserEvent(UserEventIDType event) {
   auto const type = TraceConstantsType::UserEvent;
   auto const time = getCurrentTime();
 
-  LogPtrType log = new LogType(time, type, event, true);
-  log->node = theContext()->getNode();
-  logEvent(log);
+  TraceRecord rec{timeToNs(time), type};
+  rec.data_ = static_cast<uint64_t>(event);
+  rec.flags_ = TraceRecord::user_start_flag;
+  rec.node_ = theContext()->getNode();
+  logEvent(rec);
 }
 
 void Trace::addUserEventManual(UserSpecEventIDType event) {
@@ -240,13 +275,16 @@ void Trace::addUserEventBracketed(UserEventIDType event, double begin, double en
 
   auto const type = TraceConstantsType::UserEventPair;
 
-  LogPtrType log_b = new LogType(begin, type, event, true);
-  log_b->node = theContext()->getNode();
-  logEvent(log_b);
+  TraceRecord rec_b{timeToNs(begin), type};
+  rec_b.data_ = static_cast<uint64_t>(event);
+  rec_b.flags_ = TraceRecord::user_start_flag;
+  rec_b.node_ = theContext()->getNode();
+  logEvent(rec_b);
 
-  LogPtrType log_e = new LogType(end, type, event, false);
-  log_e->node = theContext()->getNode();
-  logEvent(log_e);
+  TraceRecord rec_e{timeToNs(end), type};
+  rec_e.data_ = static_cast<uint64_t>(event);
+  rec_e.node_ = theContext()->getNode();
+  logEvent(rec_e);
 }
 
 void Trace::addUserEventBracketedBegin(UserEventIDType event) {
@@ -259,9 +297,11 @@ void Trace::addUserEventBracketedBegin(UserEventIDType event) {
   auto const type = TraceConstantsType::BeginUserEventPair;
   auto const time = getCurrentTime();
 
-  LogPtrType log = new LogType(time, type, event, true);
-  log->node = theContext()->getNode();
-  logEvent(log);
+  TraceRecord rec{timeToNs(time), type};
+  rec.data_ = static_cast<uint64_t>(event);
+  rec.flags_ = TraceRecord::user_start_flag;
+  rec.node_ = theContext()->getNode();
+  logEvent(rec);
 }
 
 void Trace::addUserEventBracketedEnd(UserEventIDType event) {
@@ -274,9 +314,10 @@ void Trace::addUserEventBracketedEnd(UserEventIDType event) {
   auto const type = TraceConstantsType::EndUserEventPair;
   auto const time = getCurrentTime();
 
-  LogPtrType log = new LogType(time, type, event, false);
-  log->node = theContext()->getNode();
-  logEvent(log);
+  TraceRecord rec{timeToNs(time), type};
+  rec.data_ = static_cast<uint64_t>(event);
+  rec.node_ = theContext()->getNode();
+  logEvent(rec);
 }
 
 void Trace::addUserEventBracketedManualBegin(UserSpecEventIDType event) {
@@ -302,6 +343,16 @@ void Trace::addUserEventBracketedManual(
   addUserEventBracketed(id, begin, end);
 }
 
+TraceIndexType Trace::internIndex(
+  uint64_t const idx1, uint64_t const idx2, uint64_t const idx3,
+  uint64_t const idx4
+) {
+  if (idx1 == 0 and idx2 == 0 and idx3 == 0 and idx4 == 0) {
+    return no_trace_index;
+  }
+  return indices_.intern(TraceIndexTupleType{{idx1, idx2, idx3, idx4}});
+}
+
 void Trace::beginProcessing(
   TraceEntryIDType const ep, TraceMsgLenType const len,
   TraceEventIDType const event, NodeType const from_node, double const time,
@@ -309,7 +360,6 @@ void Trace::beginProcessing(
   uint64_t const idx4
 ) {
   auto const type = TraceConstantsType::BeginProcessing;
-  LogPtrType log = new LogType(time, ep, type);
 
   debug_print(
     trace, node,
@@ -317,15 +367,32 @@ void Trace::beginProcessing(
     ep, event, time, from_node
   );
 
-  log->node = from_node;
-  log->msg_len = len;
-  log->event = event;
-  log->idx1 = idx1;
-  log->idx2 = idx2;
-  log->idx3 = idx3;
-  log->idx4 = idx4;
+  // The decision is kept until the matching end, so filtered executions never
+  // leave a dangling begin or end (even if the phase changes in between)
+  bool const traced =
+    enabled_ and checkEnabled() and filter_.phaseTraced() and
+    filter_.executionTraced(ep);
+  processing_traced_.push_back(traced);
+
+  if (not traced) {
+    // The scheduler is busy even if this handler is not recorded
+    if (idle_begun_ and enabled_ and checkEnabled()) {
+      endIdle(time);
+    }
+    return;
+  }
 
-  logEvent(log);
+  TraceRecord rec{timeToNs(time), type};
+  rec.data_ = ep;
+  rec.node_ = from_node;
+  rec.setMsgLen(len);
+  rec.event_ = event;
+  rec.index_ = internIndex(idx1, idx2, idx3, idx4);
+  if (filter_.getSampleWeight() > 1) {
+    rec.flags_ |= TraceRecord::sampled_flag;
+  }
+
+  logEvent(rec);
 }
 
 void Trace::endProcessing(
@@ -335,7 +402,6 @@ void Trace::endProcessing(
   uint64_t const idx4
 ) {
   auto const type = TraceConstantsType::EndProcessing;
-  LogPtrType log = new LogType(time, ep, type);
 
   debug_print(
     trace, node,
@@ -343,43 +409,61 @@ void Trace::endProcessing(
     ep, event, time, from_node
   );
 
-  log->node = from_node;
-  log->msg_len = len;
-  log->event = event;
-  log->idx1 = idx1;
-  log->idx2 = idx2;
-  log->idx3 = idx3;
-  log->idx4 = idx4;
+  bool traced = true;
+  if (not processing_traced_.empty()) {
+    traced = processing_traced_.back();
+    processing_traced_.pop_back();
+  }
+
+  if (not traced or not enabled_ or not checkEnabled()) {
+    return;
+  }
+
+  TraceRecord rec{timeToNs(time), type};
+  rec.data_ = ep;
+  rec.node_ = from_node;
+  rec.setMsgLen(len);
+  rec.event_ = event;
+  rec.index_ = internIndex(idx1, idx2, idx3, idx4);
+  if (filter_.getSampleWeight() > 1) {
+    rec.flags_ |= TraceRecord::sampled_flag;
+  }
 
-  logEvent(log);
+  logEvent(rec);
 }
 
 void Trace::beginIdle(double const time) {
   auto const type = TraceConstantsType::BeginIdle;
-  LogPtrType log = new LogType(time, no_trace_entry_id, type);
 
   debug_print(
     trace, node, "begin_idle: time={}\n", time
   );
 
-  log->node = theContext()->getNode();
+  if (not filter_.phaseTraced()) {
+    return;
+  }
+
+  TraceRecord rec{timeToNs(time), type};
+  rec.data_ = no_trace_entry_id;
+  rec.node_ = theContext()->getNode();
 
-  logEvent(log);
+  logEvent(rec);
 
   idle_begun_ = true;
 }
 
 void Trace::endIdle(double const time) {
   auto const type = TraceConstantsType::EndIdle;
-  LogPtrType log = new LogType(time, no_trace_entry_id, type);
 
   debug_print(
     trace, node, "end_idle: time={}\n", time
   );
 
-  log->node = theContext()->getNode();
+  TraceRecord rec{timeToNs(time), type};
+  rec.data_ = no_trace_entry_id;
+  rec.node_ = theContext()->getNode();
 
-  logEvent(log);
+  logEvent(rec);
 
   idle_begun_ = false;
 }
@@ -388,24 +472,34 @@ TraceEventIDType Trace::messageCreation(
   TraceEntryIDType const ep, TraceMsgLenType const len, double const time
 ) {
   auto const type = TraceConstantsType::Creation;
-  LogPtrType log = new LogType(time, ep, type);
 
-  log->node = theContext()->getNode();
-  log->msg_len = len;
+  if (not filter_.entryTraced(ep)) {
+    return no_trace_event;
+  }
+
+  TraceRecord rec{timeToNs(time), type};
+  rec.data_ = ep;
+  rec.node_ = theContext()->getNode();
+  rec.setMsgLen(len);
 
-  return logEvent(log);
+  return logEvent(rec);
 }
 
 TraceEventIDType Trace::messageCreationBcast(
   TraceEntryIDType const ep, TraceMsgLenType const len, double const time
 ) {
   auto const type = TraceConstantsType::CreationBcast;
-  LogPtrType log = new LogType(time, ep, type);
 
-  log->node = theContext()->getNode();
-  log->msg_len = len;
+  if (not filter_.entryTraced(ep)) {
+    return no_trace_event;
+  }
+
+  TraceRecord rec{timeToNs(time), type};
+  rec.data_ = ep;
+  rec.node_ = theContext()->getNode();
+  rec.setMsgLen(len);
 
-  return logEvent(log);
+  return logEvent(rec);
 }
 
 TraceEventIDType Trace::messageRecv(
@@ -413,59 +507,57 @@ TraceEventIDType Trace::messageRecv(
   NodeType const from_node, double const time
 ) {
   auto const type = TraceConstantsType::MessageRecv;
-  LogPtrType log = new LogType(time, ep, type);
 
-  log->node = from_node;
+  if (not filter_.entryTraced(ep)) {
+    return no_trace_event;
+  }
+
+  TraceRecord rec{timeToNs(time), type};
+  rec.data_ = ep;
+  rec.node_ = from_node;
 
-  return logEvent(log);
+  return logEvent(rec);
 }
 
-void Trace::editLastEntry(std::function<void(LogPtrType)> fn) {
+TraceEventIDType Trace::logEvent(TraceRecord rec) {
   if (not enabled_ || not checkEnabled()) {
-    return;
+    return 0;
   }
 
-  auto const trace_cont_size = traces_.size();
-  if (trace_cont_size > 0) {
-    fn(traces_.at(trace_cont_size - 1));
+  // Processing events are filtered at their begin; an idle event that began
+  // inside the traced phases is always closed
+  if (not filter_.phaseTraced() and
+      rec.type() != TraceConstantsType::BeginProcessing and
+      rec.type() != TraceConstantsType::EndProcessing and
+      rec.type() != TraceConstantsType::EndIdle) {
+    return 0;
   }
-}
 
-TraceEventIDType Trace::logEvent(LogPtrType log) {
-  if (not enabled_ || not checkEnabled()) {
-    return 0;
+  if (ArgType::vt_trace_stream and
+      static_cast<int64_t>(traces_.size()) >= trace_stream_chunk_count) {
+    flushChunk();
   }
 
   // close any idle event as soon as we encounter any other type of event
   if (idle_begun_ and
-      log->type != TraceConstantsType::BeginIdle and
-      log->type != TraceConstantsType::EndIdle) {
+      rec.type() != TraceConstantsType::BeginIdle and
+      rec.type() != TraceConstantsType::EndIdle) {
     endIdle();
   }
 
   auto grouped_begin = [&]() -> TraceEventIDType {
     if (not open_events_.empty()) {
-      traces_.push_back(
-        new LogType(
-          log->time,
-          open_events_.top()->ep,
-          TraceConstantsType::EndProcessing,
-          open_events_.top()->event,
-          open_events_.top()->msg_len,
-          open_events_.top()->node,
-          open_events_.top()->idx1,
-          open_events_.top()->idx2,
-          open_events_.top()->idx3,
-          open_events_.top()->idx4
-        )
-      );
+      TraceRecord end = open_events_.top();
+      end.time_ = rec.time_;
+      end.type_ = static_cast<int8_t>(TraceConstantsType::EndProcessing);
+      traces_.append(end);
     }
 
     // push on open stack.
-    open_events_.push(log);
-    traces_.push_back(log);
+    open_events_.push(rec);
+    traces_.append(rec);
 
-    return log->event;
+    return rec.event_;
   };
 
   auto grouped_end = [&]() -> TraceEventIDType {
@@ -474,69 +566,52 @@ TraceEventIDType Trace::logEvent(LogPtrType log) {
     );
 
     vtAssert(
-      open_events_.top()->ep == log->ep and
-      open_events_.top()->type == TraceConstantsType::BeginProcessing,
+      open_events_.top().ep() == rec.ep() and
+      open_events_.top().type() == TraceConstantsType::BeginProcessing,
       "Top event should be correct type and event"
     );
 
     // match event with the one that this ends
-    log->event = open_events_.top()->event;
+    rec.event_ = open_events_.top().event_;
 
     // set up begin/end links
     open_events_.pop();
 
-    traces_.push_back(log);
+    traces_.append(rec);
 
     if (not open_events_.empty()) {
-      traces_.push_back(
-        new LogType(
-          log->time,
-          open_events_.top()->ep,
-          TraceConstantsType::BeginProcessing,
-          open_events_.top()->event,
-          open_events_.top()->msg_len,
-          open_events_.top()->node,
-          open_events_.top()->idx1,
-          open_events_.top()->idx2,
-          open_events_.top()->idx3,
-          open_events_.top()->idx4
-        )
-      );
+      TraceRecord begin = open_events_.top();
+      begin.time_ = rec.time_;
+      traces_.append(begin);
     }
 
-    return log->event;
+    return rec.event_;
   };
 
   auto basic_new_event_create = [&]() -> TraceEventIDType {
-    traces_.push_back(log);
-
-    log->event = cur_event_++;
-
-    return log->event;
+    rec.event_ = cur_event_++;
+    traces_.append(rec);
+    return rec.event_;
   };
 
   auto basic_no_event_create = [&]() -> TraceEventIDType {
-    traces_.push_back(log);
-
-    log->event = no_trace_event;
-
-    return log->event;
+    rec.event_ = no_trace_event;
+    traces_.append(rec);
+    return rec.event_;
   };
 
   auto basic_cur_event = [&]() -> TraceEventIDType {
-    traces_.push_back(log);
-
-    log->event = cur_event_;
-
-    return log->event;
+    rec.event_ = cur_event_;
+    traces_.append(rec);
+    return rec.event_;
   };
 
   auto basic_create = [&]() -> TraceEventIDType {
-    traces_.push_back(log);
-    return log->event;
+    traces_.append(rec);
+    return rec.event_;
   };
 
-  switch (log->type) {
+  switch (rec.type()) {
   case TraceConstantsType::BeginProcessing:
     return grouped_begin();
   case TraceConstantsType::EndProcessing:
@@ -554,7 +629,7 @@ TraceEventIDType Trace::logEvent(LogPtrType log) {
     return basic_create();
   case TraceConstantsType::UserEvent:
   case TraceConstantsType::UserEventPair:
-    return log->user_start ? basic_cur_event() : basic_new_event_create();
+    return rec.userStart() ? basic_cur_event() : basic_new_event_create();
     break;
   case TraceConstantsType::BeginUserEventPair:
   case TraceConstantsType::EndUserEventPair:
@@ -566,7 +641,7 @@ TraceEventIDType Trace::logEvent(LogPtrType log) {
 }
 
 bool Trace::checkEnabled() {
-  if (ArgType::vt_trace) {
+  if (ArgType::vt_trace and filter_.rankTraced()) {
     auto const node = theContext()->getNode();
     if (ArgType::vt_trace_mod == 0) {
       return true;
@@ -601,7 +676,11 @@ void Trace::writeTracesFile() {
     TraceContainersType::event_container.size()
   );
 
-  if (checkEnabled()) {
+  if (checkEnabled() and ArgType::vt_trace_stream) {
+    finishStream();
+  } else if (checkEnabled() and ArgType::vt_trace_binary) {
+    writeBinaryFile();
+  } else if (checkEnabled()) {
     auto path = full_trace_name;
     gzFile file = gzopen(path.c_str(), "wb");
     outputHeader(node, start_time_, file);
@@ -620,167 +699,173 @@ void Trace::writeTracesFile() {
   }
 }
 
-void Trace::writeLogFile(gzFile file, TraceContainerType const& traces) {
-  for (auto&& log : traces) {
-    auto const converted_time = timeToInt(log->time - start_time_);
+void Trace::startStream() {
+  auto const node = theContext()->getNode();
+  auto const budget =
+    static_cast<std::size_t>(ArgType::vt_trace_stream_buffer) * 1024 * 1024;
 
-    auto const type = static_cast<
-      std::underlying_type<decltype(log->type)>::type
-    >(log->type);
+  debug_print(
+    trace, node,
+    "startStream: file={}, budget={}, policy={}\n",
+    full_trace_name, budget, ArgType::vt_trace_stream_policy
+  );
 
-    auto event_iter = TraceContainersType::getEventContainer().find(log->ep);
+  policy_ = getOverflowPolicy(ArgType::vt_trace_stream_policy);
 
-    vtAssert(
-      log->ep == no_trace_entry_id or
-      event_iter != TraceContainersType::getEventContainer().end(),
-      "Event must exist that was logged"
+  if (ArgType::vt_trace_binary) {
+    stream_fd_ = ::open(
+      full_trace_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644
+    );
+    vtAssert(stream_fd_ != -1, "Must be able to open the binary trace");
+    auto const write = TraceBinaryWriter::fileWriteFn(stream_fd_);
+    binary_ = std::make_unique<TraceBinaryWriter>(eventSeq);
+    binary_->writeHeader(
+      write, node, theContext()->getNumNodes(), timeToNs(start_time_)
     );
+    writer_ = std::make_unique<TraceWriter>(write, budget);
+  } else {
+    stream_file_ = gzopen(full_trace_name.c_str(), "wb");
+    outputHeader(node, start_time_, stream_file_);
+    auto const file = stream_file_;
+    auto const write = [file](char const* ptr, std::size_t len) {
+      gzwrite(file, ptr, static_cast<unsigned>(len));
+    };
+    writer_ = std::make_unique<TraceWriter>(write, budget);
+  }
+}
 
-    auto const event_seq_id = log->ep == no_trace_entry_id ?
-      no_trace_entry_id : event_iter->second.theEventSeq();
-
-    auto const num_nodes = theContext()->getNumNodes();
-
-    switch (log->type) {
-    case TraceConstantsType::BeginProcessing:
-      gzprintf(
-        file,
-        "%d %d %lu %lld %d %d %d 0 %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 " 0\n",
-        type,
-        eTraceEnvelopeTypes::ForChareMsg,
-        event_seq_id,
-        converted_time,
-        log->event,
-        log->node,
-        log->msg_len,
-        log->idx1,
-        log->idx2,
-        log->idx3,
-        log->idx4
-      );
-      break;
-    case TraceConstantsType::EndProcessing:
-      gzprintf(
-        file,
-        "%d %d %lu %lld %d %d %d 0 %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 " 0\n",
-        type,
-        eTraceEnvelopeTypes::ForChareMsg,
-        event_seq_id,
-        converted_time,
-        log->event,
-        log->node,
-        log->msg_len,
-        log->idx1,
-        log->idx2,
-        log->idx3,
-        log->idx4
-      );
-      break;
-    case TraceConstantsType::BeginIdle:
-      gzprintf(
-        file,
-        "%d %lld %d\n",
-        type,
-        converted_time,
-        log->node
-      );
-      break;
-    case TraceConstantsType::EndIdle:
-      gzprintf(
-        file,
-        "%d %lld %d\n",
-        type,
-        converted_time,
-        log->node
-      );
-      break;
-    case TraceConstantsType::CreationBcast:
-      gzprintf(
-        file,
-        "%d %d %lu %lld %d %d %d %d %d\n",
-        type,
-        eTraceEnvelopeTypes::ForChareMsg,
-        event_seq_id,
-        converted_time,
-        log->event,
-        log->node,
-        log->msg_len,
-        0,
-        num_nodes
-      );
-      break;
-    case TraceConstantsType::Creation:
-      gzprintf(
-        file,
-        "%d %d %lu %lld %d %d %d 0\n",
-        type,
-        eTraceEnvelopeTypes::ForChareMsg,
-        event_seq_id,
-        converted_time,
-        log->event,
-        log->node,
-        log->msg_len
-      );
-      break;
-    case TraceConstantsType::UserEvent:
-    case TraceConstantsType::UserEventPair:
-    case TraceConstantsType::BeginUserEventPair:
-    case TraceConstantsType::EndUserEventPair:
-      gzprintf(
-        file,
-        "%d %lld %lld %d %d %d\n",
-        type,
-        log->user_event,
-        converted_time,
-        log->event,
-        log->node,
-        0
-      );
-      break;
-    case TraceConstantsType::UserSupplied:
-      gzprintf(
-        file,
-        "%d %d %lld\n",
-        type,
-        log->user_supplied_data,
-        converted_time
-      );
-      break;
-    case TraceConstantsType::UserSuppliedNote:
-      gzprintf(
-        file,
-        "%d %lld %zu %s\n",
-        type,
-        converted_time,
-        log->user_supplied_note.length(),
-        log->user_supplied_note.c_str()
-      );
-      break;
-    case TraceConstantsType::UserSuppliedBracketedNote: {
-      auto const converted_end_time = timeToInt(log->end_time - start_time_);
-      gzprintf(
-        file,
-        "%d %lld %lld %d %zu %s\n",
-        type,
-        converted_time,
-        converted_end_time,
-        log->event,
-        log->user_supplied_note.length(),
-        log->user_supplied_note.c_str()
-      );
-      break;
-    }
-    case TraceConstantsType::MessageRecv:
-      vtAssert(false, "Message receive log type unimplemented");
-      break;
-    default:
-      vtAssertInfo(false, "Unimplemented log type", converted_time, log->node);
+void Trace::flushChunk(bool const finishing) {
+  if (writer_ == nullptr) {
+    startStream();
+  }
+
+  // Open events are copied on open_events_, so the arena can be reused
+  auto const num_records = static_cast<int64_t>(traces_.size());
+  std::string tables, chunk;
+  if (binary_ != nullptr) {
+    auto append = [](std::string& out) {
+      return [&out](char const* ptr, std::size_t len) { out.append(ptr, len); };
+    };
+    binary_->writeTables(append(tables), traces_, strings_, indices_);
+    binary_->writeRecords(append(chunk), traces_);
+  } else {
+    auto const ctx = makeProjectionsContext();
+    traces_.forEach([&](TraceRecord const& rec) {
+      formatProjectionsRecord(chunk, rec, ctx);
+    });
+  }
+  traces_.clear();
+
+  // Later records may refer to new strings and entries, so those are never
+  // dropped
+  if (not tables.empty()) {
+    writer_->enqueue(std::move(tables), true);
+  }
+
+  // The end of the trace is always kept
+  auto const block = finishing or policy_ == TraceOverflowPolicy::Block;
+  if (writer_->enqueue(std::move(chunk), block)) {
+    return;
+  }
+
+  // enqueue only takes the chunk when it returns true
+  overflow_chunks_++;
+  if (policy_ == TraceOverflowPolicy::Sample and
+      overflow_chunks_ % trace_stream_sample_stride == 0) {
+    writer_->enqueue(std::move(chunk), true);
+  } else {
+    dropped_records_ += num_records;
+  }
+}
+
+void Trace::finishStream() {
+  auto const node = theContext()->getNode();
+
+  flushChunk(true);
+  writer_->stop();
+  writer_ = nullptr;
+
+  if (binary_ != nullptr) {
+    binary_->writeEnd(
+      TraceBinaryWriter::fileWriteFn(stream_fd_), timeToNs(getCurrentTime())
+    );
+    binary_ = nullptr;
+    ::close(stream_fd_);
+    stream_fd_ = -1;
+  } else {
+    outputFooter(node, start_time_, stream_file_);
+    gzclose(stream_file_);
+    stream_file_ = nullptr;
+  }
+
+  if (dropped_records_ > 0) {
+    vt_print(
+      trace,
+      "trace writer fell behind: dropped {} records, {} chunks over budget "
+      "(--vt_trace_stream_policy={}, --vt_trace_stream_buffer={})\n",
+      dropped_records_, overflow_chunks_, ArgType::vt_trace_stream_policy,
+      ArgType::vt_trace_stream_buffer
+    );
+  }
+}
+
+void Trace::writeBinaryFile() {
+  auto const fd = ::open(
+    full_trace_name.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644
+  );
+  vtAssert(fd != -1, "Must be able to open the binary trace");
+
+  auto const write = TraceBinaryWriter::fileWriteFn(fd);
+  TraceBinaryWriter binary{eventSeq};
+  binary.writeHeader(
+    write, theContext()->getNode(), theContext()->getNumNodes(),
+    timeToNs(start_time_)
+  );
+  binary.writeTables(write, traces_, strings_, indices_);
+  binary.writeRecords(write, traces_);
+  binary.writeEnd(write, timeToNs(getCurrentTime()));
+  ::close(fd);
+
+  traces_.clear();
+}
+
+void Trace::writeLogFile(gzFile file, TraceContainerType const& traces) {
+  auto const ctx = makeProjectionsContext();
+  std::string out;
+  traces.forEach([&](TraceRecord const& rec) {
+    formatProjectionsRecord(out, rec, ctx);
+
+    if (out.size() >= trace_write_buffer_size) {
+      gzwrite(file, out.data(), static_cast<unsigned>(out.size()));
+      out.clear();
     }
+  });
+  gzwrite(file, out.data(), static_cast<unsigned>(out.size()));
+}
 
-    delete log;
+ProjectionsContext Trace::makeProjectionsContext() const {
+  ProjectionsContext ctx;
+  ctx.start_ = timeToNs(start_time_);
+  ctx.num_nodes_ = theContext()->getNumNodes();
+  ctx.event_seq_ = eventSeq;
+  ctx.strings_ = &strings_.getValues();
+  ctx.indices_ = &indices_.getValues();
+  return ctx;
+}
+
+/*static*/ TraceEntryIDType Trace::eventSeq(TraceEntryIDType const ep) {
+  if (ep == no_trace_entry_id) {
+    return no_trace_entry_id;
   }
 
-  traces.empty();
+  auto event_iter = TraceContainersType::getEventContainer().find(ep);
+
+  vtAssert(
+    event_iter != TraceContainersType::getEventContainer().end(),
+    "Event must exist that was logged"
+  );
+
+  return event_iter->second.theEventSeq();
 }
 
 /*static*/ double Trace::getCurrentTime() {
@@ -872,22 +957,25 @@ void Trace::outputControlFile(std::ofstream& file) {
 /*static*/ void Trace::outputHeader(
   NodeType const node, double const start, gzFile file
 ) {
-  // Output header for projections file
-  gzprintf(file, "PROJECTIONS-RECORD 0\n");
-  // '6' means COMPUTATION_BEGIN to Projections: this starts a trace
-  gzprintf(file, "6 0\n");
+  std::string out;
+  formatProjectionsHeader(out);
+  gzwrite(file, out.data(), static_cast<unsigned>(out.size()));
 }
 
 /*static*/ void Trace::outputFooter(
   NodeType const node, double const start, gzFile file
 ) {
-  // Output footer for projections file, '7' means COMPUTATION_END to
-  // Projections
-  gzprintf(file, "7 %lld\n", timeToInt(getCurrentTime() - start));
+  std::string out;
+  formatProjectionsFooter(out, timeToNs(getCurrentTime()) - timeToNs(start));
+  gzwrite(file, out.data(), static_cast<unsigned>(out.size()));
 }
 
 /*static*/ Trace::TimeIntegerType Trace::timeToInt(double const time) {
   return static_cast<TimeIntegerType>(time * 1e6);
 }
 
+/*static*/ TraceTimeType Trace::timeToNs(double const time) {
+  return static_cast<TraceTimeType>(time * 1e9);
+}
+
 }} //end namespace vt::trace
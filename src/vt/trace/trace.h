@@ -53,8 +53,14 @@
 #include "vt/trace/trace_constants.h"
 #include "vt/trace/trace_event.h"
 #include "vt/trace/trace_containers.h"
-#include "vt/trace/trace_log.h"
+#include "vt/trace/trace_record.h"
+#include "vt/trace/trace_arena.h"
+#include "vt/trace/trace_intern.h"
 #include "vt/trace/trace_user_event.h"
+#include "vt/trace/trace_writer.h"
+#include "vt/trace/trace_projections.h"
+#include "vt/trace/trace_binary.h"
+#include "vt/trace/trace_filter.h"
 
 #include <cstdint>
 #include <cassert>
@@ -73,13 +79,11 @@
 namespace vt { namespace trace {
 
 struct Trace {
-  using LogType             = Log;
   using TraceConstantsType  = eTraceConstants;
   using TraceContainersType = TraceContainers<void>;
   using TimeIntegerType     = int64_t;
-  using LogPtrType          = LogType*;
-  using TraceContainerType  = std::vector<LogPtrType>;
-  using TraceStackType      = std::stack<LogPtrType>;
+  using TraceContainerType  = TraceArena;
+  using TraceStackType      = std::stack<TraceRecord>;
   using ArgType             = vt::arguments::ArgConfig;
 
   Trace();
@@ -87,8 +91,6 @@ struct Trace {
 
   virtual ~Trace();
 
-  friend struct Log;
-
   std::string getTraceName() const { return full_trace_name; }
   std::string getSTSName()   const { return full_sts_name;   }
   std::string getDirectory() const { return full_dir_name;   }
@@ -151,19 +153,24 @@ struct Trace {
     TraceEntryIDType const ep, TraceMsgLenType const len,
     NodeType const from_node, double const time = getCurrentTime()
   );
-  TraceEventIDType logEvent(LogPtrType log);
+  TraceEventIDType logEvent(TraceRecord rec);
 
   void enableTracing();
   void disableTracing();
   bool checkEnabled();
+  void setPhase(PhaseType const phase);
 
   void writeTracesFile();
   void writeLogFile(gzFile file, TraceContainerType const& traces);
+  void writeBinaryFile();
+  ProjectionsContext makeProjectionsContext() const;
   bool inIdleEvent() const;
 
   static double getCurrentTime();
   void outputControlFile(std::ofstream& file);
   static TimeIntegerType timeToInt(double const time);
+  static TraceTimeType timeToNs(double const time);
+  static TraceEntryIDType eventSeq(TraceEntryIDType const ep);
   static void traceBeginIdleTrigger();
   static void outputHeader(
     NodeType const node, double const start, gzFile file
@@ -175,7 +182,18 @@ struct Trace {
   friend void insertNewUserEvent(UserEventIDType event, std::string const& name);
 
 private:
-  void editLastEntry(std::function<void(LogPtrType)> fn);
+  TraceIndexType internIndex(
+    uint64_t const idx1, uint64_t const idx2, uint64_t const idx3,
+    uint64_t const idx4
+  );
+
+  /*
+   * Streaming mode (--vt_trace_stream): hand the current chunk of traces to
+   * the background writer, applying the overflow policy if it is behind
+   */
+  void startStream();
+  void flushChunk(bool const finishing = false);
+  void finishStream();
 
 private:
   TraceContainerType traces_;
@@ -191,6 +209,17 @@ private:
   std::string full_sts_name     = "";
   std::string full_dir_name     = "";
   UserEventRegistry user_event  = {};
+  TraceStringTable strings_     = TraceStringTable{""};
+  TraceIndexTable indices_      = TraceIndexTable{TraceIndexTupleType{}};
+  std::unique_ptr<TraceWriter> writer_ = nullptr;
+  gzFile stream_file_           = nullptr;
+  int stream_fd_                = -1;
+  std::unique_ptr<TraceBinaryWriter> binary_ = nullptr;
+  TraceOverflowPolicy policy_   = TraceOverflowPolicy::Block;
+  int64_t overflow_chunks_      = 0;
+  int64_t dropped_records_      = 0;
+  TraceFilter filter_           = {};
+  std::vector<bool> processing_traced_ = {};
 };
 
 }} //end namespace vt::trace
@@ -0,0 +1,115 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                trace_arena.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#if !defined INCLUDED_TRACE_TRACE_ARENA_H
+#define INCLUDED_TRACE_TRACE_ARENA_H
+
+#include "vt/config.h"
+#include "vt/trace/trace_common.h"
+#include "vt/trace/trace_record.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace vt { namespace trace {
+
+/*
+ * Append-only storage for trace records in fixed blocks of
+ * trace_arena_block_count, so appending never moves a record and never
+ * allocates except to add a block. The arena is not synchronized: each thread
+ * that traces owns its own.
+ */
+struct TraceArena {
+  using BlockType = std::unique_ptr<TraceRecord[]>;
+
+  TraceArena() = default;
+
+  TraceRecord& append(TraceRecord const& rec) {
+    auto const block = size_ / trace_arena_block_count;
+    if (block == blocks_.size()) {
+      blocks_.emplace_back(BlockType{new TraceRecord[trace_arena_block_count]});
+    }
+    auto& slot = blocks_[block][size_ % trace_arena_block_count];
+    slot = rec;
+    size_++;
+    return slot;
+  }
+
+  std::size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  /*
+   * Forget the records but keep the blocks for reuse
+   */
+  void clear() { size_ = 0; }
+
+  template <typename Callable>
+  void forEach(Callable&& fn) const {
+    for (std::size_t i = 0; i < size_; i++) {
+      fn(blocks_[i / trace_arena_block_count][i % trace_arena_block_count]);
+    }
+  }
+
+  /*
+   * Visit the records as contiguous runs, one per block
+   */
+  template <typename Callable>
+  void forEachBlock(Callable&& fn) const {
+    for (std::size_t i = 0; i < size_; i += trace_arena_block_count) {
+      auto const len = std::min(trace_arena_block_count, size_ - i);
+      fn(&blocks_[i / trace_arena_block_count][0], len);
+    }
+  }
+
+private:
+  std::vector<BlockType> blocks_;
+  std::size_t size_ = 0;
+};
+
+}} //end namespace vt::trace
+
+#endif /*INCLUDED_TRACE_TRACE_ARENA_H*/
@@ -0,0 +1,287 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               trace_binary.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#include "vt/config.h"
+#include "vt/trace/trace_binary.h"
+
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace vt { namespace trace {
+
+TraceBinaryWriter::TraceBinaryWriter(EventSeqFnType in_event_seq)
+  : event_seq_(in_event_seq)
+{ }
+
+/*static*/ TraceBinaryWriter::WriteFnType TraceBinaryWriter::fileWriteFn(
+  int fd
+) {
+  return [fd](char const* ptr, std::size_t len) {
+    while (len > 0) {
+      auto const ret = ::write(fd, ptr, len);
+      if (ret < 0 and errno == EINTR) {
+        continue;
+      }
+      vtAssert(ret > 0, "Must be able to write the binary trace");
+      ptr += ret;
+      len -= static_cast<std::size_t>(ret);
+    }
+  };
+}
+
+void TraceBinaryWriter::writeHeader(
+  WriteFnType const& fn, NodeType node, NodeType num_nodes,
+  TraceTimeType start
+) {
+  uint64_t const magic = trace_binary_magic;
+  uint32_t const version = trace_binary_version;
+  uint32_t const record_size = sizeof(TraceRecord);
+  int32_t const node32 = node;
+  int32_t const num_nodes32 = num_nodes;
+  fn(reinterpret_cast<char const*>(&magic), sizeof(magic));
+  fn(reinterpret_cast<char const*>(&version), sizeof(version));
+  fn(reinterpret_cast<char const*>(&record_size), sizeof(record_size));
+  fn(reinterpret_cast<char const*>(&node32), sizeof(node32));
+  fn(reinterpret_cast<char const*>(&num_nodes32), sizeof(num_nodes32));
+  fn(reinterpret_cast<char const*>(&start), sizeof(start));
+}
+
+/*static*/ void TraceBinaryWriter::writeSection(
+  WriteFnType const& fn, TraceBinarySection kind, uint64_t count
+) {
+  auto const kind32 = static_cast<uint32_t>(kind);
+  fn(reinterpret_cast<char const*>(&kind32), sizeof(kind32));
+  fn(reinterpret_cast<char const*>(&count), sizeof(count));
+}
+
+void TraceBinaryWriter::writeTables(
+  WriteFnType const& fn, TraceArena const& records,
+  TraceStringTable const& strings, TraceIndexTable const& indices
+) {
+  auto const& str_vals = strings.getValues();
+  if (str_vals.size() > strings_written_) {
+    writeSection(fn, TraceBinarySection::Strings, str_vals.size() - strings_written_);
+    for (auto i = strings_written_; i < str_vals.size(); i++) {
+      auto const len = static_cast<uint32_t>(str_vals[i].size());
+      fn(reinterpret_cast<char const*>(&len), sizeof(len));
+      fn(str_vals[i].data(), len);
+    }
+    strings_written_ = str_vals.size();
+  }
+
+  auto const& idx_vals = indices.getValues();
+  if (idx_vals.size() > indices_written_) {
+    writeSection(fn, TraceBinarySection::Indices, idx_vals.size() - indices_written_);
+    fn(
+      reinterpret_cast<char const*>(&idx_vals[indices_written_]),
+      (idx_vals.size() - indices_written_) * sizeof(TraceIndexTupleType)
+    );
+    indices_written_ = idx_vals.size();
+  }
+
+  std::vector<uint64_t> entries;
+  records.forEach([&](TraceRecord const& rec) {
+    switch (rec.type()) {
+    case eTraceConstants::BeginProcessing:
+    case eTraceConstants::EndProcessing:
+    case eTraceConstants::Creation:
+    case eTraceConstants::CreationBcast:
+      if (rec.ep() != no_trace_entry_id and
+          entries_written_.insert(rec.ep()).second) {
+        entries.push_back(rec.ep());
+        entries.push_back(event_seq_(rec.ep()));
+      }
+      break;
+    default:
+      break;
+    }
+  });
+  if (not entries.empty()) {
+    writeSection(fn, TraceBinarySection::Entries, entries.size() / 2);
+    fn(
+      reinterpret_cast<char const*>(entries.data()),
+      entries.size() * sizeof(uint64_t)
+    );
+  }
+}
+
+void TraceBinaryWriter::writeRecords(
+  WriteFnType const& fn, TraceArena const& records
+) {
+  if (records.empty()) {
+    return;
+  }
+  writeSection(fn, TraceBinarySection::Records, records.size());
+  records.forEachBlock([&](TraceRecord const* recs, std::size_t len) {
+    fn(reinterpret_cast<char const*>(recs), len * sizeof(TraceRecord));
+  });
+}
+
+void TraceBinaryWriter::writeEnd(WriteFnType const& fn, TraceTimeType end) {
+  writeSection(fn, TraceBinarySection::End, static_cast<uint64_t>(end));
+}
+
+TraceBinaryReader::TraceBinaryReader(std::string const& file_name) {
+  auto const fd = ::open(file_name.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return;
+  }
+  struct stat st;
+  if (fstat(fd, &st) != 0 or st.st_size == 0) {
+    ::close(fd);
+    return;
+  }
+  size_ = static_cast<std::size_t>(st.st_size);
+  auto const ptr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (ptr == MAP_FAILED) {
+    size_ = 0;
+    return;
+  }
+  data_ = static_cast<char const*>(ptr);
+
+  uint64_t magic = 0;
+  uint32_t version = 0, record_size = 0;
+  int32_t node = 0, num_nodes = 0;
+  good_ =
+    readRaw(magic) and magic == trace_binary_magic and
+    readRaw(version) and version == trace_binary_version and
+    readRaw(record_size) and record_size == sizeof(TraceRecord) and
+    readRaw(node) and readRaw(num_nodes) and readRaw(start_);
+  node_ = static_cast<NodeType>(node);
+  num_nodes_ = static_cast<NodeType>(num_nodes);
+}
+
+TraceBinaryReader::~TraceBinaryReader() {
+  if (data_ != nullptr) {
+    munmap(const_cast<char*>(data_), size_);
+  }
+}
+
+template <typename T>
+bool TraceBinaryReader::readRaw(T& val) {
+  if (pos_ + sizeof(T) > size_) {
+    return false;
+  }
+  std::memcpy(&val, data_ + pos_, sizeof(T));
+  pos_ += sizeof(T);
+  return true;
+}
+
+bool TraceBinaryReader::read(RecordFnType fn) {
+  if (not good_) {
+    return false;
+  }
+
+  while (pos_ < size_) {
+    uint32_t kind = 0;
+    uint64_t count = 0;
+    if (not readRaw(kind) or not readRaw(count)) {
+      return false;
+    }
+
+    switch (static_cast<TraceBinarySection>(kind)) {
+    case TraceBinarySection::Strings:
+      for (uint64_t i = 0; i < count; i++) {
+        uint32_t len = 0;
+        if (not readRaw(len) or pos_ + len > size_) {
+          return false;
+        }
+        strings_.emplace_back(data_ + pos_, len);
+        pos_ += len;
+      }
+      break;
+    case TraceBinarySection::Indices:
+      for (uint64_t i = 0; i < count; i++) {
+        TraceIndexTupleType idx;
+        if (not readRaw(idx)) {
+          return false;
+        }
+        indices_.push_back(idx);
+      }
+      break;
+    case TraceBinarySection::Entries:
+      for (uint64_t i = 0; i < count; i++) {
+        uint64_t ep = 0, seq = 0;
+        if (not readRaw(ep) or not readRaw(seq)) {
+          return false;
+        }
+        entries_[ep] = seq;
+      }
+      break;
+    case TraceBinarySection::Records:
+      for (uint64_t i = 0; i < count; i++) {
+        TraceRecord rec;
+        if (not readRaw(rec)) {
+          return false;
+        }
+        fn(rec);
+      }
+      break;
+    case TraceBinarySection::End:
+      end_ = static_cast<TraceTimeType>(count);
+      has_end_ = true;
+      break;
+    default:
+      return false;
+    }
+  }
+  return true;
+}
+
+TraceEntryIDType TraceBinaryReader::eventSeq(TraceEntryIDType ep) const {
+  if (ep == no_trace_entry_id) {
+    return no_trace_entry_id;
+  }
+  auto iter = entries_.find(ep);
+  return iter == entries_.end() ? no_trace_entry_id : iter->second;
+}
+
+}} //end namespace vt::trace
@@ -0,0 +1,181 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                trace_binary.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#if !defined INCLUDED_TRACE_TRACE_BINARY_H
+#define INCLUDED_TRACE_TRACE_BINARY_H
+
+#include "vt/config.h"
+#include "vt/trace/trace_common.h"
+#include "vt/trace/trace_record.h"
+#include "vt/trace/trace_arena.h"
+#include "vt/trace/trace_intern.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace vt { namespace trace {
+
+/*
+ * Binary trace format, one file per rank (--vt_trace_binary).
+ *
+ *   header:   magic (u64), version (u32), record size (u32), node (i32),
+ *             number of nodes (i32), start time (i64, ns)
+ *   sections: kind (u32), count (u64), then
+ *     Strings -> count strings, each a length (u32) then its bytes
+ *     Indices -> count index tuples of 4 u64
+ *     Entries -> count pairs of entry point and Projections event sequence
+ *                (u64 each)
+ *     Records -> count raw TraceRecords
+ *     End     -> nothing; count is the end time (ns)
+ *
+ * String and index IDs carry on from one section to the next, with ID 0 (the
+ * empty string, the zero index) implicit. Each flush writes the strings,
+ * indices and entries its records are first to refer to ahead of the records,
+ * so the file can be written as the trace streams and a reader never meets an
+ * unknown ID.
+ */
+static constexpr uint64_t const trace_binary_magic   = 0x4543415254425456;
+static constexpr uint32_t const trace_binary_version = 1;
+
+enum struct TraceBinarySection : uint32_t {
+  Strings = 1,
+  Indices = 2,
+  Entries = 3,
+  Records = 4,
+  End     = 5
+};
+
+struct TraceBinaryWriter {
+  using WriteFnType    = std::function<void(char const*, std::size_t)>;
+  using EventSeqFnType = std::function<TraceEntryIDType(TraceEntryIDType)>;
+
+  explicit TraceBinaryWriter(EventSeqFnType in_event_seq);
+
+  void writeHeader(
+    WriteFnType const& fn, NodeType node, NodeType num_nodes,
+    TraceTimeType start
+  );
+
+  /*
+   * Write whatever in the tables `records` refer to that is not written yet
+   */
+  void writeTables(
+    WriteFnType const& fn, TraceArena const& records,
+    TraceStringTable const& strings, TraceIndexTable const& indices
+  );
+  void writeRecords(WriteFnType const& fn, TraceArena const& records);
+  void writeEnd(WriteFnType const& fn, TraceTimeType end);
+
+  /*
+   * Write function for a file descriptor, retrying short writes
+   */
+  static WriteFnType fileWriteFn(int fd);
+
+private:
+  static void writeSection(
+    WriteFnType const& fn, TraceBinarySection kind, uint64_t count
+  );
+
+private:
+  EventSeqFnType event_seq_ = nullptr;
+  std::size_t strings_written_ = 1;
+  std::size_t indices_written_ = 1;
+  std::unordered_set<TraceEntryIDType> entries_written_;
+};
+
+struct TraceBinaryReader {
+  using RecordFnType = std::function<void(TraceRecord const&)>;
+
+  explicit TraceBinaryReader(std::string const& file_name);
+  TraceBinaryReader(TraceBinaryReader const&) = delete;
+  TraceBinaryReader& operator=(TraceBinaryReader const&) = delete;
+  ~TraceBinaryReader();
+
+  bool good() const { return good_; }
+  NodeType getNode() const { return node_; }
+  NodeType getNumNodes() const { return num_nodes_; }
+  TraceTimeType getStart() const { return start_; }
+  TraceTimeType getEnd() const { return end_; }
+  bool hasEnd() const { return has_end_; }
+
+  /*
+   * Walk the file, handing every record to `fn`. The tables below are complete
+   * up to the record being handed out. Returns false if the file is cut short
+   * or malformed.
+   */
+  bool read(RecordFnType fn);
+
+  std::vector<std::string> const& getStrings() const { return strings_; }
+  std::vector<TraceIndexTupleType> const& getIndices() const {
+    return indices_;
+  }
+  TraceEntryIDType eventSeq(TraceEntryIDType ep) const;
+
+private:
+  template <typename T>
+  bool readRaw(T& val);
+
+private:
+  char const* data_ = nullptr;
+  std::size_t size_ = 0;
+  std::size_t pos_ = 0;
+  bool good_ = false;
+  NodeType node_ = uninitialized_destination;
+  NodeType num_nodes_ = 0;
+  TraceTimeType start_ = 0;
+  TraceTimeType end_ = 0;
+  bool has_end_ = false;
+  std::vector<std::string> strings_ = {""};
+  std::vector<TraceIndexTupleType> indices_ = {TraceIndexTupleType{}};
+  std::unordered_map<TraceEntryIDType, TraceEntryIDType> entries_;
+};
+
+}} //end namespace vt::trace
+
+#endif /*INCLUDED_TRACE_TRACE_BINARY_H*/
@@ -64,7 +64,10 @@ using UserEventIDType     = int64_t;
 static constexpr TraceEntryIDType const no_trace_entry_id = u64empty;
 static constexpr TraceEventIDType const no_trace_event = 0;
 static constexpr NodeType const designated_root_node = 0;
-static constexpr int64_t const trace_reserve_count = 1048576;
+static constexpr std::size_t const trace_arena_block_count = 4096;
+static constexpr int64_t const trace_stream_chunk_count = 8192;
+static constexpr int64_t const trace_stream_sample_stride = 8;
+static constexpr std::size_t const trace_write_buffer_size = 1048576;
 
 static constexpr BitCountType const trace_event_num_bits = 32;
 
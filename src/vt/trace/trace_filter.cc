@@ -0,0 +1,157 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               trace_filter.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#include "vt/config.h"
+#include "vt/configs/arguments/args.h"
+#include "vt/trace/trace_filter.h"
+#include "vt/trace/trace_registry.h"
+
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+namespace vt { namespace trace {
+
+void TraceFilter::setup(NodeType const this_node) {
+  using ArgType = vt::arguments::ArgConfig;
+
+  vtAssert(ArgType::vt_trace_sample >= 1, "Trace sample rate must be >= 1");
+
+  patterns_ = parsePatterns(ArgType::vt_trace_filter);
+  entries_.clear();
+  sample_ = ArgType::vt_trace_sample;
+  phase_first_ = ArgType::vt_trace_phase_first;
+  phase_last_ = ArgType::vt_trace_phase_last;
+  rank_traced_ =
+    ArgType::vt_trace_ranks == "" or
+    rankInList(ArgType::vt_trace_ranks, this_node);
+}
+
+TraceFilter::EntryState& TraceFilter::getEntry(TraceEntryIDType const ep) {
+  auto iter = entries_.find(ep);
+  if (iter == entries_.end()) {
+    EntryState state;
+    state.traced =
+      patterns_.empty() or
+      nameMatches(TraceRegistry::getEventFullName(ep), patterns_);
+    iter = entries_.emplace(ep, state).first;
+  }
+  return iter->second;
+}
+
+bool TraceFilter::entryTraced(TraceEntryIDType const ep) {
+  if (patterns_.empty()) {
+    return true;
+  }
+  return getEntry(ep).traced;
+}
+
+bool TraceFilter::executionTraced(TraceEntryIDType const ep) {
+  if (patterns_.empty() and sample_ == 1) {
+    return true;
+  }
+  auto& entry = getEntry(ep);
+  if (not entry.traced) {
+    return false;
+  }
+  return entry.count++ % static_cast<uint64_t>(sample_) == 0;
+}
+
+/*static*/ std::vector<std::string> TraceFilter::parsePatterns(
+  std::string const& list
+) {
+  std::vector<std::string> patterns;
+  std::string::size_type begin = 0;
+  while (begin <= list.size()) {
+    auto end = list.find(',', begin);
+    if (end == std::string::npos) {
+      end = list.size();
+    }
+    if (end > begin) {
+      patterns.push_back(list.substr(begin, end - begin));
+    }
+    begin = end + 1;
+  }
+  return patterns;
+}
+
+/*static*/ bool TraceFilter::nameMatches(
+  std::string const& name, std::vector<std::string> const& patterns
+) {
+  for (auto&& pattern : patterns) {
+    if (name.find(pattern) != std::string::npos) {
+      return true;
+    }
+  }
+  return false;
+}
+
+/*static*/ bool TraceFilter::rankInList(
+  std::string const& list, NodeType const node
+) {
+  for (auto&& range : parsePatterns(list)) {
+    auto const str = range.c_str();
+    char* end = nullptr;
+    auto const first = std::strtol(str, &end, 10);
+    auto last = first;
+    bool valid = end != str;
+    if (valid and *end == '-') {
+      auto const last_str = end + 1;
+      last = std::strtol(last_str, &end, 10);
+      valid = end != last_str;
+    }
+    if (not valid or *end != '\0') {
+      vtAbort(
+        fmt::format("Invalid rank range \"{}\" in --vt_trace_ranks", range)
+      );
+    }
+    if (node >= first and node <= last) {
+      return true;
+    }
+  }
+  return false;
+}
+
+}} //end namespace vt::trace
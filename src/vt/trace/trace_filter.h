@@ -0,0 +1,128 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                trace_filter.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#if !defined INCLUDED_TRACE_TRACE_FILTER_H
+#define INCLUDED_TRACE_TRACE_FILTER_H
+
+#include "vt/config.h"
+#include "vt/trace/trace_common.h"
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vt { namespace trace {
+
+/*
+ * Decides what gets traced when only part of a run is wanted:
+ *   --vt_trace_ranks        -> only these ranks write a trace
+ *   --vt_trace_phase_*      -> only events inside this phase range
+ *   --vt_trace_filter       -> only handlers whose "<type>::<name>" contains
+ *                              one of the patterns
+ *   --vt_trace_sample N     -> one in N executions of each handler; the kept
+ *                              ones are flagged so profiles can be scaled back
+ *
+ * Name matching runs once per entry point and is cached, so every check on the
+ * handler path is a hash lookup or cheaper.
+ */
+struct TraceFilter {
+  TraceFilter() = default;
+
+  /*
+   * Read the filter arguments for this rank
+   */
+  void setup(NodeType const this_node);
+
+  bool rankTraced() const { return rank_traced_; }
+  bool phaseTraced() const {
+    return (phase_first_ < 0 or phase_ >= static_cast<PhaseType>(phase_first_))
+       and (phase_last_ < 0 or phase_ <= static_cast<PhaseType>(phase_last_));
+  }
+  void setPhase(PhaseType const phase) { phase_ = phase; }
+  PhaseType getPhase() const { return phase_; }
+  int32_t getSampleWeight() const { return sample_; }
+
+  /*
+   * Whether events for this entry point pass the name filter
+   */
+  bool entryTraced(TraceEntryIDType const ep);
+
+  /*
+   * Whether this execution of the entry point is recorded: it must pass the
+   * name filter and be the one in N picked by sampling
+   */
+  bool executionTraced(TraceEntryIDType const ep);
+
+  static std::vector<std::string> parsePatterns(std::string const& list);
+  static bool nameMatches(
+    std::string const& name, std::vector<std::string> const& patterns
+  );
+  /*
+   * Whether node is in a rank list such as "0-3,8"
+   */
+  static bool rankInList(std::string const& list, NodeType const node);
+
+private:
+  struct EntryState {
+    bool traced     = true;
+    uint64_t count  = 0;
+  };
+
+  EntryState& getEntry(TraceEntryIDType const ep);
+
+private:
+  std::vector<std::string> patterns_;
+  std::unordered_map<TraceEntryIDType, EntryState> entries_;
+  int32_t sample_               = 1;
+  int64_t phase_first_          = -1;
+  int64_t phase_last_           = -1;
+  PhaseType phase_              = 0;
+  bool rank_traced_             = true;
+};
+
+}} //end namespace vt::trace
+
+#endif /*INCLUDED_TRACE_TRACE_FILTER_H*/
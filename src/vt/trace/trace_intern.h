@@ -0,0 +1,113 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                trace_intern.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#if !defined INCLUDED_TRACE_TRACE_INTERN_H
+#define INCLUDED_TRACE_TRACE_INTERN_H
+
+#include "vt/config.h"
+#include "vt/trace/trace_record.h"
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace vt { namespace trace {
+
+/*
+ * Values referred to by 32-bit ID from trace records. ID 0 always holds the
+ * "none" value given at construction, and IDs are handed out densely in order
+ * of first use.
+ */
+template <typename T, typename HashT = std::hash<T>>
+struct TraceInternTable {
+  using IDType = uint32_t;
+
+  explicit TraceInternTable(T const& none)
+    : values_{none}
+  {
+    ids_.emplace(none, 0);
+  }
+
+  IDType intern(T const& value) {
+    auto iter = ids_.find(value);
+    if (iter != ids_.end()) {
+      return iter->second;
+    }
+    auto const id = static_cast<IDType>(values_.size());
+    values_.push_back(value);
+    ids_.emplace(value, id);
+    return id;
+  }
+
+  T const& get(IDType const id) const { return values_.at(id); }
+  std::vector<T> const& getValues() const { return values_; }
+  std::size_t size() const { return values_.size(); }
+
+private:
+  std::vector<T> values_;
+  std::unordered_map<T, IDType, HashT> ids_;
+};
+
+using TraceIndexTupleType = std::array<uint64_t, 4>;
+
+struct TraceIndexTupleHash {
+  std::size_t operator()(TraceIndexTupleType const& idx) const {
+    std::size_t seed = 0;
+    for (auto&& elm : idx) {
+      seed ^= std::hash<uint64_t>()(elm) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+  }
+};
+
+using TraceStringTable = TraceInternTable<std::string>;
+using TraceIndexTable  = TraceInternTable<TraceIndexTupleType, TraceIndexTupleHash>;
+
+}} //end namespace vt::trace
+
+#endif /*INCLUDED_TRACE_TRACE_INTERN_H*/
@@ -0,0 +1,218 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             trace_projections.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#include "vt/config.h"
+#include "vt/trace/trace_projections.h"
+#include "vt/trace/trace_constants.h"
+
+#include <cstdarg>
+#include <cstdio>
+#include <inttypes.h>
+#include <type_traits>
+
+namespace vt { namespace trace {
+
+static void appendf(std::string& out, char const* format, ...) {
+  char buf[256];
+  va_list args, args_copy;
+  va_start(args, format);
+  va_copy(args_copy, args);
+  auto const len = vsnprintf(buf, sizeof(buf), format, args);
+  va_end(args);
+  if (len > 0 and static_cast<std::size_t>(len) < sizeof(buf)) {
+    out.append(buf, len);
+  } else if (len > 0) {
+    // Long user notes do not fit in the stack buffer
+    auto const cur = out.size();
+    out.resize(cur + len + 1);
+    vsnprintf(&out[cur], len + 1, format, args_copy);
+    out.resize(cur + len);
+  }
+  va_end(args_copy);
+}
+
+void formatProjectionsHeader(std::string& out) {
+  // Output header for projections file
+  out += "PROJECTIONS-RECORD 0\n";
+  // '6' means COMPUTATION_BEGIN to Projections: this starts a trace
+  out += "6 0\n";
+}
+
+void formatProjectionsFooter(std::string& out, TraceTimeType const end) {
+  // Output footer for projections file, '7' means COMPUTATION_END to
+  // Projections
+  appendf(out, "7 %lld\n", static_cast<long long>(end / 1000));
+}
+
+void formatProjectionsRecord(
+  std::string& out, TraceRecord const& rec, ProjectionsContext const& ctx
+) {
+  using TraceConstantsType = eTraceConstants;
+
+  auto const converted_time = (rec.time_ - ctx.start_) / 1000;
+
+  auto const type = static_cast<
+    std::underlying_type<TraceConstantsType>::type
+  >(rec.type());
+
+  switch (rec.type()) {
+  case TraceConstantsType::BeginProcessing:
+  case TraceConstantsType::EndProcessing: {
+    auto const& idx = ctx.indices_->at(rec.index_);
+    appendf(
+      out,
+      "%d %d %lu %lld %d %d %d 0 %" PRIu64 " %" PRIu64 " %" PRIu64 " %" PRIu64 " 0\n",
+      type,
+      eTraceEnvelopeTypes::ForChareMsg,
+      ctx.event_seq_(rec.ep()),
+      converted_time,
+      rec.event_,
+      rec.node_,
+      rec.aux_,
+      idx[0],
+      idx[1],
+      idx[2],
+      idx[3]
+    );
+    break;
+  }
+  case TraceConstantsType::BeginIdle:
+  case TraceConstantsType::EndIdle:
+    appendf(
+      out,
+      "%d %lld %d\n",
+      type,
+      converted_time,
+      rec.node_
+    );
+    break;
+  case TraceConstantsType::CreationBcast:
+    appendf(
+      out,
+      "%d %d %lu %lld %d %d %d %d %d\n",
+      type,
+      eTraceEnvelopeTypes::ForChareMsg,
+      ctx.event_seq_(rec.ep()),
+      converted_time,
+      rec.event_,
+      rec.node_,
+      rec.aux_,
+      0,
+      ctx.num_nodes_
+    );
+    break;
+  case TraceConstantsType::Creation:
+    appendf(
+      out,
+      "%d %d %lu %lld %d %d %d 0\n",
+      type,
+      eTraceEnvelopeTypes::ForChareMsg,
+      ctx.event_seq_(rec.ep()),
+      converted_time,
+      rec.event_,
+      rec.node_,
+      rec.aux_
+    );
+    break;
+  case TraceConstantsType::UserEvent:
+  case TraceConstantsType::UserEventPair:
+  case TraceConstantsType::BeginUserEventPair:
+  case TraceConstantsType::EndUserEventPair:
+    appendf(
+      out,
+      "%d %lld %lld %d %d %d\n",
+      type,
+      rec.userEvent(),
+      converted_time,
+      rec.event_,
+      rec.node_,
+      0
+    );
+    break;
+  case TraceConstantsType::UserSupplied:
+    appendf(
+      out,
+      "%d %d %lld\n",
+      type,
+      rec.userData(),
+      converted_time
+    );
+    break;
+  case TraceConstantsType::UserSuppliedNote: {
+    auto const& note = ctx.strings_->at(rec.aux_);
+    appendf(
+      out,
+      "%d %lld %zu %s\n",
+      type,
+      converted_time,
+      note.length(),
+      note.c_str()
+    );
+    break;
+  }
+  case TraceConstantsType::UserSuppliedBracketedNote: {
+    auto const& note = ctx.strings_->at(rec.aux_);
+    auto const converted_end_time = (rec.endTime() - ctx.start_) / 1000;
+    appendf(
+      out,
+      "%d %lld %lld %d %zu %s\n",
+      type,
+      converted_time,
+      converted_end_time,
+      rec.event_,
+      note.length(),
+      note.c_str()
+    );
+    break;
+  }
+  case TraceConstantsType::MessageRecv:
+    vtAssert(false, "Message receive log type unimplemented");
+    break;
+  default:
+    vtAssertInfo(false, "Unimplemented log type", converted_time, rec.node_);
+  }
+}
+
+}} //end namespace vt::trace
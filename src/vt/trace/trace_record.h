@@ -0,0 +1,126 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                trace_record.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#if !defined INCLUDED_TRACE_TRACE_RECORD_H
+#define INCLUDED_TRACE_TRACE_RECORD_H
+
+#include "vt/config.h"
+#include "vt/trace/trace_common.h"
+#include "vt/trace/trace_constants.h"
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace vt { namespace trace {
+
+using TraceTimeType   = int64_t;
+using TraceStringType = uint32_t;
+using TraceIndexType  = uint32_t;
+
+static constexpr TraceStringType const no_trace_string = 0;
+static constexpr TraceIndexType const no_trace_index = 0;
+
+/*
+ * One trace event in 32 bytes. Times are integer nanoseconds on the
+ * Trace::getCurrentTime() clock; strings and collection indices are interned
+ * and stored by ID (see trace_intern.h).
+ *
+ * What data_ and aux_ hold depends on type_:
+ *   processing, creation, recv  -> data_ = entry point, aux_ = message length
+ *   user events                 -> data_ = user event ID
+ *   UserSupplied                -> data_ = user data
+ *   UserSuppliedNote            -> aux_ = note
+ *   UserSuppliedBracketedNote   -> data_ = end time, aux_ = note
+ */
+struct TraceRecord {
+  using TraceConstantsType = eTraceConstants;
+
+  TraceRecord() = default;
+  TraceRecord(TraceTimeType const in_time, TraceConstantsType const in_type)
+    : time_(in_time), type_(static_cast<int8_t>(in_type))
+  { }
+
+  TraceConstantsType type() const {
+    return static_cast<TraceConstantsType>(type_);
+  }
+  TraceEntryIDType ep() const { return data_; }
+  TraceTimeType endTime() const { return static_cast<TraceTimeType>(data_); }
+  UserEventIDType userEvent() const {
+    return static_cast<UserEventIDType>(data_);
+  }
+  int32_t userData() const { return static_cast<int32_t>(data_); }
+  bool userStart() const { return flags_ & user_start_flag; }
+  bool sampled() const { return flags_ & sampled_flag; }
+
+  void setMsgLen(TraceMsgLenType const len) {
+    // Saturate: Projections only uses the length for display
+    auto const max = std::numeric_limits<uint32_t>::max();
+    aux_ = len > max ? max : static_cast<uint32_t>(len);
+  }
+
+  static constexpr uint8_t const user_start_flag = 0x1;
+  // Processing event kept by --vt_trace_sample; stands for that many executions
+  static constexpr uint8_t const sampled_flag    = 0x2;
+
+  TraceTimeType time_      = 0;
+  uint64_t data_           = 0;
+  TraceEventIDType event_  = no_trace_event;
+  uint32_t aux_            = 0;
+  TraceIndexType index_    = no_trace_index;
+  NodeType node_           = uninitialized_destination;
+  int8_t type_             = -1;
+  uint8_t flags_           = 0;
+};
+
+static_assert(sizeof(TraceRecord) == 32, "Trace records must stay 32 bytes");
+static_assert(
+  std::is_trivially_copyable<TraceRecord>::value,
+  "Trace records must be trivially copyable"
+);
+
+}} //end namespace vt::trace
+
+#endif /*INCLUDED_TRACE_TRACE_RECORD_H*/
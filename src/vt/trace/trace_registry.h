@@ -52,6 +52,8 @@
 #include "vt/trace/trace_event.h"
 #include "vt/trace/trace_containers.h"
 
+#include <string>
+
 namespace vt { namespace trace {
 
 struct TraceRegistry {
@@ -115,6 +117,27 @@ struct TraceRegistry {
     return new_event.theEventId();
   }
 
+  /*
+   * Full "<type>::<name>" of a registered entry point, used to match trace
+   * filters against handler names; empty if the entry is unknown
+   */
+  static std::string getEventFullName(TraceEntryIDType const ep) {
+    auto const event_iter = TraceContainersType::getEventContainer().find(ep);
+    if (event_iter == TraceContainersType::getEventContainer().end()) {
+      return "";
+    }
+
+    auto const& event = event_iter->second;
+    auto const type_iter = TraceContainersType::getEventTypeContainer().find(
+      event.theEventTypeId()
+    );
+    auto const type_name =
+      type_iter == TraceContainersType::getEventTypeContainer().end() ?
+      std::string{} : type_iter->second.theEventName();
+
+    return type_name + "::" + event.theEventName();
+  }
+
 };
 
 }} //end namespace vt::trace
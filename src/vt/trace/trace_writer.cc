@@ -0,0 +1,126 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               trace_writer.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#include "vt/config.h"
+#include "vt/trace/trace_writer.h"
+
+namespace vt { namespace trace {
+
+TraceOverflowPolicy getOverflowPolicy(std::string const& name) {
+  if (name == "block") {
+    return TraceOverflowPolicy::Block;
+  } else if (name == "drop") {
+    return TraceOverflowPolicy::Drop;
+  } else if (name == "sample") {
+    return TraceOverflowPolicy::Sample;
+  }
+
+  vtAbort(
+    fmt::format("Unknown policy \"{}\" for --vt_trace_stream_policy", name)
+  );
+  return TraceOverflowPolicy::Block;
+}
+
+TraceWriter::TraceWriter(WriteFnType in_write, std::size_t in_budget)
+  : write_(in_write), budget_(in_budget), thread_(&TraceWriter::run, this)
+{ }
+
+TraceWriter::~TraceWriter() {
+  stop();
+}
+
+bool TraceWriter::enqueue(std::string&& chunk, bool block) {
+  auto const size = chunk.size();
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto fits = [&]{
+    return queue_.empty() or queued_bytes_ + size <= budget_;
+  };
+  if (not fits()) {
+    if (not block) {
+      return false;
+    }
+    room_cv_.wait(lock, fits);
+  }
+  queued_bytes_ += size;
+  queue_.emplace_back(std::move(chunk));
+  lock.unlock();
+  work_cv_.notify_one();
+  return true;
+}
+
+void TraceWriter::stop() {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stopping_ = true;
+  }
+  work_cv_.notify_one();
+  if (thread_.joinable()) {
+    thread_.join();
+  }
+}
+
+void TraceWriter::run() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  while (true) {
+    work_cv_.wait(lock, [this]{ return stopping_ or not queue_.empty(); });
+    if (queue_.empty()) {
+      // stopping with nothing left to write
+      return;
+    }
+
+    // Write outside the lock; the chunk stays in the queue, and counted
+    // against the budget, until it is written
+    auto& chunk = queue_.front();
+    lock.unlock();
+    write_(chunk.data(), chunk.size());
+    lock.lock();
+
+    queued_bytes_ -= chunk.size();
+    queue_.pop_front();
+    room_cv_.notify_all();
+  }
+}
+
+}} //end namespace vt::trace
@@ -0,0 +1,121 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                trace_writer.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#if !defined INCLUDED_TRACE_TRACE_WRITER_H
+#define INCLUDED_TRACE_TRACE_WRITER_H
+
+#include "vt/config.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace vt { namespace trace {
+
+/*
+ * What the trace does with a full chunk when the writer is so far behind that
+ * queuing it would go over the memory budget:
+ *   Block  -> wait for the writer to catch up; nothing is lost
+ *   Drop   -> throw the chunk away
+ *   Sample -> throw it away, but let one in trace_stream_sample_stride through
+ *             (waiting for it) so the whole run stays covered
+ */
+enum struct TraceOverflowPolicy : int8_t {
+  Block, Drop, Sample
+};
+
+TraceOverflowPolicy getOverflowPolicy(std::string const& name);
+
+/*
+ * Background thread that hands trace chunks, in order, to a write function
+ * (compressing into the .log.gz, or appending to the binary trace). The write
+ * function is only called from the writer thread, until stop() returns.
+ */
+struct TraceWriter {
+  using WriteFnType = std::function<void(char const*, std::size_t)>;
+
+  TraceWriter(WriteFnType in_write, std::size_t in_budget);
+
+  TraceWriter(TraceWriter const&) = delete;
+  TraceWriter& operator=(TraceWriter const&) = delete;
+
+  ~TraceWriter();
+
+  /*
+   * Queue a chunk for writing. When it does not fit in the budget, either wait
+   * for room (block = true) or return false without taking it. A chunk larger
+   * than the whole budget is taken as soon as the queue is empty.
+   */
+  bool enqueue(std::string&& chunk, bool block);
+
+  /*
+   * Write out everything queued and join the thread
+   */
+  void stop();
+
+  std::size_t getBudget() const { return budget_; }
+
+private:
+  void run();
+
+private:
+  WriteFnType write_            = nullptr;
+  std::size_t budget_           = 0;
+  std::size_t queued_bytes_     = 0;
+  bool stopping_                = false;
+  std::deque<std::string> queue_;
+  std::mutex mutex_;
+  std::condition_variable work_cv_;
+  std::condition_variable room_cv_;
+  std::thread thread_;
+};
+
+}} //end namespace vt::trace
+
+#endif /*INCLUDED_TRACE_TRACE_WRITER_H*/
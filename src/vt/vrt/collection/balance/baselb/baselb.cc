@@ -55,7 +55,11 @@
 #include "vt/collective/reduce/reduce.h"
 #include "vt/collective/collective_alg.h"
 #include "vt/vrt/collection/balance/lb_common.h"
+#include "vt/configs/arguments/args.h"
 
+#include <algorithm>
+#include <array>
+#include <cstdio>
 #include <tuple>
 
 namespace vt { namespace vrt { namespace collection { namespace lb {
@@ -69,11 +73,29 @@ void BaseLB::startLBHandler(
 
   readLB(phase_);
 
+  if (balance::ProcStats::deferringMigrations()) {
+    reserveEpochs();
+  }
+
   vtAssertExpr(balance::ProcStats::proc_data_.size() >= phase_);
 
-  auto const& in_load_stats = balance::ProcStats::proc_data_[phase_];
+  auto const& in_load_stats = balance::ProcStats::getPredictedLoad(phase_);
   auto const& in_comm_stats = balance::ProcStats::proc_comm_[phase_];
-  importProcessorData(in_load_stats, in_comm_stats);
+  if (balance::ProcStats::deferringMigrations()) {
+    // The next phase keeps adding stats while this LB runs, which may
+    // reallocate the per-phase maps under us: work from a copy
+    async_load_data_ = in_load_stats;
+    async_comm_data_ = in_comm_stats;
+    importProcessorData(async_load_data_, async_comm_data_);
+  } else {
+    importProcessorData(in_load_stats, in_comm_stats);
+  }
+
+  // Memory held by the objects living here, for --vt_lb_memory_capacity
+  memory_usage_ = 0;
+  for (auto&& elm : *load_data) {
+    memory_usage_ += balance::ProcStats::getFootprint(elm.first);
+  }
   computeStatistics();
 }
 
@@ -202,8 +224,35 @@ EpochType BaseLB::getMigrationEpoch() const {
   return migration_epoch_;
 }
 
+void BaseLB::reserveEpochs() {
+  auto const num_epochs = getMaxStageEpochs() + 1;
+  for (int32_t i = 0; i < num_epochs; i++) {
+    reserved_epochs_.push_back(theTerm()->makeEpochCollective());
+  }
+}
+
+void BaseLB::releaseEpochs() {
+  for (auto&& epoch : reserved_epochs_) {
+    theTerm()->finishedEpoch(epoch);
+  }
+  reserved_epochs_.clear();
+}
+
+EpochType BaseLB::makeCollectiveEpoch() {
+  if (reserved_epochs_.empty()) {
+    vtAssert(
+      not balance::ProcStats::deferringMigrations(),
+      "An overlapped LB must not use more epochs than it reserved"
+    );
+    return theTerm()->makeEpochCollective();
+  }
+  auto const epoch = reserved_epochs_.front();
+  reserved_epochs_.pop_front();
+  return epoch;
+}
+
 EpochType BaseLB::startMigrationCollective() {
-  migration_epoch_ = theTerm()->makeEpochCollective();
+  migration_epoch_ = makeCollectiveEpoch();
   theTerm()->addAction(migration_epoch_, [this]{ this->migrationDone(); });
   theMsg()->pushEpoch(migration_epoch_);
   return migration_epoch_;
@@ -242,6 +291,37 @@ void BaseLB::transferMigrations(TransferMsg<TransferVecType>* msg) {
   }
 }
 
+bool BaseLB::migrationPaysOff(ObjIDType const obj_id) {
+  using ArgType = vt::arguments::ArgConfig;
+
+  auto const horizon = ArgType::vt_lb_migration_horizon;
+  if (not migration_cost_aware_ or horizon <= 0) {
+    return true;
+  }
+
+  auto const bytes = balance::ProcStats::getFootprint(obj_id);
+  auto const cost = bytes / ArgType::vt_lb_migration_bandwidth;
+  auto const load_iter = load_data->find(obj_id);
+  auto const load = load_iter != load_data->end() ? load_iter->second : 0.0;
+
+  // Moving the object saves at most the part of its load that this processor
+  // has in excess, every phase until the horizon
+  auto const saved = std::min(load, migration_excess_);
+  auto const pays_off = cost <= 0.0 or saved * horizon > cost;
+
+  debug_print(
+    lb, node,
+    "migrationPaysOff: obj_id={}, bytes={}, cost={}, load={}, excess={}, "
+    "pays_off={}\n",
+    obj_id, bytes, cost, load, migration_excess_, pays_off
+  );
+
+  if (pays_off) {
+    migration_excess_ -= saved;
+  }
+  return pays_off;
+}
+
 void BaseLB::migrateObjectTo(ObjIDType const obj_id, NodeType const to) {
   auto& migrator = balance::ProcStats::proc_migrate_;
   auto iter = migrator.find(obj_id);
@@ -253,33 +333,93 @@ void BaseLB::migrateObjectTo(ObjIDType const obj_id, NodeType const to) {
     obj_id, from, to, iter != migrator.end()
   );
 
-  local_migration_count_++;
+  // The cost is judged where the object lives, which knows its size
+  if (iter != migrator.end() and not migrationPaysOff(obj_id)) {
+    local_migration_rejected_++;
+    return;
+  }
+
+  auto const this_node = theContext()->getNode();
+  bool const check_memory =
+    arguments::ArgConfig::vt_lb_memory_capacity > 0 and not memory_aware_;
 
   if (iter == migrator.end()) {
     off_node_migrate_[from].push_back(std::make_tuple(obj_id,to));
+  } else if (check_memory and to != this_node) {
+    // The object only moves once the destination has made room for it
+    auto const bytes = balance::ProcStats::getFootprint(obj_id);
+    auto msg = makeMessage<MemoryReserveMsg>(obj_id, this_node, to, bytes);
+    proxy_[to].template send<MemoryReserveMsg,&BaseLB::reserveMemory>(msg);
+  } else {
+    executeMigration(obj_id, to);
+  }
+}
+
+void BaseLB::executeMigration(ObjIDType const obj_id, NodeType const to) {
+  auto iter = balance::ProcStats::proc_migrate_.find(obj_id);
+  vtAssert(iter != balance::ProcStats::proc_migrate_.end(), "Must live here");
+
+  local_migration_count_++;
+  local_migration_bytes_ += balance::ProcStats::getFootprint(obj_id);
+  if (balance::ProcStats::deferringMigrations()) {
+    balance::ProcStats::deferMigration(obj_id, to);
   } else {
     iter->second(to);
   }
 }
 
+void BaseLB::reserveMemory(MemoryReserveMsg* msg) {
+  auto const capacity = arguments::ArgConfig::vt_lb_memory_capacity;
+  bool const fits = memory_usage_ + msg->bytes_ <= capacity;
+
+  debug_print(
+    lb, node,
+    "reserveMemory: obj_id={}, from={}, bytes={}, usage={}, fits={}\n",
+    msg->obj_, msg->from_, msg->bytes_, memory_usage_, fits
+  );
+
+  if (fits) {
+    memory_usage_ += msg->bytes_;
+  }
+
+  auto reply = makeMessage<MemoryReserveMsg>(
+    msg->obj_, msg->from_, msg->to_, msg->bytes_, fits
+  );
+  proxy_[msg->from_].template send<MemoryReserveMsg,&BaseLB::reservedMemory>(
+    reply
+  );
+}
+
+void BaseLB::reservedMemory(MemoryReserveMsg* msg) {
+  if (msg->accepted_) {
+    memory_usage_ -= msg->bytes_;
+    executeMigration(msg->obj_, msg->to_);
+  } else {
+    local_memory_rejected_++;
+  }
+}
+
 void BaseLB::finalize(CountMsg* msg) {
-  auto global_count = msg->getVal();
+  auto const& global = msg->getConstVal();
   auto const& this_node = theContext()->getNode();
   debug_print(
     lb, node,
-    "BaseLB::finalize: finished migrations: local migration count={}\n",
-    local_migration_count_
+    "BaseLB::finalize: finished migrations: local migration count={}, "
+    "bytes={}\n",
+    local_migration_count_, local_migration_bytes_
   );
   if (this_node == 0) {
     auto const total_time = timing::Timing::getCurrentTime() - start_time_;
     vt_print(
       lb,
-      "BaseLB::finalize: LB total time={}, total migration count={}\n",
-      total_time, global_count
+      "BaseLB::finalize: LB total time={}, total migration count={}, "
+      "bytes migrated={}, rejected by cost={}, rejected by memory={}\n",
+      total_time, global[0], global[1], global[2], global[3]
     );
     fflush(stdout);
   }
-  balance::ProcStats::startIterCleanup();
+  releaseEpochs();
+  balance::LBManager::recordMigrationTotals(global);
   balance::LBManager::finishedRunningLB(phase_);
 }
 
@@ -290,8 +430,11 @@ void BaseLB::migrationDone() {
     local_migration_count_
   );
   auto cb = vt::theCB()->makeBcast<BaseLB, CountMsg, &BaseLB::finalize>(proxy_);
-  auto msg = makeMessage<CountMsg>(local_migration_count_);
-  proxy_.template reduce<collective::PlusOp<int32_t>>(msg,cb);
+  auto msg = makeMessage<CountMsg>(
+    local_migration_count_, local_migration_bytes_, local_migration_rejected_,
+    local_memory_rejected_
+  );
+  proxy_.template reduce<collective::PlusOp<std::array<int64_t, 4>>>(msg,cb);
 }
 
 NodeType BaseLB::objGetNode(ObjIDType const id) const {
@@ -299,6 +442,12 @@ NodeType BaseLB::objGetNode(ObjIDType const id) const {
 }
 
 void BaseLB::finishedStats() {
+  // Load this processor has above the average, in seconds like `load_data`;
+  // migrations that do not reduce it buy nothing. Set before any LB work so
+  // that migration requests arriving early see it
+  auto const avg = stats.at(Statistic::P_l).at(StatisticQuantity::avg);
+  migration_excess_ = std::max(0.0, this_load - avg) / 1000;
+
   this->runLB();
 }
 
@@ -310,12 +459,145 @@ void BaseLB::computeStatistics() {
 
   computeStatisticsOver(Statistic::P_l);
   computeStatisticsOver(Statistic::O_l);
+  computeStatisticsOver(Statistic::PredictionError);
 
   if (comm_aware_) {
     computeStatisticsOver(Statistic::P_c);
     computeStatisticsOver(Statistic::O_c);
+    computeStatisticsOver(Statistic::EdgeRatio);
   }
   // @todo: add P_c, P_t, O_c, O_t
+
+  if (arguments::ArgConfig::vt_lb_stats_json != "") {
+    computeSummary();
+  }
+}
+
+double BaseLB::predictionError() const {
+  auto const& errs = balance::ProcStats::proc_pred_err_;
+  auto const& measured = balance::ProcStats::getMeasuredLoad(phase_);
+  double err = 0.0, total = 0.0;
+  if (errs.size() > phase_) {
+    for (auto&& elm : errs[phase_]) {
+      err += elm.second;
+      total += measured.at(elm.first);
+    }
+  }
+  return total > 0.0 ? err / total : 0.0;
+}
+
+void BaseLB::computeSummary() {
+  using balance::LoadData;
+
+  auto const this_node = theContext()->getNode();
+  auto const top_k = std::max(arguments::ArgConfig::vt_lb_stats_top_k, 0);
+  balance::StatsSummary summary{static_cast<std::size_t>(top_k)};
+
+  // Objects: loads in seconds, as the balancers see them
+  auto const& temp_to_perm = balance::ProcStats::proc_temp_to_perm_;
+  auto const& collection = balance::ProcStats::proc_collection_;
+  LoadData obj_load;
+  TimeType proc_load = 0.0;
+  for (auto&& elm : *load_data) {
+    auto const perm_iter = temp_to_perm.find(elm.first);
+    auto const col_iter = collection.find(elm.first);
+    summary.addObject(
+      perm_iter != temp_to_perm.end() ? perm_iter->second : elm.first,
+      this_node, elm.second,
+      col_iter != collection.end() ? col_iter->second : no_vrt_proxy
+    );
+    obj_load = obj_load + LoadData(elm.second);
+    proc_load += elm.second;
+  }
+  summary.addProcessor(proc_load);
+
+  // Edges: object-to-object bytes received, per object and per edge
+  std::unordered_map<ObjIDType,double> obj_comm_bytes;
+  LoadData edge_bytes;
+  double proc_comm = 0.0, off_node = 0.0, total = 0.0;
+  int64_t num_edges = 0, num_external = 0;
+  for (auto&& elm : *comm_data) {
+    auto const& key = elm.first;
+    if (not (not comm_collectives_ and isCollectiveComm(key.cat_)) and
+        not key.onNode() and not key.selfEdge()) {
+      proc_comm += elm.second;
+    }
+    if (key.cat_ != balance::CommCategory::SendRecv or key.selfEdge()) {
+      continue;
+    }
+    obj_comm_bytes[key.toObj()] += elm.second;
+    edge_bytes = edge_bytes + LoadData(elm.second);
+    total += elm.second;
+    num_edges++;
+    if (key.offNode()) {
+      off_node += elm.second;
+      num_external++;
+    }
+  }
+  LoadData obj_comm;
+  for (auto&& elm : obj_comm_bytes) {
+    obj_comm = obj_comm + LoadData(elm.second);
+  }
+
+  summary.addStatistic(Statistic::P_l, LoadData(proc_load));
+  summary.addStatistic(Statistic::O_l, obj_load);
+  summary.addStatistic(Statistic::P_c, LoadData(proc_comm));
+  summary.addStatistic(Statistic::O_c, edge_bytes);
+  summary.addStatistic(
+    Statistic::ObjectCardinality, LoadData(load_data->size())
+  );
+  summary.addStatistic(Statistic::EdgeCardinality, LoadData(num_edges));
+  summary.addStatistic(
+    Statistic::ExternalEdgesCardinality, LoadData(num_external)
+  );
+  summary.addStatistic(
+    Statistic::InternalEdgesCardinality, LoadData(num_edges - num_external)
+  );
+  summary.addStatistic(
+    Statistic::EdgeRatio, LoadData(total > 0.0 ? off_node / total : 0.0)
+  );
+  summary.addStatistic(Statistic::PredictionError, LoadData(predictionError()));
+
+  // W_*: each processor's own statistic of its objects, distributed over the
+  // processors; a processor without objects has nothing to contribute
+  if (obj_load.N_ > 0) {
+    summary.addStatistic(Statistic::W_l_min,      LoadData(obj_load.min()));
+    summary.addStatistic(Statistic::W_l_max,      LoadData(obj_load.max()));
+    summary.addStatistic(Statistic::W_l_avg,      LoadData(obj_load.avg()));
+    summary.addStatistic(Statistic::W_l_std,      LoadData(obj_load.stdv()));
+    summary.addStatistic(Statistic::W_l_var,      LoadData(obj_load.var()));
+    summary.addStatistic(Statistic::W_l_skewness, LoadData(obj_load.skew()));
+    summary.addStatistic(Statistic::W_l_kurtosis, LoadData(obj_load.krte()));
+  }
+  if (obj_comm.N_ > 0) {
+    summary.addStatistic(Statistic::W_c_min,      LoadData(obj_comm.min()));
+    summary.addStatistic(Statistic::W_c_max,      LoadData(obj_comm.max()));
+    summary.addStatistic(Statistic::W_c_avg,      LoadData(obj_comm.avg()));
+    summary.addStatistic(Statistic::W_c_std,      LoadData(obj_comm.stdv()));
+    summary.addStatistic(Statistic::W_c_var,      LoadData(obj_comm.var()));
+    summary.addStatistic(Statistic::W_c_skewness, LoadData(obj_comm.skew()));
+    summary.addStatistic(Statistic::W_c_kurtosis, LoadData(obj_comm.krte()));
+  }
+
+  using MsgType = balance::StatsSummaryMsg;
+  auto cb = vt::theCB()->makeSend<MsgType, &BaseLB::summaryHandler>(0);
+  auto msg = makeMessage<MsgType>(std::move(summary), phase_);
+  proxy_.template reduce<collective::PlusOp<balance::StatsSummary>>(msg,cb);
+}
+
+/*static*/ void BaseLB::summaryHandler(balance::StatsSummaryMsg* msg) {
+  auto const file_name = arguments::ArgConfig::vt_lb_stats_json;
+  auto const line = msg->getConstVal().toJSON(msg->phase_);
+
+  debug_print(
+    lb, node,
+    "BaseLB::summaryHandler: phase={}, file={}\n", msg->phase_, file_name
+  );
+
+  auto file = fopen(file_name.c_str(), "a");
+  vtAssert(file != nullptr, "Must be able to open the LB statistics file");
+  fprintf(file, "%s\n", line.c_str());
+  fclose(file);
 }
 
 balance::LoadData BaseLB::reduceVec(std::vector<balance::LoadData>&& vec) const {
@@ -382,6 +664,34 @@ void BaseLB::computeStatisticsOver(Statistic stat) {
     proxy_.template reduce<ReduceOp>(msg,cb);
   }
   break;
+  case Statistic::EdgeRatio: {
+    // Perform the reduction for EdgeRatio -> fraction of the object-to-object
+    // bytes received on this processor that crossed a node boundary
+    double off_node = 0.0, total = 0.0;
+    for (auto&& elm : *comm_data) {
+      if (elm.first.cat_ != balance::CommCategory::SendRecv or
+          elm.first.selfEdge()) {
+        continue;
+      }
+      total += elm.second;
+      if (elm.first.offNode()) {
+        off_node += elm.second;
+      }
+    }
+    auto const ratio = total > 0.0 ? off_node / total : 0.0;
+    auto msg = makeMessage<StatsMsgType>(Statistic::EdgeRatio, ratio);
+    proxy_.template reduce<ReduceOp>(msg,cb);
+  }
+  break;
+  case Statistic::PredictionError: {
+    // Perform the reduction for PredictionError -> error of the load model's
+    // prediction for this phase relative to the load measured on this
+    // processor
+    auto const ratio = predictionError();
+    auto msg = makeMessage<StatsMsgType>(Statistic::PredictionError, ratio);
+    proxy_.template reduce<ReduceOp>(msg,cb);
+  }
+  break;
   case Statistic::O_l: {
     // Perform the reduction for O_l -> object load only
     std::vector<balance::LoadData> lds;
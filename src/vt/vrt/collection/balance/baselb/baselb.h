@@ -51,8 +51,10 @@
 #include "vt/vrt/collection/balance/baselb/baselb_msgs.h"
 #include "vt/vrt/collection/balance/proc_stats.h"
 #include "vt/vrt/collection/balance/lb_comm.h"
+#include "vt/vrt/collection/balance/stats_summary.h"
 #include "vt/objgroup/headers.h"
 
+#include <deque>
 #include <set>
 #include <map>
 #include <unordered_map>
@@ -98,20 +100,35 @@ struct BaseLB {
   NodeType objGetNode(ObjIDType const id) const;
 
   EpochType getMigrationEpoch() const;
+  EpochType makeCollectiveEpoch();
   EpochType startMigrationCollective();
   void finishMigrationCollective();
   void migrationDone();
   void migrateObjectTo(ObjIDType const obj_id, NodeType const node);
   void transferSend(NodeType from, TransferVecType const& transfer, EpochType ep);
   void transferMigrations(TransferMsg<TransferVecType>* msg);
+  void reserveMemory(MemoryReserveMsg* msg);
+  void reservedMemory(MemoryReserveMsg* msg);
   void finalize(CountMsg* msg);
 
+  /*
+   * Reduce the whole LB statistics summary to node 0 in one pass and append
+   * it as a JSON line to --vt_lb_stats_json
+   */
+  void computeSummary();
+  static void summaryHandler(balance::StatsSummaryMsg* msg);
+
   virtual void runLB() = 0;
 
 private:
+  bool migrationPaysOff(ObjIDType const obj_id);
+  void executeMigration(ObjIDType const obj_id, NodeType const to);
+  void reserveEpochs();
+  void releaseEpochs();
   balance::LoadData reduceVec(std::vector<balance::LoadData>&& vec) const;
   bool isCollectiveComm(balance::CommCategory cat) const;
   void computeStatisticsOver(Statistic stats);
+  double predictionError() const;
   void readLB(PhaseType phase);
 
 protected:
@@ -119,6 +136,12 @@ protected:
   virtual double getDefaultMaxThreshold()  const = 0;
   virtual bool   getDefaultAutoThreshold() const = 0;
 
+  /*
+   * Most collective epochs runLB may take from makeCollectiveEpoch, not
+   * counting the migration epoch
+   */
+  virtual int32_t getMaxStageEpochs() const { return 0; }
+
 protected:
   double max_threshold                  = 0.0f;
   double min_threshold                  = 0.0f;
@@ -129,6 +152,8 @@ protected:
   LoadType this_load                    = 0.0f;
   ElementLoadType const* load_data      = nullptr;
   ElementCommType const* comm_data      = nullptr;
+  ElementLoadType async_load_data_      = {};
+  ElementCommType async_comm_data_      = {};
   StatisticMapType stats                = {};
   EpochType migration_epoch_            = no_epoch;
   TransferType off_node_migrate_        = {};
@@ -138,6 +163,20 @@ protected:
   int32_t num_reduce_stats_             = 0;
   bool comm_aware_                      = false;
   bool comm_collectives_                = false;
+  bool migration_cost_aware_            = false;
+  LoadType migration_excess_            = 0.0f;
+  int64_t local_migration_bytes_        = 0;
+  int64_t local_migration_rejected_     = 0;
+  // Set by balancers whose assignment already respects
+  // --vt_lb_memory_capacity; the others get each transfer checked by the
+  // destination before the object moves
+  bool memory_aware_                    = false;
+  int64_t memory_usage_                 = 0;
+  int64_t local_memory_rejected_        = 0;
+  // An overlapped LB runs alongside a phase that may create collective epochs
+  // of its own, which would interleave with ours differently on each node; so
+  // all of ours are created up front at the phase boundary
+  std::deque<EpochType> reserved_epochs_ = {};
 };
 
 }}}} /* end namespace vt::vrt::collection::balance::lb */
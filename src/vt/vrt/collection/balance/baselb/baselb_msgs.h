@@ -48,6 +48,9 @@
 #include "vt/config.h"
 #include "vt/messaging/message.h"
 #include "vt/collective/reduce/reduce.h"
+#include "vt/vrt/collection/balance/lb_common.h"
+
+#include <array>
 
 namespace vt { namespace vrt { namespace collection { namespace lb {
 
@@ -69,13 +72,41 @@ private:
   Transfer transfer_;
 };
 
-struct CountMsg : vt::collective::ReduceTMsg<int32_t> {
+/*
+ * Migration totals: number of migrations, bytes migrated, migrations rejected
+ * by the migration cost model, and transfers rejected for lack of memory
+ */
+struct CountMsg : vt::collective::ReduceTMsg<std::array<int64_t, 4>> {
   CountMsg() = delete;
-  explicit CountMsg(int32_t in_num)
-    : vt::collective::ReduceTMsg<int32_t>(in_num)
+  CountMsg(
+    int64_t in_num, int64_t in_bytes, int64_t in_rejected,
+    int64_t in_mem_rejected
+  ) : vt::collective::ReduceTMsg<std::array<int64_t, 4>>(
+        std::array<int64_t, 4>{{in_num, in_bytes, in_rejected, in_mem_rejected}}
+      )
   {}
 };
 
+/*
+ * Asks the destination of a migration to reserve memory for the object, and
+ * carries the answer back to the node holding it
+ */
+struct MemoryReserveMsg : vt::Message {
+  MemoryReserveMsg() = default;
+  MemoryReserveMsg(
+    balance::ElementIDType in_obj, NodeType in_from, NodeType in_to,
+    int64_t in_bytes, bool in_accepted = false
+  ) : obj_(in_obj), from_(in_from), to_(in_to), bytes_(in_bytes),
+      accepted_(in_accepted)
+  { }
+
+  balance::ElementIDType obj_ = 0;
+  NodeType from_ = uninitialized_destination;
+  NodeType to_ = uninitialized_destination;
+  int64_t bytes_ = 0;
+  bool accepted_ = false;
+};
+
 }}}} /* end namespace vt::vrt::collection::lb */
 
 #endif /*INCLUDED_VT_VRT_COLLECTION_BALANCE_BASELB_BASELB_MSGS_H*/
@@ -0,0 +1,413 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                  commlb.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/vrt/collection/balance/baselb/baselb.h"
+#include "vt/vrt/collection/balance/commlb/commlb.h"
+#include "vt/vrt/collection/balance/commlb/commlb_msgs.h"
+#include "vt/context/context.h"
+#include "vt/messaging/active.h"
+#include "vt/termination/termination.h"
+#include "vt/pipe/pipe_manager.h"
+
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace vt { namespace vrt { namespace collection { namespace lb {
+
+void CommLB::init(objgroup::proxy::Proxy<CommLB> in_proxy) {
+  proxy = in_proxy;
+  gen_.seed(seed_());
+}
+
+void CommLB::runLB() {
+  auto const& this_node = theContext()->getNode();
+  avg_ = stats.at(lb::Statistic::P_l).at(lb::StatisticQuantity::avg);
+  auto const max = stats.at(lb::Statistic::P_l).at(lb::StatisticQuantity::max);
+  cap_ = avg_ * (1.0 + max_threshold);
+  this_new_load_ = this_load;
+
+  for (auto&& stat : *load_data) {
+    obj_load_[stat.first] = loadMilli(stat.second);
+    obj_loc_[stat.first] = this_node;
+  }
+
+  if (avg_ < 0.0000000001) {
+    num_iters_ = 0;
+  }
+
+  if (this_node == 0) {
+    vt_print(
+      lb,
+      "CommLB::runLB: avg={:.2f}, max={:.2f}, cap={:.2f}, iters={}\n",
+      avg_, max, cap_, num_iters_
+    );
+    fflush(stdout);
+  }
+
+  exchangeEdges();
+}
+
+void CommLB::exchangeEdges() {
+  auto const& this_node = theContext()->getNode();
+
+  auto const edge_epoch = makeCollectiveEpoch();
+  theTerm()->addAction(edge_epoch, [this]{ this->doIteration(); });
+  theMsg()->pushEpoch(edge_epoch);
+
+  // Communication is recorded where it was received; the owner of the sending
+  // object needs the edge too, so the graph is symmetric before refinement
+  std::map<NodeType, EdgeVecType> remote;
+  for (auto&& elm : *comm_data) {
+    auto const& key = elm.first;
+    if (key.cat_ != balance::CommCategory::SendRecv or key.selfEdge()) {
+      continue;
+    }
+    auto const from = key.fromObjTemp();
+    auto const to = key.toObjTemp();
+    auto const bytes = elm.second;
+    if (obj_load_.find(to) != obj_load_.end()) {
+      graph_[to][from] += bytes;
+    }
+    auto const from_node = objGetNode(from);
+    if (from_node == this_node) {
+      if (obj_load_.find(from) != obj_load_.end()) {
+        graph_[from][to] += bytes;
+      }
+    } else {
+      remote[from_node].emplace_back(std::make_tuple(from, to, bytes));
+    }
+  }
+
+  for (auto&& elm : remote) {
+    auto msg = makeMessage<CommEdgeMsg>(elm.second);
+    proxy[elm.first].template send<CommEdgeMsg, &CommLB::edgesHandler>(msg);
+  }
+
+  theMsg()->popEpoch(edge_epoch);
+  theTerm()->finishedEpoch(edge_epoch);
+}
+
+void CommLB::edgesHandler(CommEdgeMsg* msg) {
+  for (auto&& edge : msg->getEdges()) {
+    auto const from = std::get<0>(edge);
+    if (obj_load_.find(from) != obj_load_.end()) {
+      graph_[from][std::get<1>(edge)] += std::get<2>(edge);
+    }
+  }
+}
+
+void CommLB::doIteration() {
+  if (iter_ < num_iters_) {
+    auto const iter_epoch = makeCollectiveEpoch();
+    theTerm()->addAction(iter_epoch, [this]{
+      this->iter_++;
+      this->doIteration();
+    });
+    theMsg()->pushEpoch(iter_epoch);
+    proposeMoves();
+    theMsg()->popEpoch(iter_epoch);
+    theTerm()->finishedEpoch(iter_epoch);
+  } else {
+    reportCut();
+  }
+}
+
+NodeType CommLB::curNode(ObjIDType obj) const {
+  auto iter = obj_loc_.find(obj);
+  if (iter != obj_loc_.end()) {
+    return iter->second;
+  }
+  auto nbr_iter = nbr_loc_.find(obj);
+  if (nbr_iter != nbr_loc_.end()) {
+    return nbr_iter->second;
+  }
+  return objGetNode(obj);
+}
+
+void CommLB::proposeMoves() {
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
+
+  if (num_nodes < 2) {
+    return;
+  }
+
+  struct Candidate {
+    ObjIDType obj;
+    NodeType dest;
+    double gain;
+    double load;
+  };
+
+  std::vector<Candidate> cands;
+  bool const overloaded = this_new_load_ > cap_;
+
+  for (auto&& elm : obj_load_) {
+    auto const obj = elm.first;
+    if (obj_loc_[obj] != this_node) {
+      continue;
+    }
+
+    // Bytes this object exchanges with each node under the current mapping
+    std::unordered_map<NodeType, double> bytes_to;
+    auto graph_iter = graph_.find(obj);
+    if (graph_iter != graph_.end()) {
+      for (auto&& nbr : graph_iter->second) {
+        bytes_to[curNode(nbr.first)] += nbr.second;
+      }
+    }
+
+    auto const internal_iter = bytes_to.find(this_node);
+    double const internal =
+      internal_iter != bytes_to.end() ? internal_iter->second : 0.0;
+
+    NodeType best_node = uninitialized_destination;
+    double best_gain = std::numeric_limits<double>::lowest();
+    for (auto&& to : bytes_to) {
+      if (to.first == this_node) {
+        continue;
+      }
+      auto const gain = to.second - internal;
+      if (gain > best_gain or (gain == best_gain and to.first < best_node)) {
+        best_node = to.first;
+        best_gain = gain;
+      }
+    }
+
+    // An object with no off-node neighbors can still be shed by an overloaded
+    // node; any other node is as good as another for communication
+    if (best_node == uninitialized_destination and overloaded) {
+      std::uniform_int_distribution<NodeType> dist(0, num_nodes - 2);
+      NodeType const pick = dist(gen_);
+      best_node = pick >= this_node ? pick + 1 : pick;
+      best_gain = -internal;
+    }
+
+    if (best_node != uninitialized_destination) {
+      cands.push_back(Candidate{obj, best_node, best_gain, elm.second});
+    }
+  }
+
+  std::sort(
+    cands.begin(), cands.end(), [](Candidate const& a, Candidate const& b) {
+      return a.gain > b.gain or (a.gain == b.gain and a.obj < b.obj);
+    }
+  );
+
+  // Neighbors on two nodes that both move toward each other in the same round
+  // would just swap places. Alternate the direction of improving moves by
+  // iteration to break the symmetry
+  bool const upward = iter_ % 2 == 0;
+  double to_shed = this_new_load_ - cap_;
+
+  std::map<NodeType, PropVecType> props;
+  for (auto&& c : cands) {
+    bool const improves =
+      c.gain > 0.0 and (upward ? c.dest > this_node : c.dest < this_node);
+    if (improves or to_shed > 0.0) {
+      props[c.dest].emplace_back(std::make_tuple(c.obj, c.load, c.gain));
+      to_shed -= c.load;
+    }
+  }
+
+  for (auto&& elm : props) {
+    debug_print(
+      lb, node,
+      "CommLB::proposeMoves: iter={}, to={}, num={}, load={}, cap={}\n",
+      iter_, elm.first, elm.second.size(), this_new_load_, cap_
+    );
+    auto msg = makeMessage<CommProposalMsg>(this_node, elm.second);
+    proxy[elm.first].template send<
+      CommProposalMsg, &CommLB::proposalHandler
+    >(msg);
+  }
+}
+
+void CommLB::proposalHandler(CommProposalMsg* msg) {
+  auto const& this_node = theContext()->getNode();
+  auto props = msg->getProposals();
+
+  std::sort(
+    props.begin(), props.end(), [](PropType const& a, PropType const& b) {
+      return std::get<2>(a) > std::get<2>(b) or
+        (std::get<2>(a) == std::get<2>(b) and std::get<0>(a) < std::get<0>(b));
+    }
+  );
+
+  ObjVecType accepted;
+  for (auto&& prop : props) {
+    auto const load = std::get<1>(prop);
+    if (this_new_load_ + load <= cap_) {
+      this_new_load_ += load;
+      accepted.push_back(std::get<0>(prop));
+    }
+  }
+
+  debug_print(
+    lb, node,
+    "CommLB::proposalHandler: from={}, proposed={}, accepted={}, load={}\n",
+    msg->getFromNode(), props.size(), accepted.size(), this_new_load_
+  );
+
+  if (accepted.size() > 0) {
+    auto reply = makeMessage<CommAcceptMsg>(this_node, accepted);
+    proxy[msg->getFromNode()].template send<
+      CommAcceptMsg, &CommLB::acceptHandler
+    >(reply);
+  }
+}
+
+void CommLB::acceptHandler(CommAcceptMsg* msg) {
+  auto const& this_node = theContext()->getNode();
+  auto const dest = msg->getFromNode();
+
+  std::map<NodeType, ObjLocType> notify;
+  for (auto&& obj : msg->getObjs()) {
+    obj_loc_[obj] = dest;
+    this_new_load_ -= obj_load_[obj];
+
+    auto graph_iter = graph_.find(obj);
+    if (graph_iter != graph_.end()) {
+      for (auto&& nbr : graph_iter->second) {
+        auto const owner = objGetNode(nbr.first);
+        if (owner != this_node) {
+          notify[owner][obj] = dest;
+        }
+      }
+    }
+  }
+
+  for (auto&& elm : notify) {
+    auto loc_msg = makeMessage<CommLocationMsg>(elm.second);
+    proxy[elm.first].template send<
+      CommLocationMsg, &CommLB::locationHandler
+    >(loc_msg);
+  }
+}
+
+void CommLB::locationHandler(CommLocationMsg* msg) {
+  for (auto&& elm : msg->getLocations()) {
+    nbr_loc_[elm.first] = elm.second;
+  }
+}
+
+double CommLB::cutBytes(bool after) const {
+  double cut = 0.0;
+  for (auto&& elm : *comm_data) {
+    auto const& key = elm.first;
+    if (key.cat_ != balance::CommCategory::SendRecv or key.selfEdge()) {
+      continue;
+    }
+    bool const crosses = after ?
+      curNode(key.fromObjTemp()) != curNode(key.toObjTemp()) :
+      key.offNode();
+    if (crosses) {
+      cut += elm.second;
+    }
+  }
+  return cut;
+}
+
+void CommLB::reportCut() {
+  using ReduceOp = collective::PlusOp<std::array<double, 3>>;
+
+  double total = 0.0;
+  for (auto&& elm : *comm_data) {
+    auto const& key = elm.first;
+    if (key.cat_ == balance::CommCategory::SendRecv and not key.selfEdge()) {
+      total += elm.second;
+    }
+  }
+
+  auto cb = theCB()->makeBcast<CommLB, CommCutMsg, &CommLB::cutHandler>(proxy);
+  auto msg = makeMessage<CommCutMsg>(cutBytes(false), cutBytes(true), total);
+  proxy.template reduce<ReduceOp>(msg,cb);
+}
+
+void CommLB::cutHandler(CommCutMsg* msg) {
+  auto const& val = msg->getConstVal();
+  auto const before = val[0];
+  auto const after = val[1];
+  auto const total = val[2];
+
+  if (theContext()->getNode() == 0) {
+    vt_print(
+      lb,
+      "CommLB: edge cut bytes: before={:.0f}, after={:.0f}, total={:.0f}, "
+      "{} before={:.3f}, after={:.3f}\n",
+      before, after, total, lb_stat_name_[Statistic::EdgeRatio],
+      total > 0.0 ? before / total : 0.0,
+      total > 0.0 ? after / total : 0.0
+    );
+    fflush(stdout);
+  }
+
+  migrate();
+}
+
+void CommLB::migrate() {
+  auto const& this_node = theContext()->getNode();
+
+  debug_print(
+    lb, node,
+    "CommLB::migrate: new_load={}, avg={}\n", this_new_load_, avg_
+  );
+
+  startMigrationCollective();
+
+  for (auto&& elm : obj_loc_) {
+    if (elm.second != this_node) {
+      migrateObjectTo(elm.first, elm.second);
+    }
+  }
+
+  finishMigrationCollective();
+}
+
+}}}} /* end namespace vt::vrt::collection::lb */
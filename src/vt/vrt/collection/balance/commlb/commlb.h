@@ -0,0 +1,129 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                   commlb.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_BALANCE_COMMLB_COMMLB_H
+#define INCLUDED_VT_VRT_COLLECTION_BALANCE_COMMLB_COMMLB_H
+
+#include "vt/config.h"
+#include "vt/vrt/collection/balance/baselb/baselb.h"
+#include "vt/vrt/collection/balance/commlb/commlb_constants.h"
+#include "vt/vrt/collection/balance/commlb/commlb_msgs.h"
+
+#include <random>
+#include <unordered_map>
+
+namespace vt { namespace vrt { namespace collection { namespace lb {
+
+/*
+ * CommLB: balances load while keeping heavily communicating objects together,
+ * using the object graph recorded in the per-phase CommMapType.
+ *
+ * Each object is owned by the node that held it at the start of the phase,
+ * and only the owner decides where it goes. The owner first learns the edges
+ * its objects send on (the comm data is recorded at the receiver). Then it
+ * runs a few rounds of distributed label propagation. Each object proposes to
+ * move to the node that holds most of its communication volume. The target
+ * accepts the proposal only if that keeps its load under
+ * avg * (1 + max_threshold). An overloaded node also proposes its best
+ * candidates when the gain is negative, so imbalance is corrected too.
+ * Accepted moves are pushed to the owners of the neighbors so their gains use
+ * fresh locations. Edge-cut bytes before and after are reported at the end.
+ */
+struct CommLB : BaseLB, CommLBTypes {
+  using ObjIDType  = CommLBTypes::ObjIDType;
+  using GraphType  = std::unordered_map<
+    ObjIDType, std::unordered_map<ObjIDType, double>
+  >;
+
+  CommLB() : BaseLB(true) { }
+  CommLB(CommLB const&) = delete;
+  CommLB(CommLB&&) = default;
+
+  void init(objgroup::proxy::Proxy<CommLB> in_proxy);
+  void runLB() override;
+
+  double getDefaultMinThreshold()  const override {
+    return comm_lb_min_threshold;
+  }
+  double getDefaultMaxThreshold()  const override {
+    return comm_lb_max_threshold;
+  }
+  bool   getDefaultAutoThreshold() const override { return comm_lb_auto; }
+
+protected:
+  int32_t getMaxStageEpochs() const override { return 1 + num_iters_; }
+
+  void exchangeEdges();
+  void doIteration();
+  void proposeMoves();
+  void reportCut();
+  void migrate();
+
+  void edgesHandler(CommEdgeMsg* msg);
+  void proposalHandler(CommProposalMsg* msg);
+  void acceptHandler(CommAcceptMsg* msg);
+  void locationHandler(CommLocationMsg* msg);
+  void cutHandler(CommCutMsg* msg);
+
+  NodeType curNode(ObjIDType obj) const;
+  double cutBytes(bool after) const;
+
+private:
+  int32_t iter_                         = 0;
+  int32_t num_iters_                    = comm_lb_num_iters;
+  double avg_                           = 0.0;
+  double cap_                           = 0.0;
+  double this_new_load_                 = 0.0;
+  std::unordered_map<ObjIDType, double> obj_load_    = {};
+  std::unordered_map<ObjIDType, NodeType> obj_loc_   = {};
+  ObjLocType nbr_loc_                   = {};
+  GraphType graph_                      = {};
+  std::random_device seed_;
+  std::mt19937 gen_;
+  objgroup::proxy::Proxy<CommLB> proxy  = {};
+};
+
+}}}} /* end namespace vt::vrt::collection::lb */
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_BALANCE_COMMLB_COMMLB_H*/
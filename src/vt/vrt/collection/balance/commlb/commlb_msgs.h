@@ -0,0 +1,159 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                commlb_msgs.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_BALANCE_COMMLB_COMMLB_MSGS_H
+#define INCLUDED_VT_VRT_COLLECTION_BALANCE_COMMLB_COMMLB_MSGS_H
+
+#include "vt/config.h"
+#include "vt/messaging/message.h"
+#include "vt/collective/reduce/reduce.h"
+#include "vt/vrt/collection/balance/lb_common.h"
+
+#include <array>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+namespace vt { namespace vrt { namespace collection { namespace lb {
+
+struct CommLBTypes {
+  using ObjIDType   = balance::ElementIDType;
+  // (object on the receiving node, neighbor object, bytes)
+  using EdgeType    = std::tuple<ObjIDType, ObjIDType, double>;
+  using EdgeVecType = std::vector<EdgeType>;
+  // (object, load, gain)
+  using PropType    = std::tuple<ObjIDType, double, double>;
+  using PropVecType = std::vector<PropType>;
+  using ObjVecType  = std::vector<ObjIDType>;
+  using ObjLocType  = std::unordered_map<ObjIDType, NodeType>;
+};
+
+struct CommEdgeMsg : vt::Message, CommLBTypes {
+  CommEdgeMsg() = default;
+  explicit CommEdgeMsg(EdgeVecType const& in_edges)
+    : edges_(in_edges)
+  { }
+
+  EdgeVecType const& getEdges() const { return edges_; }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | edges_;
+  }
+
+private:
+  EdgeVecType edges_ = {};
+};
+
+struct CommProposalMsg : vt::Message, CommLBTypes {
+  CommProposalMsg() = default;
+  CommProposalMsg(NodeType in_from, PropVecType const& in_props)
+    : from_(in_from), props_(in_props)
+  { }
+
+  NodeType getFromNode() const { return from_; }
+  PropVecType const& getProposals() const { return props_; }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | from_ | props_;
+  }
+
+private:
+  NodeType from_ = uninitialized_destination;
+  PropVecType props_ = {};
+};
+
+struct CommAcceptMsg : vt::Message, CommLBTypes {
+  CommAcceptMsg() = default;
+  CommAcceptMsg(NodeType in_from, ObjVecType const& in_objs)
+    : from_(in_from), objs_(in_objs)
+  { }
+
+  NodeType getFromNode() const { return from_; }
+  ObjVecType const& getObjs() const { return objs_; }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | from_ | objs_;
+  }
+
+private:
+  NodeType from_ = uninitialized_destination;
+  ObjVecType objs_ = {};
+};
+
+struct CommLocationMsg : vt::Message, CommLBTypes {
+  CommLocationMsg() = default;
+  explicit CommLocationMsg(ObjLocType const& in_locs)
+    : locs_(in_locs)
+  { }
+
+  ObjLocType const& getLocations() const { return locs_; }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | locs_;
+  }
+
+private:
+  ObjLocType locs_ = {};
+};
+
+/*
+ * Cut bytes before balancing, cut bytes after, and the total object-to-object
+ * bytes, summed over all nodes in one reduction
+ */
+struct CommCutMsg : collective::ReduceTMsg<std::array<double, 3>> {
+  CommCutMsg() = default;
+  CommCutMsg(double in_before, double in_after, double in_total)
+    : collective::ReduceTMsg<std::array<double, 3>>(
+        std::array<double, 3>{{in_before, in_after, in_total}}
+      )
+  { }
+};
+
+}}}} /* end namespace vt::vrt::collection::lb */
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_BALANCE_COMMLB_COMMLB_MSGS_H*/
@@ -44,16 +44,21 @@
 
 #include "vt/config.h"
 #include "vt/vrt/collection/balance/elm_stats.h"
+#include "vt/vrt/collection/balance/load_model.h"
 #include "vt/timing/timing.h"
 
 #include <cassert>
+#include <cmath>
 
 namespace vt { namespace vrt { namespace collection { namespace balance {
 
 void ElementStats::startTime() {
-  auto const start_time = timing::Timing::getCurrentTime();
+  auto const start_time = timing::Timing::getLBTime();
   cur_time_ = start_time;
   cur_time_started_ = true;
+  if (timing::Timing::recordCPUTime()) {
+    cur_cpu_time_ = timing::Timing::getThreadCPUTime();
+  }
 
   debug_print_verbose(
     lb, node,
@@ -63,13 +68,16 @@ void ElementStats::startTime() {
 }
 
 void ElementStats::stopTime() {
-  auto const stop_time = timing::Timing::getCurrentTime();
+  auto const stop_time = timing::Timing::getLBTime();
   auto const total_time = stop_time - cur_time_;
   //vtAssert(cur_time_started_, "Must have started time");
   auto const started = cur_time_started_;
   if (started) {
     cur_time_started_ = false;
     addTime(total_time);
+    if (timing::Timing::recordCPUTime()) {
+      addCPUTime(timing::Timing::getThreadCPUTime() - cur_cpu_time_);
+    }
   }
 
   debug_print_verbose(
@@ -109,6 +117,7 @@ void ElementStats::recvToNode(
 void ElementStats::setModelWeight(TimeType const& time) {
   cur_time_started_ = false;
   addTime(time);
+  addCPUTime(time);
 
   debug_print(
     lb, node,
@@ -128,6 +137,11 @@ void ElementStats::addTime(TimeType const& time) {
   );
 }
 
+void ElementStats::addCPUTime(TimeType const& time) {
+  phase_cpu_timings_.resize(cur_phase_ + 1);
+  phase_cpu_timings_.at(cur_phase_) += time;
+}
+
 void ElementStats::updatePhase(PhaseType const& inc) {
   debug_print(
     lb, node,
@@ -136,6 +150,7 @@ void ElementStats::updatePhase(PhaseType const& inc) {
   );
 
   phase_timings_.resize(cur_phase_ + 1);
+  phase_cpu_timings_.resize(cur_phase_ + 1);
   cur_phase_ += inc;
 }
 
@@ -156,6 +171,50 @@ TimeType ElementStats::getLoad(PhaseType const& phase) const {
   return total_load;
 }
 
+TimeType ElementStats::getCPULoad(PhaseType const& phase) const {
+  vtAssert(phase_cpu_timings_.size() > phase, "Must have phase");
+  return phase_cpu_timings_.at(phase);
+}
+
+TimeType ElementStats::getLBLoad(PhaseType const& phase) const {
+  return getLBLoadHistory().at(phase);
+}
+
+std::vector<TimeType> const& ElementStats::getLBLoadHistory() const {
+  return timing::Timing::balanceOnCPUTime() ? phase_cpu_timings_ : phase_timings_;
+}
+
+TimeType ElementStats::predictLoad(PhaseType const& phase) {
+  auto const& history = getLBLoadHistory();
+  vtAssert(history.size() > phase, "Must have phase");
+  pred_load_ = getLoadModel().predict(history, phase);
+  pred_phase_ = phase + 1;
+
+  debug_print(
+    lb, node,
+    "ElementStats: predictLoad: phase={}, load={}, predicted={}\n",
+    phase, history.at(phase), pred_load_
+  );
+
+  return pred_load_;
+}
+
+bool ElementStats::hasPrediction(PhaseType const& phase) const {
+  return pred_phase_ == phase;
+}
+
+TimeType ElementStats::getPredictionError(PhaseType const& phase) const {
+  vtAssert(hasPrediction(phase), "Must have predicted the phase");
+  return std::fabs(pred_load_ - getLBLoad(phase));
+}
+
+void ElementStats::setFootprint(std::size_t const& bytes) {
+  footprint_ = bytes;
+}
+
+std::size_t ElementStats::getFootprint() const {
+  return footprint_;
+}
 
 CommMapType const&
 ElementStats::getComm(PhaseType const& phase) {
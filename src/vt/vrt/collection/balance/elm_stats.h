@@ -72,6 +72,7 @@ struct ElementStats {
   void startTime();
   void stopTime();
   void addTime(TimeType const& time);
+  void addCPUTime(TimeType const& time);
   void recvObjData(
     ElementIDType to_perm, ElementIDType to_temp,
     ElementIDType from_perm, ElementIDType from_temp, double bytes, bool bcast
@@ -88,8 +89,31 @@ struct ElementStats {
   void updatePhase(PhaseType const& inc = 1);
   PhaseType getPhase() const;
   TimeType getLoad(PhaseType const& phase) const;
+  TimeType getCPULoad(PhaseType const& phase) const;
   CommMapType const& getComm(PhaseType const& phase);
 
+  /*
+   * The load that drives LB decisions: wall or thread CPU time (--vt_lb_load)
+   */
+  TimeType getLBLoad(PhaseType const& phase) const;
+  std::vector<TimeType> const& getLBLoadHistory() const;
+
+  /*
+   * Predict the load of the phase after `phase` with the configured load model.
+   * The prediction is remembered so its error can be measured once that phase
+   * has completed
+   */
+  TimeType predictLoad(PhaseType const& phase);
+  bool hasPrediction(PhaseType const& phase) const;
+  TimeType getPredictionError(PhaseType const& phase) const;
+
+  /*
+   * Size of the element: what it reports through getMemoryFootprint(), else
+   * its serialized size, i.e., what a migration has to move
+   */
+  void setFootprint(std::size_t const& bytes);
+  std::size_t getFootprint() const;
+
   template <typename Serializer>
   void serialize(Serializer& s);
 
@@ -97,15 +121,23 @@ public:
   template <typename ColT>
   static void syncNextPhase(PhaseMsg<ColT>* msg, ColT* col);
 
+  template <typename ColT>
+  static std::size_t measureFootprint(ColT* col);
+
   template <typename ColT>
   friend struct collection::Migratable;
 
 protected:
   bool cur_time_started_ = false;
   TimeType cur_time_ = 0.0;
+  TimeType cur_cpu_time_ = 0.0;
   PhaseType cur_phase_ = fst_lb_phase;
   std::vector<TimeType> phase_timings_ = {};
+  std::vector<TimeType> phase_cpu_timings_ = {};
   std::vector<CommMapType> comm_ = {};
+  TimeType pred_load_ = 0.0;
+  PhaseType pred_phase_ = no_lb_phase;
+  std::size_t footprint_ = 0;
 };
 
 }}}} /* end namespace vt::vrt::collection::balance */
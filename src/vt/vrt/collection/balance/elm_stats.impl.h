@@ -54,6 +54,7 @@
 #include "vt/vrt/collection/manager.h"
 #include "vt/vrt/collection/balance/lb_invoke/invoke.h"
 #include "vt/timing/timing.h"
+#include "vt/serialization/serialize_interface.h"
 
 #include <cassert>
 #include <type_traits>
@@ -64,9 +65,28 @@ template <typename Serializer>
 void ElementStats::serialize(Serializer& s) {
   s | cur_time_started_;
   s | cur_time_;
+  s | cur_cpu_time_;
   s | cur_phase_;
   s | phase_timings_;
+  s | phase_cpu_timings_;
   s | comm_;
+  s | pred_load_;
+  s | pred_phase_;
+}
+
+template <typename ColT>
+/*static*/ std::size_t ElementStats::measureFootprint(ColT* col) {
+  auto const reported = col->getMemoryFootprint();
+  if (reported != 0) {
+    return reported;
+  }
+
+#if HAS_SERIALIZATION_LIBRARY
+  // Sizing pass only: walks `serialize` without packing anything
+  return ::serialization::interface::getSize<ColT>(*col);
+#else
+  return sizeof(ColT);
+#endif
 }
 
 template <typename ColT>
@@ -91,7 +111,21 @@ template <typename ColT>
   auto const& idx = col->getIndex();
   auto const& elm_proxy = proxy[idx];
 
-  ProcStats::addProcStats<ColT>(elm_proxy, col, cur_phase, total_load, comm);
+  auto const temp_id = ProcStats::addProcStats<ColT>(
+    elm_proxy, col, cur_phase, total_load, comm
+  );
+  if (timing::Timing::recordCPUTime()) {
+    ProcStats::addCPUStats(temp_id, cur_phase, stats.getCPULoad(cur_phase));
+  }
+
+  // The balancers see the model's prediction for the next phase; the error of
+  // the prediction made for this phase goes into the LB statistics
+  if (stats.hasPrediction(cur_phase)) {
+    ProcStats::addPredictionError(
+      temp_id, cur_phase, stats.getPredictionError(cur_phase)
+    );
+  }
+  ProcStats::addPrediction(temp_id, cur_phase, stats.predictLoad(cur_phase));
 
   auto const before_ready = theCollection()->numReadyCollections();
   theCollection()->makeCollectionReady(untyped_proxy);
@@ -110,6 +144,12 @@ template <typename ColT>
 
   auto const lb = lb_man.get()->decideLBToRun(cur_phase);
   bool const must_run_lb = lb != LBType::NoLB;
+
+  // Only size the element when it might be migrated
+  if (must_run_lb) {
+    stats.setFootprint(measureFootprint(col));
+    ProcStats::addFootprint(temp_id, stats.getFootprint());
+  }
   auto const num_collections = theCollection()->numCollections<>();
   auto const do_sync = msg->doSync();
   auto nmsg = makeMessage<MsgType>(cur_phase,lb,msg->manual(),num_collections);
@@ -45,43 +45,316 @@
 #include "vt/config.h"
 #include "vt/vrt/collection/balance/baselb/baselb.h"
 #include "vt/vrt/collection/balance/gossiplb/gossiplb.h"
+#include "vt/vrt/collection/balance/gossiplb/gossiplb_msgs.h"
 #include "vt/context/context.h"
+#include "vt/messaging/active.h"
+#include "vt/termination/termination.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstdint>
 #include <random>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace vt { namespace vrt { namespace collection { namespace lb {
 
 void GossipLB::init(objgroup::proxy::Proxy<GossipLB> in_proxy) {
   proxy = in_proxy;
+  gen_.seed(seed_());
+
+  // These must be set before any inform message can arrive, which may be
+  // before this node has finished its statistics and entered runLB
+  auto const num_nodes = theContext()->getNumNodes();
+  f_ = std::max(ArgType::vt_lb_gossip_fanout, 1);
+  num_iters_ = std::max(ArgType::vt_lb_gossip_iters, 0);
+  k_max_ = ArgType::vt_lb_gossip_rounds;
+  if (k_max_ <= 0) {
+    k_max_ = f_ > 1 and num_nodes > 1 ?
+      static_cast<int32_t>(std::ceil(std::log(num_nodes) / std::log(f_))) : 1;
+    k_max_ = std::max(k_max_, 1);
+  }
 }
 
 void GossipLB::runLB() {
-  this->inform();
+  auto const& this_node = theContext()->getNode();
+  avg_ = stats.at(lb::Statistic::P_l).at(lb::StatisticQuantity::avg);
+  auto const max = stats.at(lb::Statistic::P_l).at(lb::StatisticQuantity::max);
+  auto const I = stats.at(lb::Statistic::P_l).at(lb::StatisticQuantity::imb);
+
+  this_new_load_ = this_load;
+  for (auto&& stat : *load_data) {
+    cur_objs_[stat.first] = loadMilli(stat.second);
+  }
+
+  bool const should_lb = avg_ > 0.0000000001 and max > avg_;
+  if (not should_lb) {
+    num_iters_ = 0;
+  }
+
+  if (this_node == 0) {
+    vt_print(
+      lb,
+      "GossipLB::runLB: avg={:.2f}, max={:.2f}, I={:.2f}, should_lb={}, "
+      "f={}, k={}, iters={}\n",
+      avg_, max, I, should_lb, f_, k_max_, num_iters_
+    );
+    fflush(stdout);
+  }
+
+  doLBStages();
+}
+
+void GossipLB::doLBStages() {
+  if (iter_ < num_iters_) {
+    inform();
+  } else {
+    migrate();
+  }
 }
 
 void GossipLB::inform() {
-  for (int i = 0; i < f; i++) {
-    propagateInfo();
+  auto const& this_node = theContext()->getNode();
+
+  debug_print(
+    lb, node,
+    "GossipLB::inform: iter={}, load={}, avg={}\n",
+    iter_, this_new_load_, avg_
+  );
+
+  auto const inform_epoch = makeCollectiveEpoch();
+  theTerm()->addAction(inform_epoch, [this]{ this->decide(); });
+  theMsg()->pushEpoch(inform_epoch);
+
+  if (isUnderloaded(this_new_load_)) {
+    load_info_[this_node] = this_new_load_;
+    propagateRound(1);
   }
+
+  theMsg()->popEpoch(inform_epoch);
+  theTerm()->finishedEpoch(inform_epoch);
 }
 
-void GossipLB::propagateInfo() {
-  // First, randomly select a node
+void GossipLB::propagateRound(int32_t round) {
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
 
-  auto const num_nodes = theContext()->getNumNodes();
+  if (num_nodes < 2) {
+    return;
+  }
+
+  // Pick up to `f_` distinct peers uniformly, never this node
   std::uniform_int_distribution<NodeType> dist(0, num_nodes - 2);
-  std::mt19937 gen(seed());
+  std::unordered_set<NodeType> selected;
+  auto const num_select = std::min(f_, static_cast<int32_t>(num_nodes - 1));
+  while (static_cast<int32_t>(selected.size()) < num_select) {
+    NodeType const pick = dist(gen_);
+    selected.insert(pick >= this_node ? pick + 1 : pick);
+  }
 
-  dist(gen);
+  for (auto&& peer : selected) {
+    debug_print(
+      lb, node,
+      "GossipLB::propagateRound: round={}, to={}, known={}\n",
+      round, peer, load_info_.size()
+    );
+    auto msg = makeMessage<GossipMsg>(this_node, load_info_, round);
+    proxy[peer].template send<GossipMsg, &GossipLB::propagateIncoming>(msg);
+  }
+}
+
+void GossipLB::propagateIncoming(GossipMsg* msg) {
+  auto const from_node = msg->getFromNode();
+  auto const round = msg->getRound();
+
+  debug_print(
+    lb, node,
+    "GossipLB::propagateIncoming: round={}, from={}, incoming={}, known={}\n",
+    round, from_node, msg->getNodeLoad().size(), load_info_.size()
+  );
+
+  for (auto&& elm : msg->getNodeLoad()) {
+    load_info_[elm.first] = elm.second;
+  }
+
+  if (round < k_max_) {
+    propagateRound(round + 1);
+  }
+}
+
+bool GossipLB::isUnderloaded(double load) const {
+  return load < avg_;
+}
+
+bool GossipLB::isOverloaded(double load) const {
+  return load > avg_;
+}
+
+std::vector<NodeType> GossipLB::makeUnderloaded() const {
+  std::vector<NodeType> under;
+  for (auto&& elm : load_info_) {
+    if (isUnderloaded(elm.second)) {
+      under.push_back(elm.first);
+    }
+  }
+  // Sort so the CMF, and therefore the sampled peer, does not depend on the
+  // iteration order of the hash map
+  std::sort(under.begin(), under.end());
+  return under;
+}
+
+std::vector<double> GossipLB::createCMF(
+  std::vector<NodeType> const& under
+) const {
+  // Weight each peer by how far it is below the average: 1 - l/avg
+  std::vector<double> cmf;
+  double sum = 0.0;
+  for (auto&& node : under) {
+    sum += 1.0 - load_info_.at(node) / avg_;
+    cmf.push_back(sum);
+  }
+  for (auto&& elm : cmf) {
+    elm /= sum;
+  }
+  return cmf;
+}
+
+NodeType GossipLB::sampleFromCMF(
+  std::vector<NodeType> const& under, std::vector<double> const& cmf
+) {
+  std::uniform_real_distribution<double> dist(0.0, 1.0);
+  auto const u = dist(gen_);
+  for (std::size_t i = 0; i < cmf.size(); i++) {
+    if (u <= cmf[i]) {
+      return under[i];
+    }
+  }
+  return under.back();
 }
 
 void GossipLB::decide() {
-  vtAssertExpr(false);
+  auto const& this_node = theContext()->getNode();
+
+  auto const lazy_epoch = makeCollectiveEpoch();
+  theTerm()->addAction(lazy_epoch, [this]{
+    this->iter_++;
+    this->doLBStages();
+  });
+  theMsg()->pushEpoch(lazy_epoch);
+
+  int32_t num_transfers = 0;
+
+  if (isOverloaded(this_new_load_) and load_info_.size() > 0) {
+    // Offer the heaviest objects first
+    std::vector<std::pair<ObjIDType, double>> ordered(
+      cur_objs_.begin(), cur_objs_.end()
+    );
+    std::sort(
+      ordered.begin(), ordered.end(),
+      [](std::pair<ObjIDType, double> const& a,
+         std::pair<ObjIDType, double> const& b) {
+        return a.second > b.second or
+          (a.second == b.second and a.first < b.first);
+      }
+    );
+
+    std::unordered_map<NodeType, ObjsType> migrate_objs;
+
+    for (auto&& obj : ordered) {
+      if (not isOverloaded(this_new_load_)) {
+        break;
+      }
+
+      auto const under = makeUnderloaded();
+      if (under.size() == 0) {
+        break;
+      }
+
+      auto const cmf = createCMF(under);
+      auto const selected_node = sampleFromCMF(under, cmf);
+      auto& selected_load = load_info_[selected_node];
+      auto const obj_load = obj.second;
+
+      // Only accept transfers that leave the receiver less loaded than this
+      // node was; otherwise the transfer just moves the hot spot
+      bool const accept = selected_load + obj_load < this_new_load_;
+
+      debug_print(
+        lb, node,
+        "GossipLB::decide: obj={}, obj_load={}, selected_node={}, "
+        "selected_load={}, this_load={}, accept={}\n",
+        obj.first, obj_load, selected_node, selected_load, this_new_load_,
+        accept
+      );
+
+      if (accept) {
+        migrate_objs[selected_node][obj.first] = obj_load;
+        cur_objs_.erase(obj.first);
+        selected_load += obj_load;
+        this_new_load_ -= obj_load;
+        num_transfers++;
+      }
+    }
+
+    for (auto&& elm : migrate_objs) {
+      lazyMigrateObjsTo(elm.first, elm.second);
+    }
+  }
+
+  num_transfers_ += num_transfers;
+
+  debug_print(
+    lb, node,
+    "GossipLB::decide: iter={}, this_node={}, transfers={}, new_load={}\n",
+    iter_, this_node, num_transfers, this_new_load_
+  );
+
+  // Knowledge is only valid for one iteration. Clear it here, before this
+  // epoch can terminate, so the next inform stage starts fresh even if a peer
+  // reaches it first and gossips to this node early
+  load_info_.clear();
+
+  theMsg()->popEpoch(lazy_epoch);
+  theTerm()->finishedEpoch(lazy_epoch);
+}
+
+void GossipLB::lazyMigrateObjsTo(NodeType node, ObjsType const& objs) {
+  auto msg = makeMessage<LazyMigrationMsg>(node, objs);
+  proxy[node].template send<LazyMigrationMsg, &GossipLB::inLazyMigrations>(
+    msg
+  );
+}
+
+void GossipLB::inLazyMigrations(LazyMigrationMsg* msg) {
+  auto const& incoming_objs = msg->getObjSet();
+  for (auto&& obj : incoming_objs) {
+    vtAssert(cur_objs_.find(obj.first) == cur_objs_.end(), "Must not exist");
+    cur_objs_[obj.first] = obj.second;
+    this_new_load_ += obj.second;
+  }
 }
 
 void GossipLB::migrate() {
-  vtAssertExpr(false);
+  auto const& this_node = theContext()->getNode();
+
+  debug_print(
+    lb, node,
+    "GossipLB::migrate: iters={}, transfers={}, new_load={}, objs={}\n",
+    iter_, num_transfers_, this_new_load_, cur_objs_.size()
+  );
+
+  startMigrationCollective();
+
+  // Each node pulls the objects it ended up owning; migrateObjectTo routes the
+  // request to the node that currently holds the object
+  for (auto&& obj : cur_objs_) {
+    if (objGetNode(obj.first) != this_node) {
+      migrateObjectTo(obj.first, this_node);
+    }
+  }
+
+  finishMigrationCollective();
 }
 
 }}}} /* end namespace vt::vrt::collection::lb */
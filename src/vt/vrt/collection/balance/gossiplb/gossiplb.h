@@ -47,12 +47,31 @@
 
 #include "vt/config.h"
 #include "vt/vrt/collection/balance/baselb/baselb.h"
+#include "vt/vrt/collection/balance/gossiplb/gossiplb_msgs.h"
+#include "vt/configs/arguments/args.h"
 
 #include <random>
+#include <unordered_map>
+#include <vector>
 
 namespace vt { namespace vrt { namespace collection { namespace lb {
 
+/*
+ * GossipLB: a fully distributed balancer that needs no root (GrapevineLB).
+ *
+ * Each iteration starts with an inform stage where underloaded nodes push
+ * their load to `f` random peers, which forward what they learned for up to
+ * `k` rounds. In the transfer stage, each overloaded node offers its objects
+ * (heaviest first) to underloaded peers it heard about. It samples a peer
+ * from a CMF weighted by how far that peer is below the average. Transfers
+ * are lazy: only the object IDs and their loads move between iterations, and
+ * the real migrations happen once after the last iteration.
+ */
 struct GossipLB : BaseLB {
+  using NodeLoadType = GossipMsg::NodeLoadType;
+  using ObjsType     = LazyMigrationMsg::ObjsType;
+  using ArgType      = vt::arguments::ArgConfig;
+
   GossipLB() = default;
   GossipLB(GossipLB const&) = delete;
   GossipLB(GossipLB&&) = default;
@@ -65,18 +84,39 @@ struct GossipLB : BaseLB {
   bool   getDefaultAutoThreshold() const override { return true; }
 
 protected:
+  int32_t getMaxStageEpochs() const override { return 2 * num_iters_; }
+
+  void doLBStages();
   void inform();
   void decide();
   void migrate();
 
-  void propagateInfo();
+  void propagateRound(int32_t round);
+  void propagateIncoming(GossipMsg* msg);
+  void lazyMigrateObjsTo(NodeType node, ObjsType const& objs);
+  void inLazyMigrations(LazyMigrationMsg* msg);
+
+  std::vector<double> createCMF(std::vector<NodeType> const& under) const;
+  NodeType sampleFromCMF(
+    std::vector<NodeType> const& under, std::vector<double> const& cmf
+  );
+  std::vector<NodeType> makeUnderloaded() const;
+  bool isUnderloaded(double load) const;
+  bool isOverloaded(double load) const;
 
 private:
-  uint8_t f               = 0;
-  // uint8_t k               = 0;
-  // uint8_t k_cur           = 0;
-  std::random_device seed;
-  objgroup::proxy::Proxy<GossipLB> proxy = {};
+  int32_t f_                                = 0;
+  int32_t k_max_                            = 0;
+  int32_t num_iters_                        = 0;
+  int32_t iter_                             = 0;
+  int32_t num_transfers_                    = 0;
+  double avg_                               = 0.0;
+  double this_new_load_                     = 0.0;
+  NodeLoadType load_info_                   = {};
+  ObjsType cur_objs_                        = {};
+  std::random_device seed_;
+  std::mt19937 gen_;
+  objgroup::proxy::Proxy<GossipLB> proxy    = {};
 };
 
 }}}} /* end namespace vt::vrt::collection::lb */
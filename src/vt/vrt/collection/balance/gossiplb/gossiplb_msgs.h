@@ -0,0 +1,103 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               gossiplb_msgs.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VT_VRT_COLLECTION_BALANCE_GOSSIPLB_GOSSIPLB_MSGS_H
+#define INCLUDED_VT_VRT_COLLECTION_BALANCE_GOSSIPLB_GOSSIPLB_MSGS_H
+
+#include "vt/config.h"
+#include "vt/messaging/message.h"
+#include "vt/vrt/collection/balance/lb_common.h"
+
+#include <unordered_map>
+
+namespace vt { namespace vrt { namespace collection { namespace lb {
+
+struct GossipMsg : vt::Message {
+  using NodeLoadType = std::unordered_map<NodeType, double>;
+
+  GossipMsg() = default;
+  GossipMsg(
+    NodeType in_from_node, NodeLoadType const& in_node_load, int32_t in_round
+  ) : from_node_(in_from_node), node_load_(in_node_load), round_(in_round)
+  { }
+
+  NodeLoadType const& getNodeLoad() const { return node_load_; }
+  NodeType getFromNode() const { return from_node_; }
+  int32_t getRound() const { return round_; }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | from_node_ | node_load_ | round_;
+  }
+
+private:
+  NodeType from_node_ = uninitialized_destination;
+  NodeLoadType node_load_ = {};
+  int32_t round_ = 0;
+};
+
+struct LazyMigrationMsg : vt::Message {
+  using ObjsType = std::unordered_map<balance::ElementIDType, double>;
+
+  LazyMigrationMsg() = default;
+  LazyMigrationMsg(NodeType in_to_node, ObjsType const& in_objs)
+    : to_node_(in_to_node), objs_(in_objs)
+  { }
+
+  NodeType getToNode() const { return to_node_; }
+  ObjsType const& getObjSet() const { return objs_; }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | to_node_ | objs_;
+  }
+
+private:
+  NodeType to_node_ = uninitialized_destination;
+  ObjsType objs_ = {};
+};
+
+}}}} /* end namespace vt::vrt::collection::lb */
+
+#endif /*INCLUDED_VT_VRT_COLLECTION_BALANCE_GOSSIPLB_GOSSIPLB_MSGS_H*/
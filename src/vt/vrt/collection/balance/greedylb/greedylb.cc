@@ -57,6 +57,7 @@
 #include "vt/context/context.h"
 #include "vt/vrt/collection/manager.h"
 #include "vt/collective/reduce/reduce.h"
+#include "vt/configs/arguments/args.h"
 
 #include <unordered_map>
 #include <memory>
@@ -70,6 +71,9 @@ namespace vt { namespace vrt { namespace collection { namespace lb {
 
 void GreedyLB::init(objgroup::proxy::Proxy<GreedyLB> in_proxy) {
   proxy = scatter_proxy = in_proxy;
+  group_size_ = arguments::ArgConfig::vt_lb_greedy_group_size;
+  migration_cost_aware_ = true;
+  memory_aware_ = true;
 }
 
 void GreedyLB::runLB() {
@@ -97,16 +101,20 @@ void GreedyLB::loadStats() {
     vt_print(
       lb,
       "loadStats: load={:.2f}, total={:.2f}, avg={:.2f}, I={:.2f},"
-      "should_lb={}, auto={}, threshold={}\n",
+      "should_lb={}, auto={}, threshold={}, group_size={}\n",
       this_load, total_load, avg_load, I, should_lb, auto_threshold,
-      this_threshold
+      this_threshold, group_size_
     );
     fflush(stdout);
   }
 
   if (should_lb) {
     calcLoadOver();
-    reduceCollect();
+    if (useGroups()) {
+      sendToGroup();
+    } else {
+      reduceCollect();
+    }
   } else {
     // release continuation for next iteration
     migrationDone();
@@ -128,9 +136,11 @@ void GreedyLB::collectHandler(GreedyCollectMsg* msg) {
     );
   }
 
+  auto const& footprint = msg->getConstVal().getFootprint();
+  auto memory = msg->getConstVal().getMemoryProfile();
   auto objs = std::move(msg->getVal().getSampleMove());
   auto profile = std::move(msg->getVal().getLoadProfileMove());
-  runBalancer(std::move(objs),std::move(profile));
+  runBalancer(std::move(objs),std::move(profile),footprint,std::move(memory));
 }
 
 void GreedyLB::reduceCollect() {
@@ -141,18 +151,79 @@ void GreedyLB::reduceCollect() {
   );
   using MsgType = GreedyCollectMsg;
   auto cb = vt::theCB()->makeSend<GreedyLB, MsgType, &GreedyLB::collectHandler>(proxy[0]);
-  auto msg = makeSharedMessage<MsgType>(load_over,this_load);
+  auto msg = makeSharedMessage<MsgType>(
+    load_over,this_load,load_over_bytes_,memory_usage_
+  );
   proxy.template reduce<collective::PlusOp<GreedyPayload>>(msg,cb);
 }
 
+bool GreedyLB::popNodeFor(
+  std::vector<GreedyProc>& nodes, GreedyRecord const& rec,
+  MemoryProfileType& memory, GreedyProc& out
+) {
+  using CompProcType = GreedyCompareLoadMin<GreedyProc>;
+  auto const capacity = arguments::ArgConfig::vt_lb_memory_capacity;
+  auto const home = objGetNode(rec.getObj());
+  auto const bytes = rec.getBytes();
+
+  // Take the least loaded node with room for the object, setting aside the
+  // ones without. An object counts against its home node until it is placed
+  // elsewhere, so staying home never overflows and is always allowed
+  std::vector<GreedyProc> full;
+  bool found = false;
+  while (not nodes.empty() and not found) {
+    std::pop_heap(nodes.begin(), nodes.end(), CompProcType());
+    auto proc = nodes.back();
+    nodes.pop_back();
+    if (
+      capacity <= 0 or proc.node_ == home or
+      memory[proc.node_] + bytes <= capacity
+    ) {
+      out = proc;
+      found = true;
+    } else {
+      full.push_back(proc);
+    }
+  }
+
+  if (found and capacity > 0 and out.node_ != home) {
+    memory[out.node_] += bytes;
+    auto home_iter = memory.find(home);
+    if (home_iter != memory.end()) {
+      home_iter->second -= bytes;
+    }
+  }
+
+  if (full.size() > 0) {
+    debug_print(
+      lb, node,
+      "GreedyLB::popNodeFor: obj={}, bytes={}, full nodes={}, found={}\n",
+      rec.getObj(), rec.getBytes(), full.size(), found
+    );
+    // Only a rejection if memory kept the object home: passing over a full
+    // node for another one that has room is just a different placement
+    if (not found or out.node_ == home) {
+      local_memory_rejected_++;
+    }
+  }
+
+  for (auto&& proc : full) {
+    nodes.push_back(proc);
+    std::push_heap(nodes.begin(), nodes.end(), CompProcType());
+  }
+  return found;
+}
+
 void GreedyLB::runBalancer(
-  ObjSampleType&& in_objs, LoadProfileType&& in_profile
+  ObjSampleType&& in_objs, LoadProfileType&& in_profile,
+  FootprintType const& footprint, MemoryProfileType&& in_memory
 ) {
   using CompRecType = GreedyCompareLoadMax<GreedyRecord>;
   using CompProcType = GreedyCompareLoadMin<GreedyProc>;
   auto const& num_nodes = theContext()->getNumNodes();
   ObjSampleType objs{std::move(in_objs)};
   LoadProfileType profile{std::move(in_profile)};
+  MemoryProfileType memory{std::move(in_memory)};
   std::vector<GreedyRecord> recs;
   debug_print(
     lb, node,
@@ -163,7 +234,9 @@ void GreedyLB::runBalancer(
     auto const& bin = elm.first;
     auto const& obj_list = elm.second;
     for (auto&& obj : obj_list) {
-      recs.emplace_back(GreedyRecord{obj,static_cast<LoadType>(bin)});
+      auto const bytes_iter = footprint.find(obj);
+      auto const bytes = bytes_iter != footprint.end() ? bytes_iter->second : 0;
+      recs.emplace_back(GreedyRecord{obj,static_cast<LoadType>(bin),bytes});
     }
   }
   std::make_heap(recs.begin(), recs.end(), CompRecType());
@@ -184,9 +257,10 @@ void GreedyLB::runBalancer(
     std::pop_heap(recs.begin(), recs.end(), CompRecType());
     auto max_rec = recs.back();
     recs.pop_back();
-    std::pop_heap(nodes.begin(), nodes.end(), CompProcType());
-    auto min_node = nodes.back();
-    nodes.pop_back();
+    GreedyProc min_node;
+    if (not popNodeFor(nodes, max_rec, memory, min_node)) {
+      continue;
+    }
     debug_print(
       lb, node,
       "\t GreedyLB::runBalancer: min_node={}, load_={}, "
@@ -283,6 +357,288 @@ void GreedyLB::transferObjs(std::vector<GreedyProc>&& in_load) {
   );
 }
 
+bool GreedyLB::useGroups() const {
+  auto const& num_nodes = theContext()->getNumNodes();
+  return group_size_ > 0 and group_size_ < num_nodes;
+}
+
+NodeType GreedyLB::groupRoot(NodeType node) const {
+  return static_cast<NodeType>(node / group_size_ * group_size_);
+}
+
+NodeType GreedyLB::groupEnd(NodeType root) const {
+  auto const& num_nodes = theContext()->getNumNodes();
+  return static_cast<NodeType>(std::min<int32_t>(root + group_size_, num_nodes));
+}
+
+void GreedyLB::sendToGroup() {
+  auto const& this_node = theContext()->getNode();
+  auto const group_root = groupRoot(this_node);
+
+  debug_print(
+    lb, node,
+    "GreedyLB::sendToGroup: group_root={}, load={}, load_over.size()={}\n",
+    group_root, this_load, load_over.size()
+  );
+
+  // Every step of the hierarchical exchange runs inside this epoch; once it
+  // terminates each group root knows the final placement of its objects
+  auto const group_epoch = makeCollectiveEpoch();
+  theTerm()->addAction(group_epoch, [this]{ this->groupMigrate(); });
+  theMsg()->pushEpoch(group_epoch);
+
+  auto msg = makeMessage<GreedyGroupMsg>(
+    load_over, this_load, load_over_bytes_, memory_usage_
+  );
+  proxy[group_root].template send<
+    GreedyGroupMsg, &GreedyLB::groupCollectHandler
+  >(msg);
+
+  theMsg()->popEpoch(group_epoch);
+  theTerm()->finishedEpoch(group_epoch);
+}
+
+void GreedyLB::groupCollectHandler(GreedyGroupMsg* msg) {
+  auto const& this_node = theContext()->getNode();
+
+  group_payload_ = group_payload_ + msg->getPayload();
+  group_num_recv_++;
+
+  if (group_num_recv_ < groupEnd(this_node) - this_node) {
+    return;
+  }
+
+  // The whole group has reported: flatten the candidate objects and compute
+  // how far the group as a whole is from the global average
+  auto const avg_load = getAvgLoad();
+  LoadType group_load = 0.0f;
+  for (auto&& elm : group_payload_.getLoadProfile()) {
+    group_load += elm.second;
+  }
+  auto const& footprint = group_payload_.getFootprint();
+  for (auto&& elm : group_payload_.getSample()) {
+    for (auto&& obj : elm.second) {
+      auto const bytes_iter = footprint.find(obj);
+      auto const bytes = bytes_iter != footprint.end() ? bytes_iter->second : 0;
+      group_recs_.emplace_back(
+        GreedyRecord{obj,static_cast<LoadType>(elm.first),bytes}
+      );
+      group_load += static_cast<LoadType>(elm.first);
+    }
+  }
+  std::sort(
+    group_recs_.begin(), group_recs_.end(),
+    [](GreedyRecord const& a, GreedyRecord const& b) {
+      return a.getLoad() > b.getLoad() or
+        (a.getLoad() == b.getLoad() and a.getObj() < b.getObj());
+    }
+  );
+
+  auto const num_members = groupEnd(this_node) - this_node;
+  auto const surplus = group_load - num_members * avg_load;
+
+  debug_print(
+    lb, node,
+    "GreedyLB::groupCollectHandler: members={}, recs={}, load={}, surplus={}\n",
+    num_members, group_recs_.size(), group_load, surplus
+  );
+
+  auto summary = makeMessage<GreedySummaryMsg>(this_node, surplus);
+  proxy[greedy_root].template send<
+    GreedySummaryMsg, &GreedyLB::groupSummaryHandler
+  >(summary);
+}
+
+void GreedyLB::groupSummaryHandler(GreedySummaryMsg* msg) {
+  auto const& num_nodes = theContext()->getNumNodes();
+  auto const num_groups = (num_nodes + group_size_ - 1) / group_size_;
+
+  group_summaries_[msg->group_root_] = msg->surplus_;
+
+  if (static_cast<int32_t>(group_summaries_.size()) == num_groups) {
+    computeGroupFlows();
+  }
+}
+
+void GreedyLB::computeGroupFlows() {
+  using FlowVecType = GreedyFlowMsg::FlowVecType;
+  using GroupLoadType = std::tuple<NodeType,LoadType>;
+
+  // Match surplus groups against deficit groups, largest first. Only these
+  // summaries live on the root, so its memory is O(#groups)
+  std::vector<GroupLoadType> over, under;
+  for (auto&& elm : group_summaries_) {
+    if (elm.second > 0.0f) {
+      over.emplace_back(std::make_tuple(elm.first, elm.second));
+    } else if (elm.second < 0.0f) {
+      under.emplace_back(std::make_tuple(elm.first, -elm.second));
+    }
+  }
+  auto by_load = [](GroupLoadType const& a, GroupLoadType const& b) {
+    return std::get<1>(a) > std::get<1>(b) or
+      (std::get<1>(a) == std::get<1>(b) and std::get<0>(a) < std::get<0>(b));
+  };
+  std::sort(over.begin(), over.end(), by_load);
+  std::sort(under.begin(), under.end(), by_load);
+
+  std::map<NodeType,FlowVecType> out;
+  std::map<NodeType,int32_t> num_in;
+  std::size_t i = 0, j = 0, num_flows = 0;
+  LoadType total_flow = 0.0f;
+  while (i < over.size() and j < under.size()) {
+    auto& src = over[i];
+    auto& dst = under[j];
+    auto const amount = std::min(std::get<1>(src), std::get<1>(dst));
+    out[std::get<0>(src)].emplace_back(std::make_tuple(std::get<0>(dst),amount));
+    num_in[std::get<0>(dst)]++;
+    std::get<1>(src) -= amount;
+    std::get<1>(dst) -= amount;
+    total_flow += amount;
+    num_flows++;
+    if (std::get<1>(src) <= 0.0f) { i++; }
+    if (std::get<1>(dst) <= 0.0f) { j++; }
+  }
+
+  vt_print(
+    lb,
+    "GreedyLB: hierarchical: groups={}, group_size={}, flows={}, "
+    "flow_load={:.2f}\n",
+    group_summaries_.size(), group_size_, num_flows, total_flow
+  );
+
+  for (auto&& elm : group_summaries_) {
+    auto const group_root = elm.first;
+    auto msg = makeMessage<GreedyFlowMsg>(out[group_root], num_in[group_root]);
+    proxy[group_root].template send<
+      GreedyFlowMsg, &GreedyLB::groupFlowHandler
+    >(msg);
+  }
+
+  group_summaries_.clear();
+}
+
+void GreedyLB::groupFlowHandler(GreedyFlowMsg* msg) {
+  using RecVecType = GreedyObjsMsg::RecVecType;
+
+  // Fill each outgoing flow with the heaviest candidates that still fit; the
+  // candidates are already sorted by decreasing load
+  std::vector<bool> taken(group_recs_.size(), false);
+  for (auto&& flow : msg->getOut()) {
+    auto const to_root = std::get<0>(flow);
+    auto remaining = std::get<1>(flow);
+    RecVecType recs;
+    for (std::size_t i = 0; i < group_recs_.size() and remaining > 0.0f; i++) {
+      auto const& rec = group_recs_[i];
+      if (not taken[i] and rec.getLoad() <= remaining) {
+        taken[i] = true;
+        remaining -= rec.getLoad();
+        recs.emplace_back(
+          std::make_tuple(rec.getObj(),rec.getLoad(),rec.getBytes())
+        );
+      }
+    }
+
+    debug_print(
+      lb, node,
+      "GreedyLB::groupFlowHandler: to_root={}, flow={}, recs={}\n",
+      to_root, std::get<1>(flow), recs.size()
+    );
+
+    // Always send, even if empty, so the receiver can count its inputs
+    auto objs_msg = makeMessage<GreedyObjsMsg>(recs);
+    proxy[to_root].template send<
+      GreedyObjsMsg, &GreedyLB::groupObjsHandler
+    >(objs_msg);
+  }
+
+  std::vector<GreedyRecord> kept;
+  for (std::size_t i = 0; i < group_recs_.size(); i++) {
+    if (not taken[i]) {
+      kept.push_back(group_recs_[i]);
+    }
+  }
+  group_recs_ = std::move(kept);
+
+  group_flow_recv_ = true;
+  group_num_in_ = msg->getNumIn();
+  tryRunGroupBalancer();
+}
+
+void GreedyLB::groupObjsHandler(GreedyObjsMsg* msg) {
+  for (auto&& rec : msg->getRecs()) {
+    group_recs_.emplace_back(
+      GreedyRecord{std::get<0>(rec),std::get<1>(rec),std::get<2>(rec)}
+    );
+  }
+  group_in_recv_++;
+  tryRunGroupBalancer();
+}
+
+void GreedyLB::tryRunGroupBalancer() {
+  if (group_flow_recv_ and group_in_recv_ == group_num_in_) {
+    runGroupBalancer();
+  }
+}
+
+void GreedyLB::runGroupBalancer() {
+  using CompRecType = GreedyCompareLoadMax<GreedyRecord>;
+  using CompProcType = GreedyCompareLoadMin<GreedyProc>;
+  auto const& this_node = theContext()->getNode();
+  auto const& profile = group_payload_.getLoadProfile();
+  auto memory = group_payload_.getMemoryProfile();
+
+  auto recs = std::move(group_recs_);
+  std::make_heap(recs.begin(), recs.end(), CompRecType());
+  auto nodes = std::vector<GreedyProc>{};
+  for (NodeType n = this_node; n < groupEnd(this_node); n++) {
+    auto iter = profile.find(n);
+    vtAssert(iter != profile.end(), "Must have load profile");
+    nodes.emplace_back(GreedyProc{n,iter->second});
+  }
+  std::make_heap(nodes.begin(), nodes.end(), CompProcType());
+
+  debug_print(
+    lb, node,
+    "GreedyLB::runGroupBalancer: recs={}, nodes={}\n",
+    recs.size(), nodes.size()
+  );
+
+  auto lb_size = recs.size();
+  for (size_t i = 0; i < lb_size; i++) {
+    std::pop_heap(recs.begin(), recs.end(), CompRecType());
+    auto max_rec = recs.back();
+    recs.pop_back();
+    // An object from another group that fits on no member stays where it is
+    GreedyProc min_node;
+    if (not popNodeFor(nodes, max_rec, memory, min_node)) {
+      continue;
+    }
+    if (objGetNode(max_rec.getObj()) != min_node.node_) {
+      group_migrations_.emplace_back(
+        std::make_tuple(max_rec.getObj(),min_node.node_)
+      );
+    }
+    min_node.load_ += max_rec.getLoad();
+    nodes.push_back(min_node);
+    std::push_heap(nodes.begin(), nodes.end(), CompProcType());
+  }
+}
+
+void GreedyLB::groupMigrate() {
+  debug_print(
+    lb, node,
+    "GreedyLB::groupMigrate: migrations={}\n", group_migrations_.size()
+  );
+
+  // Group roots route each move to the node currently holding the object
+  startMigrationCollective();
+  for (auto&& elm : group_migrations_) {
+    migrateObjectTo(std::get<0>(elm), std::get<1>(elm));
+  }
+  group_migrations_.clear();
+  finishMigrationCollective();
+}
+
 double GreedyLB::getAvgLoad() const {
   return stats.at(lb::Statistic::P_l).at(lb::StatisticQuantity::avg);
 }
@@ -309,6 +665,10 @@ void GreedyLB::loadOverBin(ObjBinType bin, ObjBinListType& bin_list) {
   load_over[bin].push_back(obj_id);
   bin_list.pop_back();
 
+  if (arguments::ArgConfig::vt_lb_memory_capacity > 0) {
+    load_over_bytes_[obj_id] = balance::ProcStats::getFootprint(obj_id);
+  }
+
   auto obj_iter = load_data->find(obj_id);
   vtAssert(obj_iter != load_data->end(), "Obj must exist in stats");
   auto const& obj_time_milli = loadMilli(obj_iter->second);
@@ -83,6 +83,7 @@ struct GreedyLB : BaseLB {
   bool   getDefaultAutoThreshold() const override {
     return greedy_auto_threshold_p;
   }
+  int32_t getMaxStageEpochs() const override { return useGroups() ? 1 : 0; }
 
 private:
   double getAvgLoad() const;
@@ -94,13 +95,34 @@ private:
   void reduceCollect();
   void calcLoadOver();
   void loadOverBin(ObjBinType bin, ObjBinListType& bin_list);
-  void runBalancer(ObjSampleType&& objs, LoadProfileType&& profile);
+  void runBalancer(
+    ObjSampleType&& objs, LoadProfileType&& profile,
+    FootprintType const& footprint, MemoryProfileType&& memory
+  );
+  bool popNodeFor(
+    std::vector<GreedyProc>& nodes, GreedyRecord const& rec,
+    MemoryProfileType& memory, GreedyProc& out
+  );
   void transferObjs(std::vector<GreedyProc>&& load);
   ObjIDType objSetNode(NodeType const& node, ObjIDType const& id);
   void recvObjsDirect(GreedyLBTypes::ObjIDType* objs);
   void finishedTransferExchange();
   void collectHandler(GreedyCollectMsg* msg);
 
+  // Hierarchical mode: greedy within groups of ranks, summaries between them
+  bool useGroups() const;
+  NodeType groupRoot(NodeType node) const;
+  NodeType groupEnd(NodeType root) const;
+  void sendToGroup();
+  void groupCollectHandler(GreedyGroupMsg* msg);
+  void groupSummaryHandler(GreedySummaryMsg* msg);
+  void groupFlowHandler(GreedyFlowMsg* msg);
+  void groupObjsHandler(GreedyObjsMsg* msg);
+  void computeGroupFlows();
+  void tryRunGroupBalancer();
+  void runGroupBalancer();
+  void groupMigrate();
+
   // This must stay static due to limitations in the scatter implementation
   // (does not work with objgroups)
   static void recvObjsHan(GreedyLBTypes::ObjIDType* objs);
@@ -114,7 +136,19 @@ private:
   LoadType this_load_begin = 0.0f;
   ObjSampleType load_over;
   std::size_t load_over_size = 0;
+  FootprintType load_over_bytes_;
   objgroup::proxy::Proxy<GreedyLB> proxy = {};
+
+  // State for the hierarchical mode
+  int32_t group_size_ = 0;
+  GreedyPayload group_payload_;
+  NodeType group_num_recv_ = 0;
+  std::vector<GreedyRecord> group_recs_;
+  std::map<NodeType,LoadType> group_summaries_;
+  bool group_flow_recv_ = false;
+  int32_t group_num_in_ = 0;
+  int32_t group_in_recv_ = 0;
+  TransferVecType group_migrations_;
 };
 
 }}}} /* end namespace vt::vrt::collection::lb */
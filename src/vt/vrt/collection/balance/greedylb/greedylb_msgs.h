@@ -51,14 +51,18 @@
 #include "vt/messaging/message.h"
 
 #include <unordered_map>
+#include <tuple>
+#include <vector>
 #include <cassert>
 
 namespace vt { namespace vrt { namespace collection { namespace lb {
 
 struct GreedyPayload : GreedyLBTypes {
   GreedyPayload() = default;
-  GreedyPayload(ObjSampleType const& in_sample, LoadType const& in_profile)
-    : sample_(in_sample)
+  GreedyPayload(
+    ObjSampleType const& in_sample, LoadType const& in_profile,
+    FootprintType const& in_footprint, int64_t in_memory
+  ) : sample_(in_sample), footprint_(in_footprint)
   {
     auto const& this_node = theContext()->getNode();
     auto iter = load_profile_.find(this_node);
@@ -69,6 +73,7 @@ struct GreedyPayload : GreedyLBTypes {
       std::forward_as_tuple(this_node),
       std::forward_as_tuple(in_profile)
     );
+    memory_profile_[this_node] = in_memory;
   }
 
   friend GreedyPayload operator+(GreedyPayload ld1, GreedyPayload const& ld2) {
@@ -89,28 +94,44 @@ struct GreedyPayload : GreedyLBTypes {
       vtAssert(load1.find(proc) == load1.end(), "Must not exist");
       load1[proc] = load;
     }
+    for (auto&& elm : ld2.footprint_) {
+      ld1.footprint_[elm.first] = elm.second;
+    }
+    for (auto&& elm : ld2.memory_profile_) {
+      ld1.memory_profile_[elm.first] = elm.second;
+    }
     return ld1;
   }
 
   template <typename SerializerT>
   void serialize(SerializerT& s) {
-    s | sample_ | load_profile_;
+    s | sample_ | load_profile_ | footprint_ | memory_profile_;
   }
 
   ObjSampleType const& getSample() const { return sample_; }
   ObjSampleType&& getSampleMove() { return std::move(sample_); }
   LoadProfileType const& getLoadProfile() const { return load_profile_; }
   LoadProfileType&& getLoadProfileMove() { return std::move(load_profile_); }
+  FootprintType const& getFootprint() const { return footprint_; }
+  MemoryProfileType const& getMemoryProfile() const { return memory_profile_; }
 
 protected:
   LoadProfileType load_profile_;
   ObjSampleType sample_;
+  // Only filled under --vt_lb_memory_capacity: the size of each candidate
+  // object, and the memory held by the objects of each node
+  FootprintType footprint_;
+  MemoryProfileType memory_profile_;
 };
 
 struct GreedyCollectMsg : GreedyLBTypes, collective::ReduceTMsg<GreedyPayload> {
   GreedyCollectMsg() = default;
-  GreedyCollectMsg(ObjSampleType const& in_load, LoadType const& in_profile)
-    : collective::ReduceTMsg<GreedyPayload>(GreedyPayload{in_load,in_profile})
+  GreedyCollectMsg(
+    ObjSampleType const& in_load, LoadType const& in_profile,
+    FootprintType const& in_footprint, int64_t in_memory
+  ) : collective::ReduceTMsg<GreedyPayload>(
+        GreedyPayload{in_load,in_profile,in_footprint,in_memory}
+      )
   { }
 
   #if greedylb_use_parserdes
@@ -134,6 +155,82 @@ struct GreedyCollectMsg : GreedyLBTypes, collective::ReduceTMsg<GreedyPayload> {
   }
 };
 
+/*
+ * Messages for the hierarchical mode: members send their payload to the group
+ * root, group roots send a surplus summary to the top root, and the top root
+ * answers with inter-group flows. Group roots then trade objects directly.
+ */
+struct GreedyGroupMsg : GreedyLBTypes, vt::Message {
+  GreedyGroupMsg() = default;
+  GreedyGroupMsg(
+    ObjSampleType const& in_load, LoadType const& in_profile,
+    FootprintType const& in_footprint, int64_t in_memory
+  ) : payload_(in_load,in_profile,in_footprint,in_memory)
+  { }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | payload_;
+  }
+
+  GreedyPayload const& getPayload() const { return payload_; }
+
+private:
+  GreedyPayload payload_;
+};
+
+struct GreedySummaryMsg : GreedyLBTypes, vt::Message {
+  GreedySummaryMsg() = default;
+  GreedySummaryMsg(NodeType in_group_root, LoadType in_surplus)
+    : group_root_(in_group_root), surplus_(in_surplus)
+  { }
+
+  NodeType group_root_ = uninitialized_destination;
+  LoadType surplus_ = 0.0f;
+};
+
+struct GreedyFlowMsg : GreedyLBTypes, vt::Message {
+  using FlowType    = std::tuple<NodeType,LoadType>;
+  using FlowVecType = std::vector<FlowType>;
+
+  GreedyFlowMsg() = default;
+  GreedyFlowMsg(FlowVecType const& in_out, int32_t in_num_in)
+    : out_(in_out), num_in_(in_num_in)
+  { }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | out_ | num_in_;
+  }
+
+  FlowVecType const& getOut() const { return out_; }
+  int32_t getNumIn() const { return num_in_; }
+
+private:
+  FlowVecType out_;
+  int32_t num_in_ = 0;
+};
+
+struct GreedyObjsMsg : GreedyLBTypes, vt::Message {
+  using RecType    = std::tuple<ObjIDType,LoadType,int64_t>;
+  using RecVecType = std::vector<RecType>;
+
+  GreedyObjsMsg() = default;
+  explicit GreedyObjsMsg(RecVecType const& in_recs)
+    : recs_(in_recs)
+  { }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | recs_;
+  }
+
+  RecVecType const& getRecs() const { return recs_; }
+
+private:
+  RecVecType recs_;
+};
+
 }}}} /* end namespace vt::vrt::collection::lb */
 
 #endif /*INCLUDED_VRT_COLLECTION_BALANCE_GREEDYLB_GREEDYLB_MSGS_H*/
@@ -63,22 +63,27 @@ struct GreedyLBTypes {
   using ObjSampleType = std::map<ObjBinType, ObjBinListType>;
   using LoadType = double;
   using LoadProfileType = std::unordered_map<NodeType,LoadType>;
+  using FootprintType = std::unordered_map<ObjIDType,int64_t>;
+  using MemoryProfileType = std::unordered_map<NodeType,int64_t>;
 };
 
 struct GreedyRecord {
   using ObjType = GreedyLBTypes::ObjIDType;
   using LoadType = GreedyLBTypes::LoadType;
 
-  GreedyRecord(ObjType const& in_obj, LoadType const& in_load)
-    : obj_(in_obj), load_(in_load)
+  GreedyRecord(
+    ObjType const& in_obj, LoadType const& in_load, int64_t in_bytes = 0
+  ) : obj_(in_obj), load_(in_load), bytes_(in_bytes)
   { }
 
   LoadType getLoad() const { return load_; }
   ObjType getObj() const { return obj_; }
+  int64_t getBytes() const { return bytes_; }
 
 private:
   GreedyLBTypes::ObjIDType obj_ = 0;
   LoadType load_ = 0.0f;
+  int64_t bytes_ = 0;
 };
 
 struct GreedyProc {
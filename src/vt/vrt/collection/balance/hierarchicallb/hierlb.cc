@@ -70,6 +70,7 @@ namespace vt { namespace vrt { namespace collection { namespace lb {
 
 void HierarchicalLB::init(objgroup::proxy::Proxy<HierarchicalLB> in_proxy) {
   proxy = in_proxy;
+  migration_cost_aware_ = true;
 }
 
 void HierarchicalLB::setupTree(double const threshold) {
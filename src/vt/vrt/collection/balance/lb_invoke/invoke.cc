@@ -52,8 +52,13 @@
 #include "vt/vrt/collection/balance/greedylb/greedylb.h"
 #include "vt/vrt/collection/balance/rotatelb/rotatelb.h"
 #include "vt/vrt/collection/balance/gossiplb/gossiplb.h"
+#include "vt/vrt/collection/balance/commlb/commlb.h"
 #include "vt/vrt/collection/messages/system_create.h"
 #include "vt/vrt/collection/manager.fwd.h"
+#include "vt/vrt/collection/balance/proc_stats.h"
+#include "vt/timing/timing.h"
+
+#include <algorithm>
 
 namespace vt { namespace vrt { namespace collection { namespace balance {
 
@@ -133,6 +138,12 @@ void LBManager::collectiveImpl(
   num_invocations_++;
 
   if (num_invocations_ == num_calls) {
+    // This boundary applies the overlapped LB instead of starting another one
+    if (async_pending_) {
+      arriveAsync(phase);
+      return;
+    }
+
     auto const& this_node = theContext()->getNode();
 
     if (this_node == 0 and not ArgType::vt_lb_quiet) {
@@ -145,22 +156,112 @@ void LBManager::collectiveImpl(
       );
     }
 
-    auto msg = makeMessage<StartLBMsg>(phase);
-    switch (lb) {
-    case LBType::HierarchicalLB: makeLB<lb::HierarchicalLB>(msg); break;
-    case LBType::GreedyLB:       makeLB<lb::GreedyLB>(msg);       break;
-    case LBType::RotateLB:       makeLB<lb::RotateLB>(msg);       break;
-    case LBType::GossipLB:       makeLB<lb::GossipLB>(msg);       break;
-    case LBType::NoLB:
-      vtAssert(false, "LBType::NoLB is not a valid LB for collectiveImpl");
-      break;
-    default:
-      vtAssert(false, "A valid LB must be passed to collectiveImpl");
-      break;
+    if (ArgType::vt_lb_async) {
+      startAsync(phase, lb);
+    } else {
+      startLB(phase, lb);
     }
   }
 }
 
+void LBManager::startLB(PhaseType phase, LBType lb) {
+  auto msg = makeMessage<StartLBMsg>(phase);
+  switch (lb) {
+  case LBType::HierarchicalLB: makeLB<lb::HierarchicalLB>(msg); break;
+  case LBType::GreedyLB:       makeLB<lb::GreedyLB>(msg);       break;
+  case LBType::RotateLB:       makeLB<lb::RotateLB>(msg);       break;
+  case LBType::GossipLB:       makeLB<lb::GossipLB>(msg);       break;
+  case LBType::CommLB:         makeLB<lb::CommLB>(msg);         break;
+  case LBType::NoLB:
+    vtAssert(false, "LBType::NoLB is not a valid LB for collectiveImpl");
+    break;
+  default:
+    vtAssert(false, "A valid LB must be passed to collectiveImpl");
+    break;
+  }
+}
+
+void LBManager::startAsync(PhaseType phase, LBType lb) {
+  debug_print(lb, node, "startAsync: phase={}\n", phase);
+
+  async_pending_ = true;
+  async_done_ = async_arrived_ = false;
+  async_phase_ = phase;
+  async_start_ = timing::Timing::getCurrentTime();
+
+  ProcStats::deferMigrations(true);
+  startLB(phase, lb);
+
+  // The LB took its own copy of this phase's stats, so they can go to perm IDs
+  // now: the temp maps are shared with the phase about to start
+  ProcStats::convertToPerm(phase);
+
+  continuePhase();
+}
+
+void LBManager::arriveAsync(PhaseType phase) {
+  debug_print(
+    lb, node, "arriveAsync: phase={}, done={}\n", phase, async_done_
+  );
+
+  async_arrived_ = true;
+  async_arrive_phase_ = phase;
+  async_arrive_ = timing::Timing::getCurrentTime();
+  if (async_done_) {
+    applyAsync();
+  }
+}
+
+void LBManager::finishedAsync() {
+  debug_print(
+    lb, node, "finishedAsync: arrived={}\n", async_arrived_
+  );
+
+  async_done_ = true;
+  async_end_ = timing::Timing::getCurrentTime();
+
+  if (destroy_lb_ != nullptr) {
+    destroy_lb_();
+    destroy_lb_ = nullptr;
+  }
+  if (async_arrived_) {
+    applyAsync();
+  }
+}
+
+void LBManager::applyAsync() {
+  // Only reached once this node is held at the next boundary, after the
+  // overlapped phase has created all of its collective epochs, so this one
+  // gets the same ID everywhere. The LB's own epochs were reserved when it
+  // started (see BaseLB::makeCollectiveEpoch)
+  auto epoch = theTerm()->makeEpochCollective();
+  theTerm()->addAction(epoch, [this]{ releaseAsync(); });
+  theMsg()->pushEpoch(epoch);
+  ProcStats::applyDeferredMigrations();
+  theMsg()->popEpoch(epoch);
+  theTerm()->finishedEpoch(epoch);
+}
+
+void LBManager::releaseAsync() {
+  auto const now = timing::Timing::getCurrentTime();
+  auto const lb_time = async_end_ - async_start_;
+  auto const hidden = std::min(async_end_, async_arrive_) - async_start_;
+  auto const exposed = now - async_arrive_;
+
+  if (theContext()->getNode() == 0) {
+    vt_print(
+      lb,
+      "LBManager: overlapped LB from phase={}: LB time={}, hidden={}, "
+      "exposed={}\n",
+      async_phase_, lb_time, hidden, exposed
+    );
+  }
+
+  async_pending_ = async_done_ = async_arrived_ = false;
+  ProcStats::startIterCleanup();
+  releaseNow(async_arrive_phase_);
+}
+
 void LBManager::waitLBCollective() {
   debug_print(
     lb, node,
@@ -189,9 +290,20 @@ void LBManager::waitLBCollective() {
     "finishedRunningLB\n"
   );
   auto proxy = getProxy();
+  if (proxy.get()->async_pending_) {
+    proxy.get()->finishedAsync();
+    return;
+  }
+  balance::ProcStats::startIterCleanup();
   proxy.get()->releaseImpl(phase);
 }
 
+/*static*/ void LBManager::recordMigrationTotals(
+  MigrationTotalsType const& totals
+) {
+  getProxy().get()->migration_totals_ = totals;
+}
+
 void LBManager::releaseImpl(PhaseType phase, std::size_t num_calls) {
   debug_print(
     lb, node,
@@ -205,7 +317,11 @@ void LBManager::releaseImpl(PhaseType phase, std::size_t num_calls) {
   );
   num_release_++;
   if (num_release_ == num_calls or num_release_ == num_invocations_) {
-    releaseNow(phase);
+    if (async_pending_) {
+      arriveAsync(phase);
+    } else {
+      releaseNow(phase);
+    }
   }
 }
 
@@ -222,13 +338,26 @@ void LBManager::releaseNow(PhaseType phase) {
     );
   }
 
-  auto msg = makeMessage<CollectionPhaseMsg>();
+  #if backend_check_enabled(trace_enabled)
+    // Phase-restricted tracing (--vt_trace_phase_*) keys off this transition
+    theTrace()->setPhase(phase + 1);
+  #endif
+
+  auto comm_matrix = theMsg()->getCommMatrix();
+  if (comm_matrix != nullptr) {
+    comm_matrix->endPhase(phase);
+  }
 
   // Destruct the objgroup that was used for LB
   if (destroy_lb_ != nullptr) {
     destroy_lb_();
     destroy_lb_ = nullptr;
   }
+  continuePhase();
+}
+
+void LBManager::continuePhase() {
+  auto msg = makeMessage<CollectionPhaseMsg>();
   releaseLBPhase(msg.get());
   synced_in_lb_ = false;
   num_invocations_ = num_release_ = 0;
@@ -52,12 +52,15 @@
 #include "vt/configs/arguments/args.h"
 #include "vt/objgroup/headers.h"
 
+#include <array>
+#include <cstdint>
 #include <functional>
 
 namespace vt { namespace vrt { namespace collection { namespace balance {
 
 struct LBManager {
   using ArgType = vt::arguments::ArgConfig;
+  using MigrationTotalsType = std::array<int64_t, 4>;
 
   LBManager() = default;
   LBManager(LBManager const&) = delete;
@@ -95,12 +98,36 @@ public:
    */
   static void finishedRunningLB(PhaseType phase);
 
+  /*
+   * Totals over all nodes from the last LB to finish, as BaseLB::finalize
+   * reports them: objects migrated, bytes migrated, moves rejected by cost
+   * and moves rejected by memory
+   */
+  static void recordMigrationTotals(MigrationTotalsType const& totals);
+  MigrationTotalsType const& getMigrationTotals() const {
+    return migration_totals_;
+  }
+
 protected:
   void collectiveImpl(
     PhaseType phase, LBType lb, bool manual, std::size_t num_calls = 1
   );
   void releaseImpl(PhaseType phase, std::size_t num_calls = 0);
   void releaseNow(PhaseType phase);
+  void continuePhase();
+  void startLB(PhaseType phase, LBType lb);
+
+  /*
+   * Overlapped LB (--vt_lb_async): the balancer is started at one phase
+   * boundary and the phase is released right away; its migrations are applied
+   * at the following boundary, once both it has finished and every element
+   * has arrived there
+   */
+  void startAsync(PhaseType phase, LBType lb);
+  void arriveAsync(PhaseType phase);
+  void finishedAsync();
+  void applyAsync();
+  void releaseAsync();
 
 public:
   template <typename MsgT>
@@ -125,6 +152,15 @@ private:
   LBType cached_lb_                        = LBType::NoLB;
   std::function<void()> destroy_lb_        = nullptr;
   bool synced_in_lb_                       = true;
+  bool async_pending_                      = false;
+  bool async_done_                         = false;
+  bool async_arrived_                      = false;
+  PhaseType async_phase_                   = no_lb_phase;
+  PhaseType async_arrive_phase_            = no_lb_phase;
+  TimeType async_start_                    = 0.0;
+  TimeType async_end_                      = 0.0;
+  TimeType async_arrive_                   = 0.0;
+  MigrationTotalsType migration_totals_    = {};
 
   static objgroup::proxy::Proxy<LBManager> proxy_;
 };
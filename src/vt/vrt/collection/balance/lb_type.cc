@@ -55,7 +55,8 @@ std::unordered_map<LBType,std::string> lb_names_ = {
   {LBType::GreedyLB,       std::string{"GreedyLB"      }},
   {LBType::HierarchicalLB, std::string{"HierarchicalLB"}},
   {LBType::RotateLB,       std::string{"RotateLB"      }},
-  {LBType::GossipLB,       std::string{"GossipLB"      }}
+  {LBType::GossipLB,       std::string{"GossipLB"      }},
+  {LBType::CommLB,         std::string{"CommLB"        }}
 };
 
 } /* end namespace balance */
@@ -69,8 +70,27 @@ std::unordered_map<Statistic,std::string> lb_stat_name_ = {
   {Statistic::O_l,         std::string{"O_l"}},
   {Statistic::O_c,         std::string{"O_c"}},
   {Statistic::O_t,         std::string{"O_t"}},
+  {Statistic::W_l_min,      std::string{"W_l_min"}},
+  {Statistic::W_l_max,      std::string{"W_l_max"}},
+  {Statistic::W_l_avg,      std::string{"W_l_avg"}},
+  {Statistic::W_l_std,      std::string{"W_l_std"}},
+  {Statistic::W_l_var,      std::string{"W_l_var"}},
+  {Statistic::W_l_skewness, std::string{"W_l_skewness"}},
+  {Statistic::W_l_kurtosis, std::string{"W_l_kurtosis"}},
+  {Statistic::W_c_min,      std::string{"W_c_min"}},
+  {Statistic::W_c_max,      std::string{"W_c_max"}},
+  {Statistic::W_c_avg,      std::string{"W_c_avg"}},
+  {Statistic::W_c_std,      std::string{"W_c_std"}},
+  {Statistic::W_c_var,      std::string{"W_c_var"}},
+  {Statistic::W_c_skewness, std::string{"W_c_skewness"}},
+  {Statistic::W_c_kurtosis, std::string{"W_c_kurtosis"}},
+  {Statistic::ObjectCardinality, std::string{"ObjectCardinality"}},
   {Statistic::ObjectRatio, std::string{"ObjectRatio"}},
-  {Statistic::EdgeRatio,   std::string{"EdgeRatio"}}
+  {Statistic::EdgeCardinality, std::string{"EdgeCardinality"}},
+  {Statistic::EdgeRatio,   std::string{"EdgeRatio"}},
+  {Statistic::PredictionError, std::string{"PredictionError"}},
+  {Statistic::ExternalEdgesCardinality, std::string{"ExternalEdgesCardinality"}},
+  {Statistic::InternalEdgesCardinality, std::string{"InternalEdgesCardinality"}}
 };
 
 } /* end namespace lb */
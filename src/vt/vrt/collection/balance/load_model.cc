@@ -0,0 +1,168 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                load_model.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/vrt/collection/balance/load_model.h"
+#include "vt/configs/arguments/args.h"
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <string>
+
+namespace vt { namespace vrt { namespace collection { namespace balance {
+
+TimeType PersistenceModel::predict(
+  HistoryType const& history, PhaseType const& phase
+) const {
+  return history.at(phase);
+}
+
+EMAModel::EMAModel(double in_alpha)
+  : alpha_(in_alpha)
+{
+  vtAbortIf(
+    alpha_ <= 0.0 or alpha_ > 1.0, "--vt_lb_model_alpha must be in (0,1]"
+  );
+  // Older phases contribute less than 0.1% of the average; skip them
+  horizon_ = alpha_ == 1.0 ? 1 : static_cast<PhaseType>(
+    std::ceil(std::log(1e-3) / std::log(1.0 - alpha_))
+  ) + 1;
+}
+
+TimeType EMAModel::predict(
+  HistoryType const& history, PhaseType const& phase
+) const {
+  auto const first = phase + 1 > horizon_ ? phase + 1 - horizon_ : 0;
+  TimeType avg = history.at(first);
+  for (auto i = first + 1; i <= phase; i++) {
+    avg = alpha_ * history.at(i) + (1.0 - alpha_) * avg;
+  }
+  return avg;
+}
+
+LinearTrendModel::LinearTrendModel(int32_t in_window)
+  : window_(in_window)
+{
+  vtAbortIf(window_ < 2, "--vt_lb_model_window must be at least 2 for trend");
+}
+
+TimeType LinearTrendModel::predict(
+  HistoryType const& history, PhaseType const& phase
+) const {
+  auto const n = std::min<PhaseType>(phase + 1, window_);
+  if (n < 2) {
+    return history.at(phase);
+  }
+
+  // Fit over x = 0..n-1 for the phases (phase-n+1)..phase, predict x = n
+  auto const first = phase + 1 - n;
+  double sum_x = 0.0, sum_y = 0.0, sum_xx = 0.0, sum_xy = 0.0;
+  for (PhaseType i = 0; i < n; i++) {
+    auto const x = static_cast<double>(i);
+    auto const y = history.at(first + i);
+    sum_x += x;
+    sum_y += y;
+    sum_xx += x * x;
+    sum_xy += x * y;
+  }
+  auto const denom = n * sum_xx - sum_x * sum_x;
+  auto const slope = (n * sum_xy - sum_x * sum_y) / denom;
+  auto const intercept = (sum_y - slope * sum_x) / n;
+  return std::max(0.0, intercept + slope * n);
+}
+
+PeriodicModel::PeriodicModel(int32_t in_period, int32_t in_window)
+  : period_(in_period), window_(in_window)
+{
+  vtAbortIf(period_ < 0, "--vt_lb_model_period must not be negative");
+  vtAbortIf(window_ < 1, "--vt_lb_model_window must be positive");
+}
+
+TimeType PeriodicModel::predict(
+  HistoryType const& history, PhaseType const& phase
+) const {
+  if (period_ > 0) {
+    auto const period = static_cast<PhaseType>(period_);
+    return phase + 1 >= period ? history.at(phase + 1 - period) : history.at(phase);
+  }
+
+  auto const n = std::min<PhaseType>(phase + 1, window_);
+  auto const begin = history.begin() + (phase + 1 - n);
+  return *std::max_element(begin, history.begin() + phase + 1);
+}
+
+std::unique_ptr<LoadModel> makeLoadModel(std::string const& name) {
+  using ArgType = vt::arguments::ArgConfig;
+
+  if (name == "persistence") {
+    return std::make_unique<PersistenceModel>();
+  } else if (name == "ema") {
+    return std::make_unique<EMAModel>(ArgType::vt_lb_model_alpha);
+  } else if (name == "trend") {
+    return std::make_unique<LinearTrendModel>(ArgType::vt_lb_model_window);
+  } else if (name == "periodic") {
+    return std::make_unique<PeriodicModel>(
+      ArgType::vt_lb_model_period, ArgType::vt_lb_model_window
+    );
+  }
+
+  vtAbort(fmt::format("Unknown load model \"{}\" for --vt_lb_model", name));
+  return nullptr;
+}
+
+LoadModel const& getLoadModel() {
+  using ArgType = vt::arguments::ArgConfig;
+
+  static std::unique_ptr<LoadModel> model = nullptr;
+  static std::string model_name = "";
+
+  if (model == nullptr or model_name != ArgType::vt_lb_model) {
+    model = makeLoadModel(ArgType::vt_lb_model);
+    model_name = ArgType::vt_lb_model;
+  }
+  return *model;
+}
+
+}}}} /* end namespace vt::vrt::collection::balance */
@@ -0,0 +1,140 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 load_model.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VRT_COLLECTION_BALANCE_LOAD_MODEL_H
+#define INCLUDED_VRT_COLLECTION_BALANCE_LOAD_MODEL_H
+
+#include "vt/config.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace vt { namespace vrt { namespace collection { namespace balance {
+
+/*
+ * A load model predicts the load of an object in the next phase from the loads
+ * measured in the phases so far. The balancers are handed the prediction, so
+ * the model decides what "the next phase" is expected to look like.
+ */
+struct LoadModel {
+  using HistoryType = std::vector<TimeType>;
+
+  virtual ~LoadModel() = default;
+
+  /*
+   * Predict the load of phase `phase + 1` from `history`, which holds the
+   * measured load of every phase up to and including `phase`
+   */
+  virtual TimeType predict(
+    HistoryType const& history, PhaseType const& phase
+  ) const = 0;
+};
+
+/*
+ * The next phase repeats the last one
+ */
+struct PersistenceModel : LoadModel {
+  TimeType predict(
+    HistoryType const& history, PhaseType const& phase
+  ) const override;
+};
+
+/*
+ * Exponential moving average, weighting the latest phase by `alpha`
+ */
+struct EMAModel : LoadModel {
+  explicit EMAModel(double in_alpha);
+
+  TimeType predict(
+    HistoryType const& history, PhaseType const& phase
+  ) const override;
+
+private:
+  double alpha_ = 0.5;
+  // Number of phases whose weight is still significant
+  PhaseType horizon_ = 1;
+};
+
+/*
+ * Least-squares line through the last `window` phases, extrapolated one phase
+ */
+struct LinearTrendModel : LoadModel {
+  explicit LinearTrendModel(int32_t in_window);
+
+  TimeType predict(
+    HistoryType const& history, PhaseType const& phase
+  ) const override;
+
+private:
+  int32_t window_ = 4;
+};
+
+/*
+ * With a known period, the phase one period back; otherwise the maximum over
+ * the last `window` phases, which covers a spike recurring with any period
+ * shorter than the window
+ */
+struct PeriodicModel : LoadModel {
+  PeriodicModel(int32_t in_period, int32_t in_window);
+
+  TimeType predict(
+    HistoryType const& history, PhaseType const& phase
+  ) const override;
+
+private:
+  int32_t period_ = 0;
+  int32_t window_ = 4;
+};
+
+std::unique_ptr<LoadModel> makeLoadModel(std::string const& name);
+
+/*
+ * The model selected with --vt_lb_model
+ */
+LoadModel const& getLoadModel();
+
+}}}} /* end namespace vt::vrt::collection::balance */
+
+#endif /*INCLUDED_VRT_COLLECTION_BALANCE_LOAD_MODEL_H*/
@@ -63,12 +63,36 @@ namespace vt { namespace vrt { namespace collection { namespace balance {
 std::vector<std::unordered_map<ElementIDType,TimeType>>
   ProcStats::proc_data_ = {};
 
+/*static*/
+std::vector<std::unordered_map<ElementIDType,TimeType>>
+  ProcStats::proc_cpu_data_ = {};
+
 /*static*/ std::vector<CommMapType> ProcStats::proc_comm_ = {};
 
+/*static*/
+std::vector<std::unordered_map<ElementIDType,TimeType>>
+  ProcStats::proc_pred_ = {};
+
+/*static*/
+std::vector<std::unordered_map<ElementIDType,TimeType>>
+  ProcStats::proc_pred_err_ = {};
+
+/*static*/ std::unordered_map<ElementIDType,std::size_t>
+  ProcStats::proc_footprint_ = {};
+
+/*static*/ std::unordered_map<ElementIDType,VirtualProxyType>
+  ProcStats::proc_collection_ = {};
+
 /*static*/
 std::unordered_map<ElementIDType,ProcStats::MigrateFnType>
   ProcStats::proc_migrate_ = {};
 
+/*static*/
+std::vector<std::tuple<ProcStats::MigrateFnType,NodeType>>
+  ProcStats::proc_deferred_ = {};
+
+/*static*/ bool ProcStats::defer_migrations_ = false;
+
 /*static*/ std::unordered_map<ElementIDType,ElementIDType>
   ProcStats::proc_temp_to_perm_ =  {};
 
@@ -81,35 +105,148 @@ std::unordered_map<ElementIDType,ProcStats::MigrateFnType>
 
 /*static*/ bool ProcStats::created_dir_ = false;
 
+/*static*/ std::unique_ptr<StatsBinaryWriter> ProcStats::stats_writer_ = nullptr;
+
+/*static*/ std::size_t ProcStats::stats_phases_written_ = 0;
+
+/*static*/ void ProcStats::addPrediction(
+  ElementIDType const& temp_id, PhaseType const& phase, TimeType const& pred
+) {
+  proc_pred_.resize(phase + 1);
+  proc_pred_.at(phase)[temp_id] = pred;
+}
+
+/*static*/ void ProcStats::addPredictionError(
+  ElementIDType const& temp_id, PhaseType const& phase, TimeType const& err
+) {
+  proc_pred_err_.resize(phase + 1);
+  proc_pred_err_.at(phase)[temp_id] = err;
+}
+
+/*static*/ void ProcStats::addCPUStats(
+  ElementIDType const& temp_id, PhaseType const& phase, TimeType const& cpu
+) {
+  proc_cpu_data_.resize(phase + 1);
+  proc_cpu_data_.at(phase)[temp_id] = cpu;
+}
+
+/*static*/ std::unordered_map<ElementIDType,TimeType> const&
+ProcStats::getMeasuredLoad(PhaseType const& phase) {
+  if (timing::Timing::balanceOnCPUTime()) {
+    // A node without elements in the phase has recorded no CPU time for it
+    static std::unordered_map<ElementIDType,TimeType> const empty_cpu = {};
+    return proc_cpu_data_.size() > phase ? proc_cpu_data_.at(phase) : empty_cpu;
+  }
+  return proc_data_.at(phase);
+}
+
+/*static*/ std::unordered_map<ElementIDType,TimeType> const&
+ProcStats::getPredictedLoad(PhaseType const& phase) {
+  if (proc_pred_.size() > phase) {
+    return proc_pred_.at(phase);
+  }
+  return getMeasuredLoad(phase);
+}
+
+/*static*/ void ProcStats::addFootprint(
+  ElementIDType const& temp_id, std::size_t bytes
+) {
+  proc_footprint_[temp_id] = bytes;
+}
+
+/*static*/ std::size_t ProcStats::getFootprint(ElementIDType const& temp_id) {
+  auto iter = proc_footprint_.find(temp_id);
+  return iter != proc_footprint_.end() ? iter->second : 0;
+}
+
+/*static*/ void ProcStats::deferMigrations(bool defer) {
+  defer_migrations_ = defer;
+}
+
+/*static*/ bool ProcStats::deferringMigrations() {
+  return defer_migrations_;
+}
+
+/*static*/ void ProcStats::deferMigration(
+  ElementIDType const& temp_id, NodeType to
+) {
+  auto iter = proc_migrate_.find(temp_id);
+  vtAssert(iter != proc_migrate_.end(), "Deferred object must live here");
+  proc_deferred_.emplace_back(iter->second, to);
+}
+
+/*static*/ std::size_t ProcStats::applyDeferredMigrations() {
+  auto const deferred = std::move(proc_deferred_);
+  proc_deferred_.clear();
+  defer_migrations_ = false;
+
+  debug_print(
+    lb, node,
+    "ProcStats::applyDeferredMigrations: count={}\n", deferred.size()
+  );
+
+  for (auto&& elm : deferred) {
+    std::get<0>(elm)(std::get<1>(elm));
+  }
+  return deferred.size();
+}
+
 /*static*/ void ProcStats::clearStats() {
   ProcStats::proc_comm_.clear();
   ProcStats::proc_data_.clear();
+  ProcStats::proc_cpu_data_.clear();
+  ProcStats::proc_pred_.clear();
+  ProcStats::proc_pred_err_.clear();
+  ProcStats::proc_footprint_.clear();
   ProcStats::proc_migrate_.clear();
+  ProcStats::proc_deferred_.clear();
+  ProcStats::proc_collection_.clear();
   ProcStats::proc_temp_to_perm_.clear();
   ProcStats::proc_perm_to_temp_.clear();
+  defer_migrations_ = false;
   next_elm_ = 1;
+  stats_phases_written_ = 0;
 }
 
 /*static*/ void ProcStats::startIterCleanup() {
+  // Stream the phase while the temp to perm mapping is still around
+  outputStatsPhases();
+
   // Convert the temp ID proc_data_ for the last iteration into perm ID for
   // stats output
-  auto const phase = proc_data_.size() - 1;
-  auto const prev_data = std::move(proc_data_[phase]);
-  std::unordered_map<ElementIDType,TimeType> new_data;
-  for (auto& elm : prev_data) {
-    auto iter = proc_temp_to_perm_.find(elm.first);
-    vtAssert(iter != proc_temp_to_perm_.end(), "Temp ID must exist");
-    auto perm_id = iter->second;
-    new_data[perm_id] = elm.second;
-  }
-  proc_data_[phase] = std::move(new_data);
+  convertToPerm(proc_data_.size() - 1);
+
+  // Predictions and sizes are keyed by temp ID and only needed by this LB
+  ProcStats::proc_pred_.clear();
+  ProcStats::proc_pred_err_.clear();
+  ProcStats::proc_footprint_.clear();
 
   // Create migrate lambdas and temp to perm map since LB is complete
   ProcStats::proc_migrate_.clear();
+  ProcStats::proc_collection_.clear();
   ProcStats::proc_temp_to_perm_.clear();
   ProcStats::proc_perm_to_temp_.clear();
 }
 
+/*static*/ void ProcStats::convertToPerm(PhaseType const& phase) {
+  auto toPerm = [](std::unordered_map<ElementIDType,TimeType>& data) {
+    auto const prev_data = std::move(data);
+    std::unordered_map<ElementIDType,TimeType> new_data;
+    for (auto& elm : prev_data) {
+      auto iter = proc_temp_to_perm_.find(elm.first);
+      vtAssert(iter != proc_temp_to_perm_.end(), "Temp ID must exist");
+      auto perm_id = iter->second;
+      new_data[perm_id] = elm.second;
+    }
+    data = std::move(new_data);
+  };
+
+  toPerm(proc_data_[phase]);
+  if (proc_cpu_data_.size() > phase) {
+    toPerm(proc_cpu_data_[phase]);
+  }
+}
+
 /*static*/ ElementIDType ProcStats::getNextElm() {
   auto const& this_node = theContext()->getNode();
   auto elm = next_elm_++;
@@ -123,13 +260,20 @@ std::unordered_map<ElementIDType,ProcStats::MigrateFnType>
   CollectionManager::releaseLBPhase(msg.get());
 }
 
-/*static*/ void ProcStats::createStatsFile() {
+/*static*/ std::string ProcStats::makeStatsFileName(std::string const& ext) {
   using ArgType = vt::arguments::ArgConfig;
   auto const node = theContext()->getNode();
   auto const base_file = std::string(ArgType::vt_lb_stats_file);
   auto const dir = std::string(ArgType::vt_lb_stats_dir);
-  auto const file = fmt::format("{}.{}.out", base_file, node);
-  auto const file_name = fmt::format("{}/{}", dir, file);
+  auto const file = fmt::format("{}.{}.{}", base_file, node, ext);
+  return fmt::format("{}/{}", dir, file);
+}
+
+/*static*/ void ProcStats::createStatsFile() {
+  using ArgType = vt::arguments::ArgConfig;
+  auto const node = theContext()->getNode();
+  auto const dir = std::string(ArgType::vt_lb_stats_dir);
+  auto const file_name = makeStatsFileName("out");
 
   debug_print(
     lb, node,
@@ -161,7 +305,75 @@ std::unordered_map<ElementIDType,ProcStats::MigrateFnType>
   }
 }
 
+/*static*/ void ProcStats::outputStatsPhases() {
+  using ArgType = vt::arguments::ArgConfig;
+
+  if (not ArgType::vt_lb_stats or not ArgType::vt_lb_stats_binary) {
+    return;
+  }
+
+  if (stats_writer_ == nullptr) {
+    // Phases are streamed from inside handlers, so unlike the text output this
+    // cannot wait on a barrier for node 0 to create the directory; every node
+    // tries instead, and an existing directory is fine
+    auto const dir = std::string(ArgType::vt_lb_stats_dir);
+    mkdir(dir.c_str(), S_IRWXU);
+
+    bool const compress = ArgType::vt_lb_stats_compress;
+    auto const file_name = makeStatsFileName(compress ? "bin.gz" : "bin");
+
+    debug_print(
+      lb, node,
+      "ProcStats: outputStatsPhases: create file={}\n", file_name
+    );
+
+    stats_writer_ = std::make_unique<StatsBinaryWriter>(
+      file_name, theContext()->getNode(), compress
+    );
+  }
+
+  auto const num_phases = proc_data_.size();
+  for (auto i = stats_phases_written_; i < num_phases; i++) {
+    CommMapType const empty_comm = {};
+    auto const& comm = i < proc_comm_.size() ? proc_comm_[i] : empty_comm;
+    std::unordered_map<ElementIDType,TimeType> const empty_cpu = {};
+    auto const& cpu = i < proc_cpu_data_.size() ? proc_cpu_data_[i] : empty_cpu;
+    StatsPhaseData data(i, proc_data_[i], cpu, proc_temp_to_perm_, comm);
+    stats_writer_->writePhase(data);
+
+    debug_print(
+      lb, node,
+      "ProcStats: outputStatsPhases: phase={}, objs={}, edges={}\n",
+      i, data.numObjs(), data.numEdges()
+    );
+  }
+  stats_phases_written_ = num_phases;
+
+  // Older phases are only retained for the end-of-run text output, so drop
+  // them once streamed; the current phase may still be read by the LB
+  for (std::size_t i = 0; i + 1 < num_phases; i++) {
+    proc_data_[i].clear();
+    if (i < proc_cpu_data_.size()) {
+      proc_cpu_data_[i].clear();
+    }
+    if (i < proc_comm_.size()) {
+      proc_comm_[i].clear();
+    }
+  }
+}
+
 /*static*/ void ProcStats::outputStatsFile() {
+  using ArgType = vt::arguments::ArgConfig;
+
+  if (ArgType::vt_lb_stats_binary) {
+    outputStatsPhases();
+    if (stats_writer_ != nullptr) {
+      stats_writer_->close();
+      stats_writer_ = nullptr;
+    }
+    return;
+  }
+
   if (stats_file_ == nullptr) {
     createStatsFile();
   }
@@ -173,8 +385,17 @@ std::unordered_map<ElementIDType,ProcStats::MigrateFnType>
   vt_print(lb, "outputStatsFile: file={}, iter={}\n", print_ptr(stats_file_), num_iters);
 
   for (size_t i = 0; i < num_iters; i++) {
+    // With CPU time recorded it follows the wall time on the object's line
+    auto const has_cpu = i < proc_cpu_data_.size();
     for (auto&& elm : ProcStats::proc_data_.at(i)) {
-      auto obj_str = fmt::format("{},{},{}\n", i, elm.first, elm.second);
+      auto obj_str = fmt::format("{},{},{}", i, elm.first, elm.second);
+      if (has_cpu) {
+        auto cpu_iter = proc_cpu_data_[i].find(elm.first);
+        if (cpu_iter != proc_cpu_data_[i].end()) {
+          obj_str += fmt::format(",{}", cpu_iter->second);
+        }
+      }
+      obj_str += "\n";
       fprintf(stats_file_, "%s", obj_str.c_str());
     }
     for (auto&& elm : ProcStats::proc_comm_.at(i)) {
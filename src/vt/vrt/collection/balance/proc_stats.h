@@ -50,6 +50,7 @@
 #include "vt/vrt/collection/balance/lb_comm.h"
 #include "vt/vrt/collection/balance/phase_msg.h"
 #include "vt/vrt/collection/balance/stats_msg.h"
+#include "vt/vrt/collection/balance/stats_binary.h"
 #include "vt/timing/timing.h"
 
 #include <vector>
@@ -58,6 +59,8 @@
 #include <functional>
 #include <cstdio>
 #include <cstdlib>
+#include <memory>
+#include <string>
 
 namespace vt { namespace vrt { namespace collection { namespace balance {
 
@@ -71,13 +74,69 @@ public:
     PhaseType const& phase, TimeType const& time, CommMapType const& comm
   );
 
+  /*
+   * Record the load model's prediction for the phase after `phase`, and the
+   * error of the prediction that was made for `phase`
+   */
+  static void addPrediction(
+    ElementIDType const& temp_id, PhaseType const& phase, TimeType const& pred
+  );
+  static void addPredictionError(
+    ElementIDType const& temp_id, PhaseType const& phase, TimeType const& err
+  );
+
+  /*
+   * Record the CPU time of an element for `phase` (--vt_lb_cpu_time), kept
+   * next to the wall time in proc_data_
+   */
+  static void addCPUStats(
+    ElementIDType const& temp_id, PhaseType const& phase, TimeType const& cpu
+  );
+
+  /*
+   * The measured loads the balancers work in: CPU time with --vt_lb_load=cpu,
+   * wall time otherwise
+   */
+  static std::unordered_map<ElementIDType,TimeType> const&
+  getMeasuredLoad(PhaseType const& phase);
+
+  /*
+   * The loads the balancers work from: the predicted loads when a load model
+   * ran for `phase`, the measured ones otherwise
+   */
+  static std::unordered_map<ElementIDType,TimeType> const&
+  getPredictedLoad(PhaseType const& phase);
+
+  /*
+   * Serialized size of each element for the upcoming LB, by temp ID
+   */
+  static void addFootprint(ElementIDType const& temp_id, std::size_t bytes);
+  static std::size_t getFootprint(ElementIDType const& temp_id);
+
+  /*
+   * With an overlapped LB (--vt_lb_async) the balancer runs alongside the next
+   * phase, so its migrations are queued and applied at the boundary after
+   */
+  static void deferMigrations(bool defer);
+  static bool deferringMigrations();
+  static void deferMigration(ElementIDType const& temp_id, NodeType to);
+  static std::size_t applyDeferredMigrations();
+
   static void clearStats();
   static void startIterCleanup();
+  static void convertToPerm(PhaseType const& phase);
   static void releaseLB();
 
   static void outputStatsFile();
 
+  /*
+   * Append every completed phase not yet written to the binary stats file
+   * (--vt_lb_stats_binary); a no-op otherwise
+   */
+  static void outputStatsPhases();
+
 private:
+  static std::string makeStatsFileName(std::string const& ext);
   static void createStatsFile();
   static void closeStatsFile();
 
@@ -89,13 +148,22 @@ public:
   static ElementIDType next_elm_;
 public:
   static std::vector<std::unordered_map<ElementIDType,TimeType>> proc_data_;
+  static std::vector<std::unordered_map<ElementIDType,TimeType>> proc_cpu_data_;
   static std::unordered_map<ElementIDType,MigrateFnType> proc_migrate_;
   static std::unordered_map<ElementIDType,ElementIDType> proc_temp_to_perm_;
   static std::unordered_map<ElementIDType,ElementIDType> proc_perm_to_temp_;
   static std::vector<CommMapType> proc_comm_;
+  static std::vector<std::unordered_map<ElementIDType,TimeType>> proc_pred_;
+  static std::vector<std::unordered_map<ElementIDType,TimeType>> proc_pred_err_;
+  static std::unordered_map<ElementIDType,std::size_t> proc_footprint_;
+  static std::unordered_map<ElementIDType,VirtualProxyType> proc_collection_;
+  static std::vector<std::tuple<MigrateFnType,NodeType>> proc_deferred_;
 private:
+  static bool defer_migrations_;
   static FILE* stats_file_;
   static bool created_dir_;
+  static std::unique_ptr<StatsBinaryWriter> stats_writer_;
+  static std::size_t stats_phases_written_;
 };
 
 }}}} /* end namespace vt::vrt::collection::balance */
@@ -88,6 +88,7 @@ template <typename ColT>
 
   proc_temp_to_perm_[temp_id] = perm_id;
   proc_perm_to_temp_[perm_id] = temp_id;
+  proc_collection_[temp_id] = col_elm->getProxy();
 
   auto migrate_iter = proc_migrate_.find(temp_id);
   if (migrate_iter == proc_migrate_.end()) {
@@ -0,0 +1,271 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               stats_binary.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include "vt/config.h"
+#include "vt/vrt/collection/balance/stats_binary.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <zlib.h>
+
+namespace vt { namespace vrt { namespace collection { namespace balance {
+
+StatsPhaseData::StatsPhaseData(
+  PhaseType in_phase,
+  std::unordered_map<ElementIDType,TimeType> const& load,
+  std::unordered_map<ElementIDType,TimeType> const& cpu,
+  std::unordered_map<ElementIDType,ElementIDType> const& temp_to_perm,
+  CommMapType const& comm
+) : phase_(in_phase)
+{
+  obj_perm_.reserve(load.size());
+  obj_temp_.reserve(load.size());
+  obj_load_.reserve(load.size());
+  obj_cpu_.reserve(cpu.size() > 0 ? load.size() : 0);
+  for (auto&& elm : load) {
+    // After an LB the phase is re-keyed by permanent ID and the temp mapping
+    // is gone; record the same ID in both columns in that case
+    auto iter = temp_to_perm.find(elm.first);
+    auto const perm = iter != temp_to_perm.end() ? iter->second : elm.first;
+    obj_perm_.push_back(perm);
+    obj_temp_.push_back(elm.first);
+    obj_load_.push_back(elm.second);
+    if (cpu.size() > 0) {
+      auto cpu_iter = cpu.find(elm.first);
+      obj_cpu_.push_back(cpu_iter != cpu.end() ? cpu_iter->second : 0.0);
+    }
+  }
+
+  edge_cat_.reserve(comm.size());
+  edge_bytes_.reserve(comm.size());
+  for (auto&& elm : comm) {
+    auto const& key = elm.first;
+    edge_cat_.push_back(static_cast<CategoryType>(key.cat_));
+    edge_from_.push_back(key.from_);
+    edge_from_temp_.push_back(key.from_temp_);
+    edge_to_.push_back(key.to_);
+    edge_to_temp_.push_back(key.to_temp_);
+    edge_nfrom_.push_back(key.nfrom_);
+    edge_nto_.push_back(key.nto_);
+    edge_bytes_.push_back(elm.second);
+  }
+}
+
+CommMapType StatsPhaseData::makeCommMap() const {
+  CommMapType comm;
+  for (std::size_t i = 0; i < numEdges(); i++) {
+    LBCommKey key;
+    key.cat_       = static_cast<CommCategory>(edge_cat_[i]);
+    key.from_      = edge_from_[i];
+    key.from_temp_ = edge_from_temp_[i];
+    key.to_        = edge_to_[i];
+    key.to_temp_   = edge_to_temp_[i];
+    key.nfrom_     = edge_nfrom_[i];
+    key.nto_       = edge_nto_[i];
+    comm[key] += edge_bytes_[i];
+  }
+  return comm;
+}
+
+StatsBinaryWriter::StatsBinaryWriter(
+  std::string const& file_name, NodeType node, bool compress
+) {
+  // "T" asks zlib for a transparent (uncompressed) stream
+  file_ = gzopen(file_name.c_str(), compress ? "wb6" : "wbT");
+  vtAssert(file_ != nullptr, "Must be able to open LB stats file");
+
+  uint64_t const magic = stats_binary_magic;
+  uint32_t const version = stats_binary_version;
+  int32_t const node32 = node;
+  writeRaw(&magic, sizeof(magic));
+  writeRaw(&version, sizeof(version));
+  writeRaw(&node32, sizeof(node32));
+}
+
+StatsBinaryWriter::~StatsBinaryWriter() {
+  close();
+}
+
+void StatsBinaryWriter::close() {
+  if (file_ != nullptr) {
+    gzclose(file_);
+    file_ = nullptr;
+  }
+}
+
+void StatsBinaryWriter::writeRaw(void const* ptr, std::size_t len) {
+  // gzwrite takes an unsigned length, so write huge columns in pieces
+  auto cur = static_cast<char const*>(ptr);
+  while (len > 0) {
+    auto const chunk = static_cast<unsigned>(
+      std::min<std::size_t>(len, 1u << 30)
+    );
+    auto const written = gzwrite(file_, cur, chunk);
+    vtAssert(written == static_cast<int>(chunk), "LB stats write failed");
+    cur += chunk;
+    len -= chunk;
+  }
+}
+
+template <typename T>
+void StatsBinaryWriter::writeColumn(std::vector<T> const& col) {
+  if (col.size() > 0) {
+    writeRaw(col.data(), col.size() * sizeof(T));
+  }
+}
+
+void StatsBinaryWriter::writePhase(StatsPhaseData const& data) {
+  vtAssert(file_ != nullptr, "LB stats file must be open");
+
+  uint64_t const phase = data.phase_;
+  uint64_t const num_objs = data.numObjs();
+  uint64_t const num_edges = data.numEdges();
+  uint64_t const num_cpu = data.obj_cpu_.size();
+  vtAssert(num_cpu == 0 or num_cpu == num_objs, "CPU times cover every obj");
+  writeRaw(&phase, sizeof(phase));
+  writeRaw(&num_objs, sizeof(num_objs));
+  writeRaw(&num_edges, sizeof(num_edges));
+  writeRaw(&num_cpu, sizeof(num_cpu));
+
+  writeColumn(data.obj_perm_);
+  writeColumn(data.obj_temp_);
+  writeColumn(data.obj_load_);
+  writeColumn(data.obj_cpu_);
+  writeColumn(data.edge_cat_);
+  writeColumn(data.edge_from_);
+  writeColumn(data.edge_from_temp_);
+  writeColumn(data.edge_to_);
+  writeColumn(data.edge_to_temp_);
+  writeColumn(data.edge_nfrom_);
+  writeColumn(data.edge_nto_);
+  writeColumn(data.edge_bytes_);
+
+  // Make each phase durable as soon as it is written
+  gzflush(file_, Z_SYNC_FLUSH);
+}
+
+StatsBinaryReader::StatsBinaryReader(std::string const& file_name) {
+  file_ = gzopen(file_name.c_str(), "rb");
+  if (file_ == nullptr) {
+    return;
+  }
+
+  uint64_t magic = 0;
+  uint32_t version = 0;
+  int32_t node32 = 0;
+  good_ =
+    readRaw(&magic, sizeof(magic)) and
+    readRaw(&version, sizeof(version)) and
+    readRaw(&node32, sizeof(node32)) and
+    magic == stats_binary_magic and
+    version >= 1 and version <= stats_binary_version;
+  node_ = static_cast<NodeType>(node32);
+  version_ = version;
+}
+
+StatsBinaryReader::~StatsBinaryReader() {
+  if (file_ != nullptr) {
+    gzclose(file_);
+    file_ = nullptr;
+  }
+}
+
+bool StatsBinaryReader::readRaw(void* ptr, std::size_t len) {
+  auto cur = static_cast<char*>(ptr);
+  while (len > 0) {
+    auto const chunk = static_cast<unsigned>(
+      std::min<std::size_t>(len, 1u << 30)
+    );
+    auto const read = gzread(file_, cur, chunk);
+    if (read != static_cast<int>(chunk)) {
+      return false;
+    }
+    cur += chunk;
+    len -= chunk;
+  }
+  return true;
+}
+
+template <typename T>
+bool StatsBinaryReader::readColumn(std::vector<T>& col, std::size_t len) {
+  col.resize(len);
+  return len == 0 or readRaw(col.data(), len * sizeof(T));
+}
+
+bool StatsBinaryReader::readPhase(StatsPhaseData& data) {
+  if (not good()) {
+    return false;
+  }
+
+  uint64_t phase = 0, num_objs = 0, num_edges = 0, num_cpu = 0;
+  if (not readRaw(&phase, sizeof(phase))) {
+    // Clean end of file
+    return false;
+  }
+
+  good_ =
+    readRaw(&num_objs, sizeof(num_objs)) and
+    readRaw(&num_edges, sizeof(num_edges)) and
+    (version_ < 2 or readRaw(&num_cpu, sizeof(num_cpu))) and
+    readColumn(data.obj_perm_, num_objs) and
+    readColumn(data.obj_temp_, num_objs) and
+    readColumn(data.obj_load_, num_objs) and
+    readColumn(data.obj_cpu_, num_cpu) and
+    readColumn(data.edge_cat_, num_edges) and
+    readColumn(data.edge_from_, num_edges) and
+    readColumn(data.edge_from_temp_, num_edges) and
+    readColumn(data.edge_to_, num_edges) and
+    readColumn(data.edge_to_temp_, num_edges) and
+    readColumn(data.edge_nfrom_, num_edges) and
+    readColumn(data.edge_nto_, num_edges) and
+    readColumn(data.edge_bytes_, num_edges);
+
+  data.phase_ = phase;
+  return good_;
+}
+
+}}}} /* end namespace vt::vrt::collection::balance */
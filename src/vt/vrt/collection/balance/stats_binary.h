@@ -0,0 +1,160 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                stats_binary.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VRT_COLLECTION_BALANCE_STATS_BINARY_H
+#define INCLUDED_VRT_COLLECTION_BALANCE_STATS_BINARY_H
+
+#include "vt/config.h"
+#include "vt/vrt/collection/balance/lb_common.h"
+#include "vt/vrt/collection/balance/lb_comm.h"
+
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+#include <zlib.h>
+
+namespace vt { namespace vrt { namespace collection { namespace balance {
+
+/*
+ * Binary LB statistics format, one file per rank.
+ *
+ *   header: magic (u64), version (u32), node (i32)
+ *   phase:  phase (u64), num_objs (u64), num_edges (u64), num_cpu (u64), then
+ *           one column after another: obj perm IDs, obj temp IDs, obj loads,
+ *           obj CPU times (num_cpu of them: none, or one per object), and for
+ *           the edges: category, from, from temp, to, to temp, node from, node
+ *           to, bytes
+ *
+ * Version 1 files have neither num_cpu nor the CPU column; they are still
+ * read.
+ *
+ * Phases are appended as they complete. The file is written through zlib, so
+ * it is gzip-compressed when requested and plain (transparent) otherwise; the
+ * reader accepts either.
+ */
+static constexpr uint64_t const stats_binary_magic   = 0x54415453424c5456;
+static constexpr uint32_t const stats_binary_version = 2;
+
+struct StatsPhaseData {
+  using CategoryType = typename std::underlying_type<CommCategory>::type;
+
+  StatsPhaseData() = default;
+  StatsPhaseData(
+    PhaseType in_phase,
+    std::unordered_map<ElementIDType,TimeType> const& load,
+    std::unordered_map<ElementIDType,TimeType> const& cpu,
+    std::unordered_map<ElementIDType,ElementIDType> const& temp_to_perm,
+    CommMapType const& comm
+  );
+
+  std::size_t numObjs() const { return obj_perm_.size(); }
+  std::size_t numEdges() const { return edge_bytes_.size(); }
+  bool hasCPU() const { return obj_cpu_.size() > 0; }
+  CommMapType makeCommMap() const;
+
+  PhaseType phase_ = 0;
+  std::vector<ElementIDType> obj_perm_;
+  std::vector<ElementIDType> obj_temp_;
+  std::vector<TimeType> obj_load_;
+  std::vector<TimeType> obj_cpu_;
+  std::vector<CategoryType> edge_cat_;
+  std::vector<ElementIDType> edge_from_;
+  std::vector<ElementIDType> edge_from_temp_;
+  std::vector<ElementIDType> edge_to_;
+  std::vector<ElementIDType> edge_to_temp_;
+  std::vector<NodeType> edge_nfrom_;
+  std::vector<NodeType> edge_nto_;
+  std::vector<CommBytesType> edge_bytes_;
+};
+
+struct StatsBinaryWriter {
+  StatsBinaryWriter(std::string const& file_name, NodeType node, bool compress);
+  StatsBinaryWriter(StatsBinaryWriter const&) = delete;
+  StatsBinaryWriter& operator=(StatsBinaryWriter const&) = delete;
+  ~StatsBinaryWriter();
+
+  void writePhase(StatsPhaseData const& data);
+  void close();
+
+private:
+  template <typename T>
+  void writeColumn(std::vector<T> const& col);
+  void writeRaw(void const* ptr, std::size_t len);
+
+private:
+  gzFile file_ = nullptr;
+};
+
+struct StatsBinaryReader {
+  explicit StatsBinaryReader(std::string const& file_name);
+  StatsBinaryReader(StatsBinaryReader const&) = delete;
+  StatsBinaryReader& operator=(StatsBinaryReader const&) = delete;
+  ~StatsBinaryReader();
+
+  bool good() const { return file_ != nullptr and good_; }
+  NodeType getNode() const { return node_; }
+
+  /*
+   * Read the next phase into `data`; returns false at the end of the file
+   */
+  bool readPhase(StatsPhaseData& data);
+
+private:
+  template <typename T>
+  bool readColumn(std::vector<T>& col, std::size_t len);
+  bool readRaw(void* ptr, std::size_t len);
+
+private:
+  gzFile file_ = nullptr;
+  bool good_ = false;
+  NodeType node_ = uninitialized_destination;
+  uint32_t version_ = 0;
+};
+
+}}}} /* end namespace vt::vrt::collection::balance */
+
+#endif /*INCLUDED_VRT_COLLECTION_BALANCE_STATS_BINARY_H*/
@@ -70,6 +70,13 @@ struct LoadData {
     debug_print(lb, node, "operator+: a1.N_={}, a2.N_={}\n", a1.N_, a2.N_);
     debug_print(lb, node, "operator+: a1.avg_={}, a2.avg_={}\n", a1.avg_, a2.avg_);
 
+    // An empty side (no samples) must not drag min/max towards zero
+    if (a2.N_ == 0) {
+      return a1;
+    } else if (a1.N_ == 0) {
+      return a2;
+    }
+
     int32_t N            = a1.N_ + a2.N_;
     double delta         = a2.avg_ - a1.avg_;
     double delta_sur_N   = delta / static_cast<double>(N);
@@ -127,6 +134,11 @@ struct LoadData {
   TimeType stdv() const { return std::sqrt(var()); }
   int32_t  npr() const { return P_; }
 
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | max_ | sum_ | min_ | avg_ | M2_ | M3_ | M4_ | N_ | P_;
+  }
+
   TimeType max_ = 0.0;
   TimeType sum_ = 0.0;
   TimeType min_ = 0.0;
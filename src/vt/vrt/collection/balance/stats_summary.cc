@@ -0,0 +1,212 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               stats_summary.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#include "vt/config.h"
+#include "vt/vrt/collection/balance/stats_summary.h"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <string>
+#include <type_traits>
+
+#include "fmt/format.h"
+
+namespace vt { namespace vrt { namespace collection { namespace balance {
+
+std::size_t histogramBucket(TimeType const load) {
+  auto const us = load * 1e6;
+  if (not (us >= 1.0)) {
+    return 0;
+  }
+  auto const bucket = static_cast<std::size_t>(std::floor(std::log2(us))) + 1;
+  return std::min(bucket, stats_hist_buckets - 1);
+}
+
+StatsSummary::StatsSummary(std::size_t in_top_k)
+  : stats_(lb::lb_stat_name_.size()),
+    obj_hist_(stats_hist_buckets, 0),
+    proc_hist_(stats_hist_buckets, 0),
+    top_k_(in_top_k)
+{ }
+
+/*friend*/ StatsSummary operator+(StatsSummary s1, StatsSummary const& s2) {
+  for (std::size_t i = 0; i < s1.stats_.size() and i < s2.stats_.size(); i++) {
+    s1.stats_[i] = s1.stats_[i] + s2.stats_[i];
+  }
+  for (std::size_t i = 0; i < s1.obj_hist_.size() and i < s2.obj_hist_.size(); i++) {
+    s1.obj_hist_[i] += s2.obj_hist_[i];
+    s1.proc_hist_[i] += s2.proc_hist_[i];
+  }
+
+  // Each side is already sorted and cut to the K heaviest
+  std::vector<StatsSummary::TopType> top;
+  std::merge(
+    s1.top_.begin(), s1.top_.end(), s2.top_.begin(), s2.top_.end(),
+    std::back_inserter(top),
+    [](StatsSummary::TopType const& a, StatsSummary::TopType const& b) {
+      return std::get<2>(a) > std::get<2>(b);
+    }
+  );
+  if (top.size() > s1.top_k_) {
+    top.resize(s1.top_k_);
+  }
+  s1.top_ = std::move(top);
+
+  for (auto&& elm : s2.collections_) {
+    s1.collections_[elm.first] = s1.collections_[elm.first] + elm.second;
+  }
+  return s1;
+}
+
+void StatsSummary::addStatistic(lb::Statistic stat, LoadData const& ld) {
+  using StatisticUnderType = typename std::underlying_type<lb::Statistic>::type;
+  auto const idx = static_cast<std::size_t>(static_cast<StatisticUnderType>(stat));
+  vtAssert(idx < stats_.size(), "Statistic must have a name");
+  stats_[idx] = ld;
+}
+
+void StatsSummary::addObject(
+  ElementIDType perm_id, NodeType node, TimeType load,
+  VirtualProxyType collection
+) {
+  obj_hist_[histogramBucket(load)]++;
+  collections_[collection] = collections_[collection] + LoadData(load);
+
+  auto const rec = std::make_tuple(perm_id, node, load);
+  auto iter = std::upper_bound(
+    top_.begin(), top_.end(), rec,
+    [](TopType const& a, TopType const& b) {
+      return std::get<2>(a) > std::get<2>(b);
+    }
+  );
+  if (static_cast<std::size_t>(iter - top_.begin()) < top_k_) {
+    top_.insert(iter, rec);
+    if (top_.size() > top_k_) {
+      top_.pop_back();
+    }
+  }
+}
+
+void StatsSummary::addProcessor(TimeType load) {
+  proc_hist_[histogramBucket(load)]++;
+}
+
+static std::string jsonNumber(double const val) {
+  // JSON has no representation for these; skewness and kurtosis of a single
+  // sample, for one, are not finite
+  if (not std::isfinite(val)) {
+    return "null";
+  }
+  return fmt::format("{}", val);
+}
+
+static std::string jsonLoadData(LoadData const& ld) {
+  return fmt::format(
+    "{{\"min\":{},\"max\":{},\"avg\":{},\"sum\":{},\"std\":{},\"var\":{},"
+    "\"skw\":{},\"kur\":{},\"imb\":{},\"car\":{},\"npr\":{}}}",
+    jsonNumber(ld.min()), jsonNumber(ld.max()), jsonNumber(ld.avg()),
+    jsonNumber(ld.sum()), jsonNumber(ld.stdv()), jsonNumber(ld.var()),
+    jsonNumber(ld.skew()), jsonNumber(ld.krte()), jsonNumber(ld.I()),
+    ld.N_, ld.npr()
+  );
+}
+
+static std::string jsonHistogram(std::vector<int64_t> const& hist) {
+  std::string out = "[";
+  for (std::size_t i = 0; i < hist.size(); i++) {
+    out += fmt::format("{}{}", i == 0 ? "" : ",", hist[i]);
+  }
+  return out + "]";
+}
+
+std::string StatsSummary::toJSON(PhaseType phase) const {
+  using StatisticUnderType = typename std::underlying_type<lb::Statistic>::type;
+
+  std::string stats = "{";
+  bool first = true;
+  for (std::size_t i = 0; i < stats_.size(); i++) {
+    if (stats_[i].N_ == 0) {
+      continue;
+    }
+    auto const stat = static_cast<lb::Statistic>(static_cast<StatisticUnderType>(i));
+    stats += fmt::format(
+      "{}\"{}\":{}", first ? "" : ",", lb::lb_stat_name_[stat],
+      jsonLoadData(stats_[i])
+    );
+    first = false;
+  }
+  stats += "}";
+
+  std::string top = "[";
+  for (std::size_t i = 0; i < top_.size(); i++) {
+    top += fmt::format(
+      "{}{{\"id\":{},\"node\":{},\"load\":{}}}", i == 0 ? "" : ",",
+      std::get<0>(top_[i]), std::get<1>(top_[i]),
+      jsonNumber(std::get<2>(top_[i]))
+    );
+  }
+  top += "]";
+
+  std::string cols = "[";
+  first = true;
+  for (auto&& elm : collections_) {
+    cols += fmt::format(
+      "{}{{\"proxy\":{},\"O_l\":{}}}", first ? "" : ",", elm.first,
+      jsonLoadData(elm.second)
+    );
+    first = false;
+  }
+  cols += "]";
+
+  return fmt::format(
+    "{{\"phase\":{},\"stats\":{},\"hist_unit\":\"log2_us\","
+    "\"O_l_hist\":{},\"P_l_hist\":{},\"top\":{},\"collections\":{}}}",
+    phase, stats, jsonHistogram(obj_hist_), jsonHistogram(proc_hist_), top,
+    cols
+  );
+}
+
+}}}} /* end namespace vt::vrt::collection::balance */
@@ -0,0 +1,132 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               stats_summary.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#if !defined INCLUDED_VRT_COLLECTION_BALANCE_STATS_SUMMARY_H
+#define INCLUDED_VRT_COLLECTION_BALANCE_STATS_SUMMARY_H
+
+#include "vt/config.h"
+#include "vt/vrt/collection/balance/lb_common.h"
+#include "vt/vrt/collection/balance/stats_msg.h"
+#include "vt/collective/reduce/reduce.h"
+
+#include <cstdint>
+#include <map>
+#include <string>
+#include <tuple>
+#include <vector>
+
+namespace vt { namespace vrt { namespace collection { namespace balance {
+
+/*
+ * Number of log2 buckets in the load histograms: bucket i counts loads of
+ * [2^(i-1), 2^i) microseconds, bucket 0 those under a microsecond, and the
+ * last one everything above
+ */
+static constexpr std::size_t const stats_hist_buckets = 32;
+
+std::size_t histogramBucket(TimeType const load);
+
+/*
+ * Everything the LB statistics summary reports for a phase, reduced across
+ * ranks in a single pass: every lb::Statistic, object and processor load
+ * histograms, the heaviest objects, and object loads per collection
+ */
+struct StatsSummary {
+  // Permanent ID, node and load of an object
+  using TopType = std::tuple<ElementIDType,NodeType,TimeType>;
+
+  StatsSummary() = default;
+  explicit StatsSummary(std::size_t in_top_k);
+
+  friend StatsSummary operator+(StatsSummary s1, StatsSummary const& s2);
+
+  /*
+   * Statistics left empty (no samples) on a rank do not take part in the
+   * reduction, and are omitted from the output when empty everywhere
+   */
+  void addStatistic(lb::Statistic stat, LoadData const& ld);
+  void addObject(
+    ElementIDType perm_id, NodeType node, TimeType load,
+    VirtualProxyType collection
+  );
+  void addProcessor(TimeType load);
+
+  /*
+   * One line of JSON describing the phase
+   */
+  std::string toJSON(PhaseType phase) const;
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | stats_ | obj_hist_ | proc_hist_ | top_ | top_k_ | collections_;
+  }
+
+  std::vector<LoadData> stats_;
+  std::vector<int64_t> obj_hist_;
+  std::vector<int64_t> proc_hist_;
+  std::vector<TopType> top_;
+  std::size_t top_k_ = 0;
+  std::map<VirtualProxyType,LoadData> collections_;
+};
+
+struct StatsSummaryMsg : collective::ReduceTMsg<StatsSummary> {
+  StatsSummaryMsg() = default;
+  StatsSummaryMsg(StatsSummary&& in_summary, PhaseType in_phase)
+    : collective::ReduceTMsg<StatsSummary>(std::move(in_summary)),
+      phase_(in_phase)
+  { }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    ReduceTMsg<StatsSummary>::invokeSerialize(s);
+    s | phase_;
+  }
+
+  PhaseType phase_ = 0;
+};
+
+}}}} /* end namespace vt::vrt::collection::balance */
+
+#endif /*INCLUDED_VRT_COLLECTION_BALANCE_STATS_SUMMARY_H*/
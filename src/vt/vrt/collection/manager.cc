@@ -48,6 +48,10 @@
 #include "vt/vrt/collection/manager.h"
 #include "vt/vrt/collection/balance/lb_invoke/invoke.h"
 
+#include <algorithm>
+#include <tuple>
+#include <vector>
+
 namespace vt { namespace vrt { namespace collection {
 
 CollectionManager::CollectionManager() {
@@ -116,6 +120,13 @@ void CollectionManager::startPhaseCollective(
 #endif
 }
 
+SectionIDType CollectionManager::makeSectionID() {
+  // Sections are identified by the creating node in the upper bits so that
+  // identifiers are unique without any coordination
+  auto const this_node = static_cast<SectionIDType>(theContext()->getNode());
+  return (this_node << 48) | next_section_++;
+}
+
 DispatchBasePtrType
 getDispatcher(auto_registry::AutoHandlerType const& han) {
   return theCollection()->getDispatcher(han);
@@ -140,4 +151,54 @@ void CollectionManager::setCurrentContext(
   cur_context_temp_elm_id_ = temp;
 }
 
+void CollectionManager::closeContribRound(
+  ReduceIDType const& id, SequentialIDType seq
+) {
+  auto& state = contrib_state_[id];
+  auto iter = state.open_.find(seq);
+  vtAssert(iter != state.open_.end(), "Round must be open to close it");
+
+  auto finish = std::move(iter->second.finish_);
+  state.open_.erase(iter);
+  state.finished_ = std::max(state.finished_, seq);
+  finish();
+}
+
+void CollectionManager::migrateContribRounds(
+  VirtualProxyType const& proxy,
+  std::unordered_map<TagType, SequentialIDType> const& contrib_seq,
+  bool const arriving
+) {
+  std::vector<std::tuple<ReduceIDType,SequentialIDType>> completed;
+
+  for (auto&& elm : contrib_state_) {
+    if (std::get<0>(elm.first) != proxy) {
+      continue;
+    }
+
+    auto const tag = std::get<1>(elm.first);
+    auto const iter = contrib_seq.find(tag);
+    auto const count = iter == contrib_seq.end() ? 0 : iter->second;
+
+    // Only the open rounds the element has yet to contribute to change
+    for (auto&& round : elm.second.open_) {
+      if (round.first <= count) {
+        continue;
+      }
+      if (arriving) {
+        round.second.expected_++;
+      } else {
+        round.second.expected_--;
+        if (round.second.num_contrib_ == round.second.expected_) {
+          completed.emplace_back(elm.first, round.first);
+        }
+      }
+    }
+  }
+
+  for (auto&& done : completed) {
+    closeContribRound(std::get<0>(done), std::get<1>(done));
+  }
+}
+
 }}} /* end namespace vt::vrt::collection */
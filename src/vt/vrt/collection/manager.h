@@ -64,6 +64,10 @@
 #include "vt/vrt/collection/dispatch/dispatch.h"
 #include "vt/vrt/collection/dispatch/registry.h"
 #include "vt/vrt/collection/staged_token/token.h"
+#include "vt/vrt/collection/reducable/reduce_accum.h"
+#include "vt/vrt/collection/section/section_types.h"
+#include "vt/vrt/collection/section/section_msgs.h"
+#include "vt/vrt/collection/section/section_proxy.h"
 #include "vt/vrt/proxy/collection_proxy.h"
 #include "vt/topos/mapping/mapping_headers.h"
 #include "vt/messaging/message.h"
@@ -118,6 +122,13 @@ struct CollectionManager {
   using DispatchHandlerType = auto_registry::AutoHandlerType;
   using ActionVecType = std::vector<ActionType>;
   using ArgType = vt::arguments::ArgConfig;
+  using LocalDeliverFnType = void(*)(MsgSharedPtr<BaseMessage> const&);
+
+  struct LocalSendType {
+    MsgSharedPtr<BaseMessage> msg_ = nullptr;
+    EpochType epoch_ = no_epoch;
+    LocalDeliverFnType deliver_ = nullptr;
+  };
 
   template <typename ColT, typename IndexT = typename ColT::IndexType>
   using DistribConstructFn = std::function<VirtualPtrType<ColT>(IndexT idx)>;
@@ -417,6 +428,51 @@ public:
     typename ColT::IndexType const& idx
   );
 
+  /*
+   *  Contribute a value from local element `idx' to a collection reduction.
+   *  The value is folded into a per-node accumulator with `OpT' and no message
+   *  is allocated per element; once every local element has contributed, one
+   *  message per node enters the reduction tree.
+   *
+   *  The n-th contribution of an element with `tag' belongs to the n-th
+   *  reduction with that tag, so several may be in flight at once. Elements
+   *  may migrate between contributions, but not into a node that has already
+   *  completed a reduction they have yet to contribute to.
+   */
+  template <typename OpT, typename ColT, typename T>
+  void contribute(
+    CollectionProxyWrapType<ColT, typename ColT::IndexType> const& toProxy,
+    typename ColT::IndexType const& idx, T const& value,
+    Callback<collective::ReduceTMsg<T>> cb, TagType tag = no_tag
+  );
+
+private:
+  template <typename OpT, typename ColT, typename T>
+  void finishContribute(
+    CollectionProxyWrapType<ColT, typename ColT::IndexType> const& toProxy,
+    TagType tag, SequentialIDType seq
+  );
+
+  void closeContribRound(ReduceIDType const& id, SequentialIDType seq);
+
+  /*
+   *  Follow an element that migrates in or out of this node with the rounds
+   *  it still owes a contribution to
+   */
+  void migrateContribRounds(
+    VirtualProxyType const& proxy,
+    std::unordered_map<TagType, SequentialIDType> const& contrib_seq,
+    bool const arriving
+  );
+
+  template <typename ColT, typename MsgT, ActiveTypedFnType<MsgT> *f>
+  SequentialIDType reduceMsgImpl(
+    CollectionProxyWrapType<ColT, typename ColT::IndexType> const& toProxy,
+    MsgT *const msg, ReduceIdxFuncType<typename ColT::IndexType> expr_fn,
+    SequentialIDType seq, TagType tag, NodeType root, bool const node_accum
+  );
+
+public:
   /*
    *  Broadcast message to all elements of a collection
    */
@@ -518,6 +574,71 @@ public:
   template <typename ColT, typename IndexT, typename MsgT>
   messaging::PendingSend broadcastFromRoot(MsgT* msg);
 
+  /*
+   *  Sections: multicast a message to a subset of the elements of a
+   *  collection. The routing (per-node index lists and a spanning tree over
+   *  the participating nodes) is computed once when the section is created
+   *  and cached on each node for subsequent multicasts.
+   */
+  template <typename ColT, typename IndexT>
+  CollectionSection<ColT,IndexT> createSection(
+    CollectionProxyWrapType<ColT,IndexT> const& proxy,
+    std::vector<IndexT> const& idxs
+  );
+
+  template <typename ColT, typename IndexT>
+  CollectionSection<ColT,IndexT> createSection(
+    CollectionProxyWrapType<ColT,IndexT> const& proxy,
+    SectionIdxFuncType<IndexT> fn
+  );
+
+  template <
+    typename MsgT,
+    ActiveColTypedFnType<MsgT,typename MsgT::CollectionType> *f
+  >
+  messaging::PendingSend multicastMsg(
+    CollectionSection<typename MsgT::CollectionType> const& section,
+    MsgT *msg
+  );
+
+  template <
+    typename MsgT,
+    ActiveColMemberTypedFnType<MsgT,typename MsgT::CollectionType> f
+  >
+  messaging::PendingSend multicastMsg(
+    CollectionSection<typename MsgT::CollectionType> const& section,
+    MsgT *msg
+  );
+
+  template <typename MsgT, typename ColT, typename IdxT>
+  messaging::PendingSend multicastMsgUntypedHandler(
+    CollectionSection<ColT,IdxT> const& section, MsgT *msg,
+    HandlerType const& handler, bool const member
+  );
+
+  template <typename ColT, typename IndexT, typename MsgT>
+  static void sectionMulticastHandler(MsgT* msg);
+  template <typename ColT, typename IndexT>
+  static void sectionSetupHandler(SectionSetupMsg<ColT,IndexT>* msg);
+
+private:
+  template <typename ColT, typename IndexT>
+  void buildSection(
+    VirtualProxyType const& proxy, SectionIDType const& section,
+    std::vector<IndexT> const& idxs
+  );
+
+  template <typename ColT, typename IndexT>
+  void installSection(
+    VirtualProxyType const& proxy, SectionIDType const& section,
+    SectionRoute<IndexT>&& route
+  );
+
+  template <typename ColT, typename IndexT, typename MsgT>
+  void multicastFromNode(MsgT* msg);
+
+  SectionIDType makeSectionID();
+
 public:
   /*
    * Vrt collection type/handle registration for typeless dispatch
@@ -729,6 +850,20 @@ public:
   template <typename=void>
   bool scheduler();
 
+private:
+  /*
+   *  Local fast path: a send to an element registered on this node is handed
+   *  off by pointer to the local ready queue, bypassing the location manager
+   */
+  template <typename MsgT, typename ColT, typename IdxT>
+  bool tryLocalSend(
+    VirtualElmProxyType<ColT> const& proxy, MsgT *msg,
+    HandlerType const& handler, bool const member, EpochType const& epoch
+  );
+
+  template <typename MsgT, typename ColT, typename IdxT>
+  static void localDeliver(MsgSharedPtr<BaseMessage> const& msg);
+
 public:
   template <typename ColT, typename IndexT>
   NodeType getMappedNode(
@@ -838,13 +973,17 @@ private:
   BufferedActionType buffered_group_;
   std::unordered_set<VirtualProxyType> constructed_;
   std::unordered_map<ReduceIDType,SequentialIDType> reduce_cur_seq_;
+  std::unordered_map<ReduceIDType,ContribState> contrib_state_;
   std::vector<ActionFinishedLBType> lb_continuations_ = {};
   std::unordered_map<VirtualProxyType,NoElementActionType> lb_no_elm_ = {};
   std::unordered_map<VirtualProxyType,ActionVecType> insert_finished_action_ = {};
   std::unordered_map<VirtualProxyType,ActionVecType> user_insert_action_ = {};
   std::unordered_map<TagType,VirtualIDType> dist_tag_id_ = {};
   std::deque<ActionType> work_units_ = {};
+  std::deque<LocalSendType> local_ready_ = {};
   std::unordered_map<VirtualProxyType,ActionType> release_lb_ = {};
+  std::unordered_map<SectionIDType,ActionVecType> pending_sections_ = {};
+  SectionIDType next_section_ = 1;
   balance::ElementIDType cur_context_temp_elm_id_ = balance::no_element_id;
   balance::ElementIDType cur_context_perm_elm_id_ = balance::no_element_id;
 };
@@ -864,6 +1003,22 @@ namespace details
   {
     static typename CollectionManager::BcastBufferType<ColT> m_;
   };
+
+  template <typename T>
+  struct NodeAccums
+  {
+    static std::unordered_map<
+      collective::reduce::ReduceIdentifierType, NodeAccum<T>
+    > m_;
+  };
+
+  template <typename ColT>
+  struct Sections
+  {
+    static std::unordered_map<
+      SectionIDType, SectionRoute<typename ColT::IndexType>
+    > m_;
+  };
 }
 
 }}} /* end namespace vt::vrt::collection */
@@ -884,6 +1039,7 @@ extern vrt::collection::CollectionManager* theCollection();
 #include "vt/vrt/collection/destroy/destroyable.impl.h"
 #include "vt/vrt/collection/destroy/manager_destroy_attorney.impl.h"
 #include "vt/vrt/collection/broadcast/broadcastable.impl.h"
+#include "vt/vrt/collection/section/section_proxy.impl.h"
 #include "vt/vrt/collection/balance/elm_stats.impl.h"
 #include "vt/vrt/collection/types/insertable.impl.h"
 #include "vt/vrt/collection/types/indexable.impl.h"
@@ -79,12 +79,14 @@
 #include "vt/serialization/auto_sizing/sizing.h"
 #include "vt/collective/reduce/reduce_hash.h"
 #include "vt/runnable/collection.h"
+#include "vt/scheduler/scheduler.h"
 
 #include <tuple>
 #include <utility>
 #include <functional>
 #include <cassert>
 #include <memory>
+#include <map>
 
 #include "fmt/format.h"
 #include "fmt/ostream.h"
@@ -98,6 +100,16 @@ template <typename T>
 template <typename ColT>
 /*static*/ CollectionManager::BcastBufferType<ColT>
 Broadcasts<ColT>::m_ = {};
+
+template <typename ColT>
+/*static*/ std::unordered_map<
+  SectionIDType, SectionRoute<typename ColT::IndexType>
+> Sections<ColT>::m_ = {};
+
+template <typename T>
+/*static*/ std::unordered_map<
+  collective::reduce::ReduceIdentifierType, NodeAccum<T>
+> NodeAccums<T>::m_ = {};
 }
 
 template <typename>
@@ -415,6 +427,8 @@ CollectionManager::collectionAutoMsgDeliver(
 
 template <typename ColT, typename IndexT, typename MsgT>
 /*static*/ void CollectionManager::collectionBcastHandler(MsgT* msg) {
+  theMsg()->setCurrentCategory(messaging::MsgCategory::Collection);
+
   auto const col_msg = static_cast<CollectionMessage<ColT>*>(msg);
   auto const bcast_proxy = col_msg->getBcastProxy();
   auto const& untyped_proxy = bcast_proxy;
@@ -672,6 +686,8 @@ template <typename>
 
 template <typename ColT, typename IndexT, typename MsgT>
 /*static*/ void CollectionManager::collectionMsgTypedHandler(MsgT* msg) {
+  theMsg()->setCurrentCategory(messaging::MsgCategory::Collection);
+
   auto const col_msg = static_cast<CollectionMessage<ColT>*>(msg);
   auto const entity_proxy = col_msg->getProxy();
   auto const cur_epoch = theMsg()->getEpochContextMsg(msg);
@@ -866,6 +882,318 @@ messaging::PendingSend CollectionManager::broadcastFromRoot(MsgT* raw_msg) {
   return ret;
 }
 
+template <typename ColT, typename IndexT>
+CollectionSection<ColT,IndexT> CollectionManager::createSection(
+  CollectionProxyWrapType<ColT,IndexT> const& proxy,
+  std::vector<IndexT> const& idxs
+) {
+  auto const& this_node = theContext()->getNode();
+  auto const col_proxy = proxy.getProxy();
+  auto const section = makeSectionID();
+
+  debug_print(
+    vrt_coll, node,
+    "createSection: col_proxy={:x}, section={:x}, num_idx={}\n",
+    col_proxy, section, idxs.size()
+  );
+
+  if (constructed_.find(col_proxy) != constructed_.end()) {
+    buildSection<ColT,IndexT>(col_proxy, section, idxs);
+  } else {
+    buffered_bcasts_[col_proxy].push_back([=](VirtualProxyType /*ignored*/){
+      theCollection()->buildSection<ColT,IndexT>(col_proxy, section, idxs);
+    });
+  }
+
+  return CollectionSection<ColT,IndexT>{col_proxy, section, this_node};
+}
+
+template <typename ColT, typename IndexT>
+CollectionSection<ColT,IndexT> CollectionManager::createSection(
+  CollectionProxyWrapType<ColT,IndexT> const& proxy,
+  SectionIdxFuncType<IndexT> fn
+) {
+  auto const& this_node = theContext()->getNode();
+  auto const col_proxy = proxy.getProxy();
+  auto const section = makeSectionID();
+
+  debug_print(
+    vrt_coll, node,
+    "createSection: col_proxy={:x}, section={:x}, predicate\n",
+    col_proxy, section
+  );
+
+  auto build = [=]{
+    auto col_holder = theCollection()->findColHolder<ColT,IndexT>(col_proxy);
+    vtAssert(col_holder != nullptr, "Collection must exist to build section");
+
+    std::vector<IndexT> idxs;
+    col_holder->max_idx.foreach([&](IndexT idx) {
+      if (fn(idx)) {
+        idxs.push_back(idx);
+      }
+    });
+    theCollection()->buildSection<ColT,IndexT>(col_proxy, section, idxs);
+  };
+
+  if (constructed_.find(col_proxy) != constructed_.end()) {
+    build();
+  } else {
+    buffered_bcasts_[col_proxy].push_back([=](VirtualProxyType /*ignored*/){
+      build();
+    });
+  }
+
+  return CollectionSection<ColT,IndexT>{col_proxy, section, this_node};
+}
+
+template <typename ColT, typename IndexT>
+void CollectionManager::buildSection(
+  VirtualProxyType const& proxy, SectionIDType const& section,
+  std::vector<IndexT> const& idxs
+) {
+  auto const& this_node = theContext()->getNode();
+  auto elm_holder = findElmHolder<ColT,IndexT>(proxy);
+  CollectionProxyWrapType<ColT,IndexT> typed_proxy(proxy);
+
+  // Split the indices by node: elements resident here are delivered locally,
+  // all others start at their home node, which can always forward them
+  std::map<NodeType,std::vector<IndexT>> node_idxs;
+  node_idxs[this_node];
+  for (auto&& idx : idxs) {
+    bool const is_local = elm_holder != nullptr and elm_holder->exists(idx);
+    auto const node =
+      is_local ? this_node : getMappedNode<ColT,IndexT>(typed_proxy, idx);
+    node_idxs[node].push_back(idx);
+  }
+
+  // Lay out the participating nodes with the root first: the node at
+  // position i has children at positions i*fanout+1 to i*fanout+fanout
+  std::vector<NodeType> nodes;
+  nodes.reserve(node_idxs.size());
+  nodes.push_back(this_node);
+  for (auto&& elm : node_idxs) {
+    if (elm.first != this_node) {
+      nodes.push_back(elm.first);
+    }
+  }
+
+  debug_print(
+    vrt_coll, node,
+    "buildSection: proxy={:x}, section={:x}, num_idx={}, num_nodes={}\n",
+    proxy, section, idxs.size(), nodes.size()
+  );
+
+  std::size_t const fanout = section_tree_fanout;
+  std::size_t const num_nodes = nodes.size();
+  for (std::size_t i = 0; i < num_nodes; i++) {
+    std::vector<NodeType> children;
+    for (auto c = i * fanout + 1; c <= i * fanout + fanout; c++) {
+      if (c < num_nodes) {
+        children.push_back(nodes[c]);
+      }
+    }
+
+    auto const node = nodes[i];
+    auto& local = node_idxs[node];
+    if (node == this_node) {
+      installSection<ColT,IndexT>(
+        proxy, section,
+        SectionRoute<IndexT>{this_node, std::move(children), std::move(local)}
+      );
+    } else {
+      using SetupMsgType = SectionSetupMsg<ColT,IndexT>;
+      auto msg = makeSharedMessage<SetupMsgType>(
+        proxy, section, this_node, std::move(children), std::move(local)
+      );
+      theMsg()->sendMsgAuto<SetupMsgType,sectionSetupHandler<ColT,IndexT>>(
+        node, msg
+      );
+    }
+  }
+}
+
+template <typename ColT, typename IndexT>
+/*static*/ void CollectionManager::sectionSetupHandler(
+  SectionSetupMsg<ColT,IndexT>* msg
+) {
+  theCollection()->installSection<ColT,IndexT>(
+    msg->proxy_, msg->section_,
+    SectionRoute<IndexT>{
+      msg->root_, std::move(msg->children_), std::move(msg->local_)
+    }
+  );
+}
+
+template <typename ColT, typename IndexT>
+void CollectionManager::installSection(
+  VirtualProxyType const& proxy, SectionIDType const& section,
+  SectionRoute<IndexT>&& route
+) {
+  debug_print(
+    vrt_coll, node,
+    "installSection: proxy={:x}, section={:x}, root={}, children={}, "
+    "num_local={}\n",
+    proxy, section, route.root_, route.children_.size(), route.local_.size()
+  );
+
+  details::Sections<ColT>::m_[section] = std::move(route);
+  cleanup_fns_[proxy].push_back([section]{
+    details::Sections<ColT>::m_.erase(section);
+  });
+
+  // Release any multicasts that arrived before the routing for the section
+  auto iter = pending_sections_.find(section);
+  if (iter != pending_sections_.end()) {
+    auto actions = std::move(iter->second);
+    pending_sections_.erase(iter);
+    for (auto&& action : actions) {
+      action();
+    }
+  }
+}
+
+template <
+  typename MsgT,
+  ActiveColTypedFnType<MsgT,typename MsgT::CollectionType> *f
+>
+messaging::PendingSend CollectionManager::multicastMsg(
+  CollectionSection<typename MsgT::CollectionType> const& section, MsgT *msg
+) {
+  using ColT = typename MsgT::CollectionType;
+  auto const& h = auto_registry::makeAutoHandlerCollection<ColT,MsgT,f>(msg);
+  return multicastMsgUntypedHandler<MsgT>(section,msg,h,false);
+}
+
+template <
+  typename MsgT,
+  ActiveColMemberTypedFnType<MsgT,typename MsgT::CollectionType> f
+>
+messaging::PendingSend CollectionManager::multicastMsg(
+  CollectionSection<typename MsgT::CollectionType> const& section, MsgT *msg
+) {
+  using ColT = typename MsgT::CollectionType;
+  auto const& h = auto_registry::makeAutoHandlerCollectionMem<ColT,MsgT,f>(msg);
+  return multicastMsgUntypedHandler<MsgT>(section,msg,h,true);
+}
+
+template <typename MsgT, typename ColT, typename IdxT>
+messaging::PendingSend CollectionManager::multicastMsgUntypedHandler(
+  CollectionSection<ColT,IdxT> const& section, MsgT *raw_msg,
+  HandlerType const& handler, bool const member
+) {
+  auto const& this_node = theContext()->getNode();
+  auto const root = section.getRootNode();
+
+  auto msg = promoteMsg(raw_msg);
+
+  msg->setFromNode(this_node);
+
+  #if backend_check_enabled(lblite)
+    msg->setLBLiteInstrument(true);
+
+    auto const temp_elm_id = getCurrentContextTemp();
+    auto const perm_elm_id = getCurrentContextPerm();
+
+    if (perm_elm_id != balance::no_element_id) {
+      msg->setElm(perm_elm_id, temp_elm_id);
+      msg->setCat(balance::CommCategory::Broadcast);
+    } else {
+      msg->setCat(balance::CommCategory::NodeToCollection);
+    }
+  #endif
+
+  msg->setVrtHandler(handler);
+  msg->setBcastProxy(section.getCollectionProxy());
+  msg->setMember(member);
+  msg->setSection(section.getSectionID());
+
+  auto const cur_epoch = theMsg()->setupEpochMsg(msg);
+
+  debug_print(
+    vrt_coll, node,
+    "multicastMsgUntypedHandler: col_proxy={:x}, section={:x}, root={}, "
+    "handler={}, cur_epoch={:x}\n",
+    section.getCollectionProxy(), section.getSectionID(), root, handler,
+    cur_epoch
+  );
+
+  if (this_node != root) {
+    return theMsg()->sendMsgAuto<MsgT,sectionMulticastHandler<ColT,IdxT,MsgT>>(
+      root, msg.get()
+    );
+  } else {
+    multicastFromNode<ColT,IdxT,MsgT>(msg.get());
+    return messaging::PendingSend(nullptr);
+  }
+}
+
+template <typename ColT, typename IndexT, typename MsgT>
+/*static*/ void CollectionManager::sectionMulticastHandler(MsgT* msg) {
+  theCollection()->multicastFromNode<ColT,IndexT,MsgT>(msg);
+}
+
+template <typename ColT, typename IndexT, typename MsgT>
+void CollectionManager::multicastFromNode(MsgT* raw_msg) {
+  auto msg = promoteMsg(raw_msg);
+  auto const section = msg->getSection();
+  auto const cur_epoch = theMsg()->getEpochContextMsg(msg);
+
+  auto iter = details::Sections<ColT>::m_.find(section);
+  if (iter == details::Sections<ColT>::m_.end()) {
+    debug_print(
+      vrt_coll, node,
+      "multicastFromNode: section={:x}, route not installed, buffering\n",
+      section
+    );
+
+    theTerm()->produce(cur_epoch);
+    pending_sections_[section].push_back([=]{
+      theCollection()->multicastFromNode<ColT,IndexT,MsgT>(msg.get());
+      theTerm()->consume(cur_epoch);
+    });
+    return;
+  }
+
+  auto const& route = iter->second;
+  auto const col_proxy = msg->getBcastProxy();
+
+  debug_print(
+    vrt_coll, node,
+    "multicastFromNode: section={:x}, children={}, num_local={}, "
+    "cur_epoch={:x}\n",
+    section, route.children_.size(), route.local_.size(), cur_epoch
+  );
+
+  theMsg()->pushEpoch(cur_epoch);
+
+  // Forward down the spanning tree before running any local handlers
+  for (auto&& child : route.children_) {
+    auto child_msg = makeSharedMessage<MsgT>(*msg);
+    theMsg()->sendMsgAuto<MsgT,sectionMulticastHandler<ColT,IndexT,MsgT>>(
+      child, child_msg
+    );
+  }
+
+  auto elm_holder = findElmHolder<ColT,IndexT>(col_proxy);
+  for (auto&& idx : route.local_) {
+    VrtElmProxy<ColT,IndexT> elm_proxy{col_proxy,idx};
+    if (elm_holder != nullptr and elm_holder->exists(idx)) {
+      msg->setProxy(elm_proxy);
+      collectionMsgTypedHandler<ColT,IndexT,MsgT>(msg.get());
+    } else {
+      // The element has migrated since the section was created: fall back on
+      // routing this delivery through the location manager
+      auto fwd_msg = makeSharedMessage<MsgT>(*msg);
+      sendMsgUntypedHandler<MsgT,ColT,IndexT>(
+        elm_proxy, fwd_msg, msg->getVrtHandler(), msg->getMember(), false
+      );
+    }
+  }
+
+  theMsg()->popEpoch(cur_epoch);
+}
+
 template <
   typename MsgT,
   ActiveColMemberTypedFnType<MsgT,typename MsgT::CollectionType> f
@@ -1116,6 +1444,17 @@ SequentialIDType CollectionManager::reduceMsgExpr(
   CollectionProxyWrapType<ColT, typename ColT::IndexType> const& toProxy,
   MsgT *const raw_msg, ReduceIdxFuncType<typename ColT::IndexType> expr_fn,
   SequentialIDType seq, TagType tag, NodeType root
+) {
+  return reduceMsgImpl<ColT,MsgT,f>(
+    toProxy,raw_msg,expr_fn,seq,tag,root,false
+  );
+}
+
+template <typename ColT, typename MsgT, ActiveTypedFnType<MsgT> *f>
+SequentialIDType CollectionManager::reduceMsgImpl(
+  CollectionProxyWrapType<ColT, typename ColT::IndexType> const& toProxy,
+  MsgT *const raw_msg, ReduceIdxFuncType<typename ColT::IndexType> expr_fn,
+  SequentialIDType seq, TagType tag, NodeType root, bool const node_accum
 ) {
   using IndexT = typename ColT::IndexType;
 
@@ -1171,8 +1510,8 @@ SequentialIDType CollectionManager::reduceMsgExpr(
         col_proxy
       );
       theTerm()->consume(term::any_epoch_sentinel);
-      theCollection()->reduceMsgExpr<ColT,MsgT,f>(
-        toProxy,msg.get(),expr_fn,seq,tag,root
+      theCollection()->reduceMsgImpl<ColT,MsgT,f>(
+        toProxy,msg.get(),expr_fn,seq,tag,root,node_accum
       );
     });
 
@@ -1180,7 +1519,10 @@ SequentialIDType CollectionManager::reduceMsgExpr(
   } else if (found_constructed && elm_holder) {
     std::size_t num_elms = 0;
 
-    if (expr_fn == nullptr) {
+    if (node_accum) {
+      // All local elements have already been folded into this one message
+      num_elms = 1;
+    } else if (expr_fn == nullptr) {
       num_elms = elm_holder->numElements();
     } else {
       num_elms = elm_holder->numElementsExpr(expr_fn);
@@ -1212,7 +1554,9 @@ SequentialIDType CollectionManager::reduceMsgExpr(
       "reduceMsg: col_proxy={:x}, seq={}, num_elms={}, tag={}\n",
       col_proxy, cur_seq, num_elms, tag
     );
-    if (seq_iter == reduce_cur_seq_.end()) {
+    // Node-accumulated rounds carry their own sequence ID: keep it out of the
+    // one recorded for plain reductions with this tag
+    if (not node_accum and seq_iter == reduce_cur_seq_.end()) {
       reduce_cur_seq_.emplace(
         std::piecewise_construct,
         std::forward_as_tuple(reduce_id),
@@ -1228,6 +1572,111 @@ SequentialIDType CollectionManager::reduceMsgExpr(
   }
 }
 
+template <typename OpT, typename ColT, typename T>
+void CollectionManager::contribute(
+  CollectionProxyWrapType<ColT, typename ColT::IndexType> const& toProxy,
+  typename ColT::IndexType const& idx, T const& value,
+  Callback<collective::ReduceTMsg<T>> cb, TagType tag
+) {
+  using IndexT = typename ColT::IndexType;
+
+  auto const& col_proxy = toProxy.getProxy();
+  auto elm_holder = findElmHolder<ColT,IndexT>(col_proxy);
+  vtAssert(
+    elm_holder != nullptr and elm_holder->exists(idx),
+    "Must contribute on behalf of a local element"
+  );
+
+  // The element's count of contributions with `tag' numbers the rounds; it
+  // migrates with the element so every node numbers them alike
+  auto elm = elm_holder->lookup(idx).getCollection();
+  auto const seq = ++elm->contrib_seq_[tag];
+
+  auto const state_id = std::make_tuple(col_proxy,tag,no_obj_group);
+  auto state_iter = contrib_state_.find(state_id);
+  if (state_iter == contrib_state_.end()) {
+    cleanup_fns_[col_proxy].push_back([state_id]{
+      theCollection()->contrib_state_.erase(state_id);
+    });
+    state_iter = contrib_state_.emplace(state_id, ContribState{}).first;
+  }
+  auto& state = state_iter->second;
+
+  auto const accum_id = std::make_tuple(tag,seq,col_proxy,no_obj_group);
+  auto& accums = details::NodeAccums<T>::m_;
+  auto round_iter = state.open_.find(seq);
+  if (round_iter == state.open_.end()) {
+    vtAssert(
+      seq > state.finished_,
+      "Element migrated into a node that already completed this reduction"
+    );
+
+    // Fix the local elements taking part in this round once: all but those
+    // that contributed to it before migrating here
+    ContribRound round;
+    elm_holder->foreach([&](IndexT const&, CollectionBase<ColT,IndexT>* col) {
+      auto const iter = col->contrib_seq_.find(tag);
+      auto const count = iter == col->contrib_seq_.end() ? 0 : iter->second;
+      if (count < seq or col == elm) {
+        round.expected_++;
+      }
+    });
+    round.finish_ = [=]{
+      theCollection()->finishContribute<OpT,ColT,T>(toProxy,tag,seq);
+    };
+    round_iter = state.open_.emplace(seq, std::move(round)).first;
+
+    // Fold the element's value in place: the message is only allocated once
+    // every local element has contributed
+    accums[accum_id] = NodeAccum<T>{value, cb};
+  } else {
+    OpT()(accums[accum_id].value_, value);
+  }
+
+  auto& round = round_iter->second;
+  round.num_contrib_++;
+
+  debug_print(
+    vrt_coll, node,
+    "contribute: col_proxy={:x}, tag={}, seq={}, num_contrib={}, "
+    "expected={}\n",
+    col_proxy, tag, seq, round.num_contrib_, round.expected_
+  );
+
+  if (round.num_contrib_ == round.expected_) {
+    closeContribRound(state_id, seq);
+  }
+}
+
+template <typename OpT, typename ColT, typename T>
+void CollectionManager::finishContribute(
+  CollectionProxyWrapType<ColT, typename ColT::IndexType> const& toProxy,
+  TagType tag, SequentialIDType seq
+) {
+  using MsgT = collective::ReduceTMsg<T>;
+  using ReduceCBType = collective::reduce::operators::ReduceCallback<MsgT>;
+
+  auto const accum_id = std::make_tuple(
+    tag,seq,toProxy.getProxy(),no_obj_group
+  );
+  auto& accums = details::NodeAccums<T>::m_;
+  auto iter = accums.find(accum_id);
+  vtAssert(iter != accums.end(), "Accumulator must exist for the round");
+
+  auto msg = makeSharedMessage<MsgT>(std::move(iter->second.value_));
+  msg->setCallback(iter->second.cb_);
+  accums.erase(iter);
+
+  // The round is the reduction's sequence ID: rounds in flight with the same
+  // tag stay apart in the tree, and apart from plain reductions with the tag
+  reduceMsgImpl<
+    ColT, MsgT, MsgT::template msgHandler<MsgT, OpT, ReduceCBType>
+  >(
+    toProxy,msg.get(),nullptr,seq | contrib_seq_flag,tag,
+    uninitialized_destination,true
+  );
+}
+
 template <typename ColT, typename MsgT, ActiveTypedFnType<MsgT> *f>
 SequentialIDType CollectionManager::reduceMsg(
   CollectionProxyWrapType<ColT, typename ColT::IndexType> const& toProxy,
@@ -1443,6 +1892,13 @@ messaging::PendingSend CollectionManager::sendMsgUntypedHandler(
   if (imm_context) {
     theTerm()->produce(cur_epoch);
     return messaging::PendingSend(msg, [=](MsgVirtualPtr<BaseMsgType> inner_msg){
+      auto typed_msg = reinterpret_cast<MsgT*>(inner_msg.get());
+      bool const local = theCollection()->tryLocalSend<MsgT,ColT,IdxT>(
+        toProxy, typed_msg, handler, member, cur_epoch
+      );
+      if (local) {
+        return;
+      }
       schedule<>([=]{
         theMsg()->pushEpoch(cur_epoch);
         theCollection()->sendMsgUntypedHandler<MsgT,ColT,IdxT>(
@@ -1523,6 +1979,68 @@ messaging::PendingSend CollectionManager::sendMsgUntypedHandler(
   return messaging::PendingSend(nullptr);
 }
 
+template <typename MsgT, typename ColT, typename IdxT>
+bool CollectionManager::tryLocalSend(
+  VirtualElmProxyType<ColT> const& toProxy, MsgT *msg,
+  HandlerType const& handler, bool const member, EpochType const& epoch
+) {
+  if (ArgType::vt_no_local_fast_path) {
+    return false;
+  }
+
+  auto const& col_proxy = toProxy.getCollectionProxy();
+  auto holder = findColHolder<ColT, IdxT>(col_proxy);
+  if (holder == nullptr) {
+    return false;
+  }
+
+  auto lm = theLocMan()->getCollectionLM<ColT, IdxT>(col_proxy);
+  if (lm == nullptr or not lm->isLocal(toProxy)) {
+    return false;
+  }
+
+  debug_print(
+    vrt_coll, node,
+    "tryLocalSend: col_proxy={:x}, idx={}, handler={}, epoch={:x}\n",
+    col_proxy, toProxy.getElementProxy().getIndex(), handler, epoch
+  );
+
+  msg->setVrtHandler(handler);
+  msg->setProxy(toProxy);
+  msg->setMember(member);
+
+  // The termination producer for `epoch' was issued when the send was made
+  // and is consumed by the scheduler once the message is delivered
+  LocalSendType send;
+  send.msg_ = promoteMsg(msg).template to<BaseMessage>();
+  send.epoch_ = epoch;
+  send.deliver_ = &CollectionManager::localDeliver<MsgT,ColT,IdxT>;
+  local_ready_.emplace_back(std::move(send));
+  sched::wakeup(sched::SchedComponent::Collection);
+  return true;
+}
+
+template <typename MsgT, typename ColT, typename IdxT>
+/*static*/ void CollectionManager::localDeliver(
+  MsgSharedPtr<BaseMessage> const& base_msg
+) {
+  auto msg = reinterpret_cast<MsgT*>(base_msg.get());
+  auto const to_proxy = msg->getProxy();
+  auto const& col_proxy = to_proxy.getCollectionProxy();
+  auto const& idx = to_proxy.getElementProxy().getIndex();
+  auto elm_holder = theCollection()->findElmHolder<ColT, IdxT>(col_proxy);
+  bool const exists = elm_holder != nullptr and elm_holder->exists(idx);
+
+  if (exists) {
+    collectionMsgTypedHandler<ColT,IdxT,MsgT>(msg);
+  } else {
+    // The element left this node while the send was queued: route it normally
+    theCollection()->sendMsgUntypedHandler<MsgT,ColT,IdxT>(
+      to_proxy, msg, msg->getVrtHandler(), msg->getMember(), false
+    );
+  }
+}
+
 template <typename ColT, typename IndexT>
 bool CollectionManager::insertCollectionElement(
   VirtualPtrType<ColT, IndexT> vc, IndexT const& idx, IndexT const& max_idx,
@@ -2676,6 +3194,8 @@ MigrateStatus CollectionManager::migrateOut(
    auto col_unique_ptr = elm_holder->remove(idx);
    auto& typed_col_ref = *static_cast<ColT*>(col_unique_ptr.get());
 
+   migrateContribRounds(col_proxy, col_unique_ptr->contrib_seq_, false);
+
    debug_print(
      vrt_coll, node,
      "migrateOut: (after remove) holder numElements={}\n",
@@ -2752,6 +3272,8 @@ MigrateStatus CollectionManager::migrateIn(
 
   auto vc_raw_ptr = vrt_elm_ptr.get();
 
+  migrateContribRounds(proxy, vc_raw_ptr->contrib_seq_, true);
+
   /*
    * Invoke the virtual prelude migrate-in function
    */
@@ -3129,6 +3651,10 @@ void CollectionManager::releaseLBContinuation() {
     "releaseLBContinuation\n"
   );
   UniversalIndexHolder<>::resetPhase();
+#if backend_check_enabled(lblite)
+  // The phase is complete: append it to the binary stats file if enabled
+  balance::ProcStats::outputStatsPhases();
+#endif
   if (lb_continuations_.size() > 0) {
     auto continuations = lb_continuations_;
     lb_continuations_.clear();
@@ -3159,11 +3685,20 @@ CollectionManager::getDispatcher(DispatchHandlerType const& han) {
 template <typename always_void>
 void CollectionManager::schedule(ActionType action) {
   work_units_.push_back(action);
+  sched::wakeup(sched::SchedComponent::Collection);
 }
 
 template <typename always_void>
 bool CollectionManager::scheduler() {
-  if (work_units_.size() == 0) {
+  if (local_ready_.size() != 0) {
+    auto send = std::move(local_ready_.front());
+    local_ready_.pop_front();
+    theMsg()->pushEpoch(send.epoch_);
+    send.deliver_(send.msg_);
+    theMsg()->popEpoch(send.epoch_);
+    theTerm()->consume(send.epoch_);
+    return true;
+  } else if (work_units_.size() == 0) {
     return false;
   } else {
     auto unit = work_units_.back();
@@ -50,6 +50,7 @@
 #include "vt/messaging/message.h"
 #include "vt/vrt/collection/manager.fwd.h"
 #include "vt/vrt/collection/proxy.h"
+#include "vt/vrt/collection/section/section_types.h"
 #include "vt/vrt/vrt_common.h"
 #include "vt/vrt/collection/balance/lb_common.h"
 #include "vt/vrt/collection/balance/lb_comm.h"
@@ -100,6 +101,9 @@ struct CollectionMessage :
   EpochType getBcastEpoch() const;
   void setBcastEpoch(EpochType const& epoch);
 
+  SectionIDType getSection() const;
+  void setSection(SectionIDType const& section);
+
   NodeType getFromNode() const;
   void setFromNode(NodeType const& node);
 
@@ -134,6 +138,7 @@ private:
   VirtualElmProxyType<ColT, IndexType> to_proxy_{};
   HandlerType vt_sub_handler_ = uninitialized_handler;
   EpochType bcast_epoch_ = no_epoch;
+  SectionIDType section_ = no_section;
   NodeType from_node_ = uninitialized_destination;
   bool member_ = false;
   bool is_wrap_ = false;
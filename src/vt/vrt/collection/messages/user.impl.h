@@ -102,6 +102,18 @@ void CollectionMessage<ColT, BaseMsgT>::setBcastEpoch(EpochType const& epoch) {
   bcast_epoch_ = epoch;
 }
 
+template <typename ColT, typename BaseMsgT>
+SectionIDType CollectionMessage<ColT, BaseMsgT>::getSection() const {
+  return section_;
+}
+
+template <typename ColT, typename BaseMsgT>
+void CollectionMessage<ColT, BaseMsgT>::setSection(
+  SectionIDType const& section
+) {
+  section_ = section;
+}
+
 template <typename ColT, typename BaseMsgT>
 NodeType CollectionMessage<ColT, BaseMsgT>::getFromNode() const {
   return from_node_;
@@ -126,6 +138,7 @@ void CollectionMessage<ColT, BaseMsgT>::serializeThis(SerializerT& s) {
   s | to_proxy_;
   s | bcast_proxy_;
   s | bcast_epoch_;
+  s | section_;
   s | member_;
   s | is_wrap_;
 
@@ -50,6 +50,7 @@
 #include "vt/activefn/activefn.h"
 #include "vt/pipe/pipe_callback_only.h"
 #include "vt/collective/reduce/operators/functors/none_op.h"
+#include "vt/collective/reduce/operators/default_msg.h"
 #include "vt/collective/reduce/operators/callback_op.h"
 
 #include <functional>
@@ -116,6 +117,12 @@ struct Reducable : BaseProxyT {
     TagType const& tag,
     IndexT const& idx
   ) const;
+
+  template <typename OpT, typename T>
+  void contribute(
+    IndexT const& idx, T const& value, Callback<collective::ReduceTMsg<T>> cb,
+    TagType const& tag = no_tag
+  ) const;
 };
 
 }}} /* end namespace vt::vrt::collection */
@@ -127,6 +127,16 @@ EpochType Reducable<ColT,IndexT,BaseProxyT>::reduceExpr(
   );
 }
 
+template <typename ColT, typename IndexT, typename BaseProxyT>
+template <typename OpT, typename T>
+void Reducable<ColT,IndexT,BaseProxyT>::contribute(
+  IndexT const& idx, T const& value, Callback<collective::ReduceTMsg<T>> cb,
+  TagType const& tag
+) const {
+  auto const proxy = this->getProxy();
+  theCollection()->contribute<OpT,ColT,T>(proxy,idx,value,cb,tag);
+}
+
 }}} /* end namespace vt::vrt::collection */
 
 #endif /*INCLUDED_VRT_COLLECTION_REDUCABLE_REDUCABLE_IMPL_H*/
@@ -0,0 +1,101 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                reduce_accum.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VRT_COLLECTION_REDUCABLE_REDUCE_ACCUM_H
+#define INCLUDED_VRT_COLLECTION_REDUCABLE_REDUCE_ACCUM_H
+
+#include "vt/config.h"
+#include "vt/collective/reduce/operators/default_msg.h"
+#include "vt/pipe/pipe_callback_only.h"
+
+#include <cstdlib>
+#include <functional>
+#include <map>
+
+namespace vt { namespace vrt { namespace collection {
+
+/*
+ *  Set on the sequence ID a round enters the reduction tree with. Plain
+ *  reductions on the same collection and tag number themselves from one as
+ *  well, so the rounds are kept in a space of their own
+ */
+static constexpr SequentialIDType const contrib_seq_flag =
+  SequentialIDType{1} << 63;
+
+/*
+ *  Per-node accumulator for one round of element contributions to a
+ *  collection reduction: local elements fold their values in place and a
+ *  single message carrying the partial result enters the inter-node tree
+ */
+template <typename T>
+struct NodeAccum {
+  T value_ = {};
+  Callback<collective::ReduceTMsg<T>> cb_ = {};
+};
+
+/*
+ *  Progress of one round on this node, kept apart from the value so that
+ *  migration can adjust it without knowing the value type. The number of
+ *  expected contributions is captured when the round opens and then follows
+ *  the elements that migrate in or out before contributing.
+ */
+struct ContribRound {
+  std::size_t expected_ = 0;
+  std::size_t num_contrib_ = 0;
+  // sends the partial result into the reduction tree
+  std::function<void()> finish_ = nullptr;
+};
+
+/*
+ *  The rounds of contributions with one tag to one collection on this node
+ */
+struct ContribState {
+  std::map<SequentialIDType, ContribRound> open_ = {};
+  // the highest round completed on this node
+  SequentialIDType finished_ = 0;
+};
+
+}}} /* end namespace vt::vrt::collection */
+
+#endif /*INCLUDED_VRT_COLLECTION_REDUCABLE_REDUCE_ACCUM_H*/
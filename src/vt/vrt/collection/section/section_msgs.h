@@ -0,0 +1,82 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                section_msgs.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VRT_COLLECTION_SECTION_SECTION_MSGS_H
+#define INCLUDED_VRT_COLLECTION_SECTION_SECTION_MSGS_H
+
+#include "vt/config.h"
+#include "vt/vrt/collection/section/section_types.h"
+#include "vt/messaging/message.h"
+#include "vt/serialization/serialization.h"
+
+#include <vector>
+
+namespace vt { namespace vrt { namespace collection {
+
+template <typename ColT, typename IndexT>
+struct SectionSetupMsg : ::vt::Message {
+  SectionSetupMsg() = default;
+  SectionSetupMsg(
+    VirtualProxyType const in_proxy, SectionIDType const in_section,
+    NodeType const in_root, std::vector<NodeType>&& in_children,
+    std::vector<IndexT>&& in_local
+  ) : proxy_(in_proxy), section_(in_section), root_(in_root),
+      children_(std::move(in_children)), local_(std::move(in_local))
+  { }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | proxy_ | section_ | root_ | children_ | local_;
+  }
+
+  VirtualProxyType proxy_ = {};
+  SectionIDType section_ = no_section;
+  NodeType root_ = uninitialized_destination;
+  std::vector<NodeType> children_ = {};
+  std::vector<IndexT> local_ = {};
+};
+
+}}} /* end namespace vt::vrt::collection */
+
+#endif /*INCLUDED_VRT_COLLECTION_SECTION_SECTION_MSGS_H*/
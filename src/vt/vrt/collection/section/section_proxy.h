@@ -0,0 +1,114 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               section_proxy.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VRT_COLLECTION_SECTION_SECTION_PROXY_H
+#define INCLUDED_VRT_COLLECTION_SECTION_SECTION_PROXY_H
+
+#include "vt/config.h"
+#include "vt/vrt/collection/section/section_types.h"
+#include "vt/vrt/collection/active/active_funcs.h"
+#include "vt/messaging/message/smart_ptr.h"
+#include "vt/messaging/pending_send.h"
+
+namespace vt { namespace vrt { namespace collection {
+
+/*
+ *  A section is a subset of the elements of a collection, built once from an
+ *  index list or predicate. A multicast to the section is delivered only to
+ *  those elements, following the routing cached on each node at creation.
+ */
+template <typename ColT, typename IndexT = typename ColT::IndexType>
+struct CollectionSection {
+  CollectionSection() = default;
+  CollectionSection(CollectionSection const&) = default;
+  CollectionSection(CollectionSection&&) = default;
+  CollectionSection(
+    VirtualProxyType const in_proxy, SectionIDType const in_section,
+    NodeType const in_root
+  );
+  CollectionSection& operator=(CollectionSection const&) = default;
+
+  VirtualProxyType getCollectionProxy() const { return proxy_; }
+  SectionIDType getSectionID() const { return section_; }
+  NodeType getRootNode() const { return root_; }
+
+  template <typename MsgT, ActiveColTypedFnType<MsgT, ColT> *f>
+  messaging::PendingSend multicast(MsgT* msg) const;
+  template <typename MsgT, ActiveColTypedFnType<MsgT, ColT> *f>
+  messaging::PendingSend multicast(MsgSharedPtr<MsgT> msg) const;
+  template <
+    typename MsgT, ActiveColTypedFnType<MsgT, ColT> *f, typename... Args
+  >
+  messaging::PendingSend multicast(Args&&... args) const;
+
+  template <typename MsgT, ActiveColMemberTypedFnType<MsgT, ColT> f>
+  messaging::PendingSend multicast(MsgT* msg) const;
+  template <typename MsgT, ActiveColMemberTypedFnType<MsgT, ColT> f>
+  messaging::PendingSend multicast(MsgSharedPtr<MsgT> msg) const;
+  template <
+    typename MsgT, ActiveColMemberTypedFnType<MsgT, ColT> f, typename... Args
+  >
+  messaging::PendingSend multicast(Args&&... args) const;
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | proxy_ | section_ | root_;
+  }
+
+private:
+  VirtualProxyType proxy_ = no_vrt_proxy;
+  SectionIDType section_ = no_section;
+  NodeType root_ = uninitialized_destination;
+};
+
+}}} /* end namespace vt::vrt::collection */
+
+namespace vt {
+
+template <typename ColT, typename IndexT = typename ColT::IndexType>
+using CollectionSection = vrt::collection::CollectionSection<ColT, IndexT>;
+
+} /* end namespace vt */
+
+#endif /*INCLUDED_VRT_COLLECTION_SECTION_SECTION_PROXY_H*/
@@ -0,0 +1,115 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             section_proxy.impl.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_VRT_COLLECTION_SECTION_SECTION_PROXY_IMPL_H
+#define INCLUDED_VRT_COLLECTION_SECTION_SECTION_PROXY_IMPL_H
+
+#include "vt/config.h"
+#include "vt/vrt/collection/section/section_proxy.h"
+#include "vt/vrt/collection/manager.h"
+
+namespace vt { namespace vrt { namespace collection {
+
+template <typename ColT, typename IndexT>
+CollectionSection<ColT,IndexT>::CollectionSection(
+  VirtualProxyType const in_proxy, SectionIDType const in_section,
+  NodeType const in_root
+) : proxy_(in_proxy), section_(in_section), root_(in_root)
+{ }
+
+template <typename ColT, typename IndexT>
+template <typename MsgT, ActiveColTypedFnType<MsgT, ColT> *f>
+messaging::PendingSend CollectionSection<ColT,IndexT>::multicast(
+  MsgT* msg
+) const {
+  return theCollection()->multicastMsg<MsgT, f>(*this,msg);
+}
+
+template <typename ColT, typename IndexT>
+template <typename MsgT, ActiveColTypedFnType<MsgT, ColT> *f>
+messaging::PendingSend CollectionSection<ColT,IndexT>::multicast(
+  MsgSharedPtr<MsgT> msg
+) const {
+  return multicast<MsgT,f>(msg.get());
+}
+
+template <typename ColT, typename IndexT>
+template <
+  typename MsgT, ActiveColTypedFnType<MsgT, ColT> *f, typename... Args
+>
+messaging::PendingSend CollectionSection<ColT,IndexT>::multicast(
+  Args&&... args
+) const {
+  return multicast<MsgT,f>(makeMessage<MsgT>(std::forward<Args>(args)...));
+}
+
+template <typename ColT, typename IndexT>
+template <typename MsgT, ActiveColMemberTypedFnType<MsgT, ColT> f>
+messaging::PendingSend CollectionSection<ColT,IndexT>::multicast(
+  MsgT* msg
+) const {
+  return theCollection()->multicastMsg<MsgT, f>(*this,msg);
+}
+
+template <typename ColT, typename IndexT>
+template <typename MsgT, ActiveColMemberTypedFnType<MsgT, ColT> f>
+messaging::PendingSend CollectionSection<ColT,IndexT>::multicast(
+  MsgSharedPtr<MsgT> msg
+) const {
+  return multicast<MsgT,f>(msg.get());
+}
+
+template <typename ColT, typename IndexT>
+template <
+  typename MsgT, ActiveColMemberTypedFnType<MsgT, ColT> f, typename... Args
+>
+messaging::PendingSend CollectionSection<ColT,IndexT>::multicast(
+  Args&&... args
+) const {
+  return multicast<MsgT,f>(makeMessage<MsgT>(std::forward<Args>(args)...));
+}
+
+}}} /* end namespace vt::vrt::collection */
+
+#endif /*INCLUDED_VRT_COLLECTION_SECTION_SECTION_PROXY_IMPL_H*/
@@ -55,6 +55,8 @@
 #include "vt/vrt/collection/manager.fwd.h"
 #include "vt/vrt/proxy/collection_proxy.h"
 
+#include <unordered_map>
+
 namespace vt { namespace vrt { namespace collection {
 
 template <typename ColT, typename IndexT>
@@ -93,6 +95,8 @@ struct CollectionBase : Indexable<ColT, IndexT> {
 protected:
   VirtualElmCountType numElems_ = no_elms;
   EpochType cur_bcast_epoch_ = 0;
+  // Contributions made to node-accumulated reductions, per tag
+  std::unordered_map<TagType, SequentialIDType> contrib_seq_ = {};
   bool hasStaticSize_ = true;
   bool elmsFixedAtCreation_ = true;
 };
@@ -110,6 +110,7 @@ void CollectionBase<ColT, IndexT>::serialize(Serializer& s) {
   s | hasStaticSize_;
   s | elmsFixedAtCreation_;
   s | cur_bcast_epoch_;
+  s | contrib_seq_;
   s | numElems_;
 }
 
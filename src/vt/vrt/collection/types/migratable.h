@@ -99,6 +99,13 @@ struct Migratable : MigrateHookBase {
    */
   virtual void destroy();
 
+  /*
+   * Override to report the memory this element occupies, in bytes, for
+   * memory-constrained load balancing. Zero, the default, means the runtime
+   * uses its serialized size instead
+   */
+  virtual std::size_t getMemoryFootprint() const { return 0; }
+
   balance::ElementIDType getElmID() const { return stats_elm_id_; }
   balance::ElementIDType getTempID() const { return temp_elm_id_; }
 
@@ -0,0 +1,171 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           collection_local_send.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <cstdint>
+#include <cstdlib>
+
+#include <fmt/format.h>
+
+#include "vt/transport.h"
+
+/*
+ * Neighbour exchange where every neighbour of an element is resident on the
+ * same node: each element sends to its left and right neighbour in its node's
+ * block and waits for both neighbours before starting the next iteration.
+ * Compare runs with and without --vt_no_local_fast_path.
+ */
+
+using namespace vt;
+
+static int32_t elms_per_node = 64;
+static int32_t num_iters = 1000;
+
+static double start_time = 0.0;
+static int32_t local_done = 0;
+
+struct NeighborCol;
+
+struct StartMsg : CollectionMessage<NeighborCol> { };
+
+struct ExchangeMsg : CollectionMessage<NeighborCol> {
+  ExchangeMsg() = default;
+  explicit ExchangeMsg(int32_t const in_iter) : iter_(in_iter) { }
+
+  int32_t iter_ = 0;
+};
+
+struct NeighborCol : Collection<NeighborCol,Index1D> {
+  NeighborCol() = default;
+
+  void start(StartMsg* msg);
+  void exchange(ExchangeMsg* msg);
+
+private:
+  void sendNeighbors();
+  void finished();
+
+private:
+  int32_t cur_iter_ = 0;
+  // a neighbour can be at most one iteration ahead
+  int32_t recv_[2] = {0, 0};
+};
+
+void NeighborCol::sendNeighbors() {
+  auto const idx = getIndex().x();
+  auto const base = (idx / elms_per_node) * elms_per_node;
+  auto const off = idx - base;
+  auto const left = base + (off + elms_per_node - 1) % elms_per_node;
+  auto const right = base + (off + 1) % elms_per_node;
+  auto proxy = getCollectionProxy();
+
+  proxy[left].send<ExchangeMsg,&NeighborCol::exchange>(cur_iter_);
+  proxy[right].send<ExchangeMsg,&NeighborCol::exchange>(cur_iter_);
+}
+
+void NeighborCol::finished() {
+  local_done++;
+  if (local_done == elms_per_node) {
+    double const total = MPI_Wtime() - start_time;
+    int64_t const num_msgs =
+      static_cast<int64_t>(elms_per_node) * 2 * num_iters;
+    fmt::print(
+      "{}: Finished elms={}, iters={}, msgs={}, total time={}, time/msg={}\n",
+      theContext()->getNode(), elms_per_node, num_iters, num_msgs, total,
+      total / num_msgs
+    );
+  }
+}
+
+void NeighborCol::start(StartMsg* msg) {
+  if (start_time == 0.0) {
+    start_time = MPI_Wtime();
+  }
+  sendNeighbors();
+}
+
+void NeighborCol::exchange(ExchangeMsg* msg) {
+  recv_[msg->iter_ % 2]++;
+
+  while (recv_[cur_iter_ % 2] == 2) {
+    recv_[cur_iter_ % 2] = 0;
+    cur_iter_++;
+    if (cur_iter_ == num_iters) {
+      finished();
+      return;
+    }
+    sendNeighbors();
+  }
+}
+
+int main(int argc, char** argv) {
+  CollectiveOps::initialize(argc, argv);
+
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
+
+  if (argc > 1) {
+    elms_per_node = atoi(argv[1]);
+  }
+  if (argc > 2) {
+    num_iters = atoi(argv[2]);
+  }
+
+  if (elms_per_node < 2) {
+    CollectiveOps::abort("At least 2 elements per node required");
+  }
+
+  if (this_node == 0) {
+    auto const range = Index1D(elms_per_node * num_nodes);
+    auto proxy = theCollection()->construct<NeighborCol>(range);
+    proxy.broadcast<StartMsg,&NeighborCol::start>();
+  }
+
+  while (!rt->isTerminated()) {
+    runScheduler();
+  }
+
+  CollectiveOps::finalize();
+
+  return 0;
+}
@@ -0,0 +1,134 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           collection_send_rate.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <cstdint>
+#include <cstdlib>
+
+#include <fmt/format.h>
+
+#include "vt/transport.h"
+#include "common/perf_harness.h"
+
+/*
+ * Send rate to collection elements. Every node sends `iters` rounds of one
+ * message to each of `elms_per_node` targets, either resident on the same node
+ * (local) or on the next node (remote), and waits until its own elements have
+ * received the same number of messages.
+ */
+
+using namespace vt;
+using namespace vt::tests::perf;
+
+static int32_t elms_per_node = 64;
+static int64_t num_rounds = 0;
+static int64_t num_recv = 0;
+
+struct RecvCol;
+
+struct CountMsg : CollectionMessage<RecvCol> { };
+
+struct RecvCol : Collection<RecvCol,Index1D> {
+  RecvCol() = default;
+
+  void recv(CountMsg* msg) {
+    num_recv++;
+  }
+};
+
+static void sendRounds(
+  CollectionProxy<RecvCol,Index1D> proxy, bool const remote
+) {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+  auto const dest_node = remote ? (this_node + 1) % num_nodes : this_node;
+  auto const base = dest_node * elms_per_node;
+  int64_t const expected = num_rounds * elms_per_node;
+
+  num_recv = 0;
+  for (int64_t r = 0; r < num_rounds; r++) {
+    for (int32_t i = 0; i < elms_per_node; i++) {
+      proxy[base + i].send<CountMsg,&RecvCol::recv>();
+    }
+  }
+  PerfHarness::runSchedulerUntil([=]{ return num_recv == expected; });
+}
+
+int main(int argc, char** argv) {
+  CollectiveOps::initialize(argc, argv);
+
+  PerfHarness harness("collection_send_rate", argc, argv, 100);
+
+  auto const num_nodes = theContext()->getNumNodes();
+
+  if (argc > 1 and argv[1][0] != '-') {
+    elms_per_node = atoi(argv[1]);
+  }
+
+  num_rounds = harness.getIters();
+
+  auto const range = Index1D(elms_per_node * num_nodes);
+  auto proxy = theCollection()->constructCollective<RecvCol>(
+    range, [](Index1D idx) { return std::make_unique<RecvCol>(); }
+  );
+
+  int64_t const ops = num_rounds * elms_per_node;
+
+  harness.runCollective("local", ops, 0, [=]{ sendRounds(proxy, false); })
+    .param("elms_per_node", elms_per_node);
+
+  if (num_nodes > 1) {
+    harness.runCollective("remote", ops, 0, [=]{ sendRounds(proxy, true); })
+      .param("elms_per_node", elms_per_node);
+  }
+
+  harness.report();
+
+  while (!rt->isTerminated()) {
+    runScheduler();
+  }
+
+  CollectiveOps::finalize();
+
+  return 0;
+}
@@ -0,0 +1,165 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            collective_latency.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <cstdint>
+
+#include <fmt/format.h>
+
+#include "vt/transport.h"
+#include "common/perf_harness.h"
+
+/*
+ * Latency of a broadcast and of a reduction as a function of the number of
+ * nodes; run at several rank counts and compare the num_nodes in the reports.
+ *
+ *  - bcast:  the root broadcasts and waits for every other node to ack
+ *  - reduce: every node contributes to a sum reduction and the root waits for
+ *            the result; the next reduction starts when the root broadcasts
+ */
+
+using namespace vt;
+using namespace vt::tests::perf;
+
+static constexpr NodeType const root = 0;
+
+static int64_t num_ops = 0;
+static NodeType num_acks = 0;
+static int64_t num_reduced = 0;
+
+struct BcastMsg : ShortMessage { };
+
+struct AckMsg : ShortMessage { };
+
+struct SumMsg : collective::ReduceTMsg<int64_t> {
+  explicit SumMsg(int64_t const in_val)
+    : collective::ReduceTMsg<int64_t>(in_val)
+  { }
+};
+
+static void ackHandler(AckMsg* msg) {
+  num_acks++;
+}
+
+static void bcastHandler(BcastMsg* msg) {
+  auto ack = makeSharedMessage<AckMsg>();
+  theMsg()->sendMsg<AckMsg, ackHandler>(root, ack);
+}
+
+static void startReduce();
+
+static void nextReduceHandler(BcastMsg* msg) {
+  startReduce();
+}
+
+struct SumDone {
+  void operator()(SumMsg* msg) {
+    num_reduced++;
+    if (num_reduced < num_ops) {
+      auto next = makeSharedMessage<BcastMsg>();
+      theMsg()->broadcastMsg<BcastMsg, nextReduceHandler>(next);
+      startReduce();
+    }
+  }
+};
+
+static void startReduce() {
+  auto msg = makeSharedMessage<SumMsg>(1);
+  theCollective()->reduce<
+    SumMsg,
+    SumMsg::msgHandler<SumMsg, collective::PlusOp<int64_t>, SumDone>
+  >(root, msg);
+}
+
+static void bcastLatency() {
+  if (theContext()->getNode() != root) {
+    return;
+  }
+
+  auto const num_nodes = theContext()->getNumNodes();
+  for (int64_t i = 0; i < num_ops; i++) {
+    num_acks = 0;
+    auto msg = makeSharedMessage<BcastMsg>();
+    theMsg()->broadcastMsg<BcastMsg, bcastHandler>(msg);
+    PerfHarness::runSchedulerUntil([=]{ return num_acks == num_nodes - 1; });
+  }
+}
+
+static void reduceLatency() {
+  num_reduced = 0;
+
+  // Non-root nodes start the remaining reductions from the root's broadcast
+  startReduce();
+
+  if (theContext()->getNode() == root) {
+    PerfHarness::runSchedulerUntil([]{ return num_reduced == num_ops; });
+  }
+}
+
+int main(int argc, char** argv) {
+  CollectiveOps::initialize(argc, argv);
+
+  PerfHarness harness("collective_latency", argc, argv, 100);
+
+  num_ops = harness.getIters();
+
+  auto const num_nodes = theContext()->getNumNodes();
+
+  if (num_nodes > 1) {
+    harness.runCollective("bcast", num_ops, 0, bcastLatency)
+      .param("num_nodes", num_nodes);
+  }
+
+  harness.runCollective("reduce", num_ops, 0, reduceLatency)
+    .param("num_nodes", num_nodes);
+
+  harness.report();
+
+  while (!rt->isTerminated()) {
+    runScheduler();
+  }
+
+  CollectiveOps::finalize();
+
+  return 0;
+}
@@ -0,0 +1,312 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                perf_harness.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_PERF_COMMON_PERF_HARNESS_H
+#define INCLUDED_PERF_COMMON_PERF_HARNESS_H
+
+#include "vt/transport.h"
+#include "vt/timing/timing.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <fmt/format.h>
+
+/*
+ * Shared timing and reporting harness for the microbenchmarks in tests/perf.
+ *
+ * Each benchmark is run for a number of warmup trials followed by timed
+ * trials. Node-local benchmarks are timed on every node; collective benchmarks
+ * run on all nodes between barriers and are timed on the root. Only the root
+ * reports: a one-line summary per result on stdout and the whole suite as
+ * JSON in `<suite>.json` (override with --json=<file>).
+ *
+ * Harness options, passed after the vt arguments:
+ *   --iters=<n>    operations per trial (each benchmark picks its default)
+ *   --trials=<n>   number of timed trials (default 5)
+ *   --warmup=<n>   number of untimed trials run first (default 1)
+ *   --json=<file>  where to write the JSON report
+ */
+
+namespace vt { namespace tests { namespace perf {
+
+struct PerfResult {
+  using ParamType = std::pair<std::string, int64_t>;
+
+  PerfResult(std::string const& in_name, int64_t in_ops, int64_t in_bytes)
+    : name_(in_name), ops_(in_ops), bytes_(in_bytes)
+  { }
+
+  PerfResult& param(std::string const& key, int64_t const value) {
+    params_.emplace_back(key, value);
+    return *this;
+  }
+
+  void addTrial(double const seconds) { trials_.push_back(seconds); }
+
+  std::string const& getName() const { return name_; }
+  int64_t getOps() const { return ops_; }
+  int64_t getBytes() const { return bytes_; }
+  std::vector<ParamType> const& getParams() const { return params_; }
+  std::size_t getNumTrials() const { return trials_.size(); }
+
+  double min() const {
+    return trials_.empty() ?
+      0.0 : *std::min_element(trials_.begin(), trials_.end());
+  }
+
+  double max() const {
+    return trials_.empty() ?
+      0.0 : *std::max_element(trials_.begin(), trials_.end());
+  }
+
+  double mean() const {
+    double sum = 0.0;
+    for (auto&& t : trials_) {
+      sum += t;
+    }
+    return trials_.empty() ? 0.0 : sum / trials_.size();
+  }
+
+  double stddev() const {
+    if (trials_.size() < 2) {
+      return 0.0;
+    }
+    auto const avg = mean();
+    double sum = 0.0;
+    for (auto&& t : trials_) {
+      sum += (t - avg) * (t - avg);
+    }
+    return std::sqrt(sum / (trials_.size() - 1));
+  }
+
+  // Rates are computed from the fastest trial, the least perturbed by noise
+  double opsPerSec() const {
+    return min() > 0.0 ? ops_ / min() : 0.0;
+  }
+
+  double bytesPerSec() const {
+    return min() > 0.0 ? (ops_ * bytes_) / min() : 0.0;
+  }
+
+  double usPerOp() const {
+    return ops_ > 0 ? min() * 1e6 / ops_ : 0.0;
+  }
+
+private:
+  std::string name_;
+  // the operations timed in one trial
+  int64_t ops_ = 0;
+  // the payload bytes moved per operation, zero when not meaningful
+  int64_t bytes_ = 0;
+  std::vector<ParamType> params_;
+  // seconds taken by each timed trial
+  std::vector<double> trials_;
+};
+
+struct PerfHarness {
+  PerfHarness(
+    std::string const& in_suite, int argc, char** argv,
+    int64_t const default_iters
+  ) : suite_(in_suite), iters_(default_iters), json_file_(in_suite + ".json")
+  {
+    for (int i = 1; i < argc; i++) {
+      std::string const arg = argv[i];
+      if (arg.compare(0, 8, "--iters=") == 0) {
+        iters_ = std::atoll(arg.c_str() + 8);
+      } else if (arg.compare(0, 9, "--trials=") == 0) {
+        trials_ = std::atoi(arg.c_str() + 9);
+      } else if (arg.compare(0, 9, "--warmup=") == 0) {
+        warmup_ = std::atoi(arg.c_str() + 9);
+      } else if (arg.compare(0, 7, "--json=") == 0) {
+        json_file_ = arg.substr(7);
+      }
+    }
+    if (iters_ < 1 or trials_ < 1 or warmup_ < 0) {
+      CollectiveOps::abort("--iters and --trials must be positive");
+    }
+  }
+
+  int64_t getIters() const { return iters_; }
+  bool isRoot() const { return theContext()->getNode() == root; }
+
+  /*
+   * Time `fn` on this node: it should perform `ops` operations per call
+   */
+  template <typename Callable>
+  PerfResult& runLocal(
+    std::string const& name, int64_t const ops, int64_t const bytes,
+    Callable&& fn
+  ) {
+    results_.emplace_back(name, ops, bytes);
+    auto& result = results_.back();
+    for (int32_t t = 0; t < warmup_ + trials_; t++) {
+      auto const start = now();
+      fn();
+      auto const elapsed = now() - start;
+      if (t >= warmup_) {
+        result.addTrial(elapsed);
+      }
+    }
+    return result;
+  }
+
+  /*
+   * Run `fn` on all nodes between two barriers, timed on the root. `fn` should
+   * return once this node's share of the operations has completed
+   */
+  template <typename Callable>
+  PerfResult& runCollective(
+    std::string const& name, int64_t const ops, int64_t const bytes,
+    Callable&& fn
+  ) {
+    results_.emplace_back(name, ops, bytes);
+    auto& result = results_.back();
+    for (int32_t t = 0; t < warmup_ + trials_; t++) {
+      theCollective()->barrier();
+      auto const start = now();
+      fn();
+      theCollective()->barrier();
+      auto const elapsed = now() - start;
+      if (t >= warmup_) {
+        result.addTrial(elapsed);
+      }
+    }
+    return result;
+  }
+
+  template <typename Callable>
+  static void runSchedulerUntil(Callable&& done) {
+    while (not done()) {
+      runScheduler();
+    }
+  }
+
+  /*
+   * Print the summary and write the JSON report from the root
+   */
+  void report() const {
+    if (not isRoot()) {
+      return;
+    }
+
+    for (auto&& r : results_) {
+      auto line = fmt::format(
+        "{}: {}:", suite_, r.getName()
+      );
+      for (auto&& p : r.getParams()) {
+        line += fmt::format(" {}={}", p.first, p.second);
+      }
+      line += fmt::format(
+        " ops={}, min={:.6f}s, mean={:.6f}s, us/op={:.3f}, ops/s={:.1f}",
+        r.getOps(), r.min(), r.mean(), r.usPerOp(), r.opsPerSec()
+      );
+      if (r.getBytes() > 0) {
+        line += fmt::format(", MB/s={:.2f}", r.bytesPerSec() / 1e6);
+      }
+      fmt::print("{}\n", line);
+    }
+
+    std::ofstream out(json_file_);
+    if (not out.good()) {
+      fmt::print("{}: could not open \"{}\"\n", suite_, json_file_);
+      return;
+    }
+    out << toJSON();
+  }
+
+  std::string toJSON() const {
+    std::string out = fmt::format(
+      "{{\n  \"suite\": \"{}\",\n  \"num_nodes\": {},\n"
+      "  \"trials\": {},\n  \"warmup\": {},\n  \"results\": [",
+      suite_, theContext()->getNumNodes(), trials_, warmup_
+    );
+    for (std::size_t i = 0; i < results_.size(); i++) {
+      auto const& r = results_[i];
+      std::string params;
+      for (auto&& p : r.getParams()) {
+        params += fmt::format(
+          "{}\"{}\": {}", params.empty() ? "" : ", ", p.first, p.second
+        );
+      }
+      out += fmt::format(
+        "{}\n    {{\"name\": \"{}\", \"params\": {{{}}}, \"ops\": {}, "
+        "\"bytes_per_op\": {}, \"time_min\": {:.9f}, \"time_mean\": {:.9f}, "
+        "\"time_max\": {:.9f}, \"time_stddev\": {:.9f}, "
+        "\"ops_per_sec\": {:.3f}, \"bytes_per_sec\": {:.3f}, "
+        "\"us_per_op\": {:.6f}}}",
+        i == 0 ? "" : ",", r.getName(), params, r.getOps(), r.getBytes(),
+        r.min(), r.mean(), r.max(), r.stddev(), r.opsPerSec(),
+        r.bytesPerSec(), r.usPerOp()
+      );
+    }
+    out += "\n  ]\n}\n";
+    return out;
+  }
+
+private:
+  static double now() { return timing::Timing::getCurrentTime(); }
+
+private:
+  static constexpr NodeType const root = 0;
+
+  std::string suite_;
+  int64_t iters_ = 0;
+  int32_t trials_ = 5;
+  int32_t warmup_ = 1;
+  std::string json_file_;
+  // a deque so references handed out by run* stay valid
+  std::deque<PerfResult> results_;
+};
+
+}}} /* end namespace vt::tests::perf */
+
+#endif /*INCLUDED_PERF_COMMON_PERF_HARNESS_H*/
@@ -0,0 +1,133 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                epoch_rate.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <cstdint>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "vt/transport.h"
+#include "common/perf_harness.h"
+
+/*
+ * Rate at which epochs can be created and terminated when no work is done
+ * inside them, which isolates the cost of termination detection itself.
+ *
+ *  - collective:       every node creates an epoch and waits for it to end
+ *  - collective_batch: every node creates `iters` epochs, finishes them all
+ *                      and waits for all of them to terminate
+ *  - rooted:           the root creates a rooted (wave) epoch and waits
+ *  - rooted_ds:        the same using Dijkstra-Scholten termination
+ */
+
+using namespace vt;
+using namespace vt::tests::perf;
+
+static constexpr NodeType const root = 0;
+
+static int64_t num_epochs = 0;
+static int64_t num_done = 0;
+
+static void collectiveEpochs() {
+  for (int64_t i = 0; i < num_epochs; i++) {
+    bool done = false;
+    auto const epoch = theTerm()->makeEpochCollective();
+    theTerm()->addAction(epoch, [&done]{ done = true; });
+    theTerm()->finishedEpoch(epoch);
+    PerfHarness::runSchedulerUntil([&done]{ return done; });
+  }
+}
+
+static void collectiveEpochsBatch() {
+  num_done = 0;
+  std::vector<EpochType> epochs;
+  for (int64_t i = 0; i < num_epochs; i++) {
+    auto const epoch = theTerm()->makeEpochCollective();
+    theTerm()->addAction(epoch, []{ num_done++; });
+    epochs.push_back(epoch);
+  }
+  for (auto&& epoch : epochs) {
+    theTerm()->finishedEpoch(epoch);
+  }
+  PerfHarness::runSchedulerUntil([]{ return num_done == num_epochs; });
+}
+
+static void rootedEpochs(bool const use_ds) {
+  if (theContext()->getNode() != root) {
+    return;
+  }
+
+  for (int64_t i = 0; i < num_epochs; i++) {
+    bool done = false;
+    auto const epoch = theTerm()->makeEpochRooted(use_ds);
+    theTerm()->addAction(epoch, [&done]{ done = true; });
+    theTerm()->finishedEpoch(epoch);
+    PerfHarness::runSchedulerUntil([&done]{ return done; });
+  }
+}
+
+int main(int argc, char** argv) {
+  CollectiveOps::initialize(argc, argv);
+
+  PerfHarness harness("epoch_rate", argc, argv, 100);
+
+  num_epochs = harness.getIters();
+
+  harness.runCollective("collective", num_epochs, 0, collectiveEpochs);
+  harness.runCollective(
+    "collective_batch", num_epochs, 0, collectiveEpochsBatch
+  );
+  harness.runCollective("rooted", num_epochs, 0, []{ rootedEpochs(false); });
+  harness.runCollective("rooted_ds", num_epochs, 0, []{ rootedEpochs(true); });
+
+  harness.report();
+
+  while (!rt->isTerminated()) {
+    runScheduler();
+  }
+
+  CollectiveOps::finalize();
+
+  return 0;
+}
@@ -0,0 +1,135 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             event_completion.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <cstdint>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <mpi.h>
+
+#include "vt/transport.h"
+#include "vt/event/event.h"
+#include "common/perf_harness.h"
+
+/*
+ * Completion rate of AsyncEvent, the event manager that tracks outstanding
+ * MPI requests and fires the actions attached to them.
+ *
+ *  - normal: create a normal event, attach an action and trigger it directly
+ *  - mpi:    post `iters` self-sends, each tracked by an MPI event with an
+ *            attached action, and run the scheduler until every action fired;
+ *            this is the path every theMsg() send takes to release its buffer
+ */
+
+using namespace vt;
+using namespace vt::tests::perf;
+
+static int64_t num_events = 0;
+static int64_t num_fired = 0;
+
+static void normalEvents() {
+  auto const this_node = theContext()->getNode();
+  num_fired = 0;
+  for (int64_t i = 0; i < num_events; i++) {
+    auto const event = theEvent()->createNormalEvent(this_node);
+    theEvent()->attachAction(event, []{ num_fired++; });
+    theEvent()->getEventHolder(event).makeReadyTrigger();
+  }
+  vtAssertExpr(num_fired == num_events);
+}
+
+static void mpiEvents(MPI_Comm comm) {
+  auto const this_node = theContext()->getNode();
+  int const tag = 0;
+
+  std::vector<int> send_buf(num_events, 0);
+  std::vector<int> recv_buf(num_events, 0);
+  std::vector<MPI_Request> recv_reqs(num_events);
+
+  num_fired = 0;
+  for (int64_t i = 0; i < num_events; i++) {
+    MPI_Irecv(&recv_buf[i], 1, MPI_INT, this_node, tag, comm, &recv_reqs[i]);
+  }
+  for (int64_t i = 0; i < num_events; i++) {
+    auto const event = theEvent()->createMPIEvent(this_node);
+    auto& holder = theEvent()->getEventHolder(event);
+    MPI_Isend(
+      &send_buf[i], 1, MPI_INT, this_node, tag, comm,
+      holder.get_event()->getRequest()
+    );
+    holder.attachAction([]{ num_fired++; });
+  }
+  PerfHarness::runSchedulerUntil([]{ return num_fired == num_events; });
+  MPI_Waitall(
+    static_cast<int>(recv_reqs.size()), &recv_reqs[0], MPI_STATUSES_IGNORE
+  );
+}
+
+int main(int argc, char** argv) {
+  CollectiveOps::initialize(argc, argv);
+
+  PerfHarness harness("event_completion", argc, argv, 10000);
+
+  num_events = harness.getIters();
+
+  // The self-sends use their own communicator so they can never match vt's
+  MPI_Comm comm;
+  MPI_Comm_dup(theContext()->getComm(), &comm);
+
+  harness.runLocal("normal", num_events, 0, normalEvents);
+  harness.runLocal("mpi", num_events, 0, [=]{ mpiEvents(comm); });
+
+  harness.report();
+
+  MPI_Comm_free(&comm);
+
+  while (!rt->isTerminated()) {
+    runScheduler();
+  }
+
+  CollectiveOps::finalize();
+
+  return 0;
+}
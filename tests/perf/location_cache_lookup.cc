@@ -0,0 +1,130 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           location_cache_lookup.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "vt/transport.h"
+#include "vt/topos/location/cache/cache.h"
+#include "common/perf_harness.h"
+
+/*
+ * Lookup and update rate of the location cache for a range of cache sizes.
+ *
+ *  - hit:    find() on keys that are all resident, in a scrambled order
+ *  - miss:   find() on keys that are never resident
+ *  - insert: insert() of fresh keys into a full cache, evicting on each call
+ */
+
+using namespace vt;
+using namespace vt::tests::perf;
+
+using CacheType = location::LocationCache<int64_t, int64_t>;
+
+static constexpr int64_t const min_entries = 64;
+static constexpr int64_t const max_entries = 65536;
+
+// accumulates looked up values so the lookups are not optimized away
+static volatile int64_t sink = 0;
+
+int main(int argc, char** argv) {
+  CollectiveOps::initialize(argc, argv);
+
+  PerfHarness harness("location_cache_lookup", argc, argv, 1000000);
+
+  auto const iters = harness.getIters();
+
+  for (int64_t entries = min_entries; entries <= max_entries; entries *= 4) {
+    CacheType cache(entries);
+    for (int64_t k = 0; k < entries; k++) {
+      cache.insert(k, k);
+    }
+
+    // Visit the resident keys with a stride co-prime to their count so the
+    // access pattern does not follow the insertion order
+    std::vector<int64_t> keys(entries);
+    for (int64_t i = 0; i < entries; i++) {
+      keys[i] = (i * 7919) % entries;
+    }
+
+    harness.runLocal("hit", iters, 0, [&]{
+      int64_t sum = 0;
+      for (int64_t i = 0; i < iters; i++) {
+        auto const value = cache.find(keys[i % entries]);
+        sum += value != nullptr ? *value : 0;
+      }
+      sink = sink + sum;
+    }).param("entries", entries);
+
+    harness.runLocal("miss", iters, 0, [&]{
+      int64_t sum = 0;
+      for (int64_t i = 0; i < iters; i++) {
+        auto const value = cache.find(entries + keys[i % entries]);
+        sum += value != nullptr ? *value : 0;
+      }
+      sink = sink + sum;
+    }).param("entries", entries);
+
+    int64_t next_key = entries;
+    harness.runLocal("insert", iters, 0, [&]{
+      for (int64_t i = 0; i < iters; i++) {
+        cache.insert(next_key, next_key);
+        next_key++;
+      }
+    }).param("entries", entries);
+  }
+
+  harness.report();
+
+  while (!rt->isTerminated()) {
+    runScheduler();
+  }
+
+  CollectiveOps::finalize();
+
+  return 0;
+}
@@ -0,0 +1,164 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              migration_rate.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "vt/transport.h"
+#include "common/perf_harness.h"
+
+/*
+ * Migration throughput: in each trial every node migrates all the elements it
+ * holds to the next node and waits for the same number of elements to arrive
+ * from the previous one. Every element carries `bytes_per_elm` bytes of state.
+ */
+
+using namespace vt;
+using namespace vt::tests::perf;
+
+static int32_t elms_per_node = 64;
+static int64_t bytes_per_elm = 1024;
+
+// indices of the elements currently resident on this node
+static std::vector<int32_t> resident = {};
+
+struct MigCol;
+
+struct MoveMsg : CollectionMessage<MigCol> {
+  MoveMsg() = default;
+  explicit MoveMsg(NodeType const in_dest) : dest_(in_dest) { }
+
+  NodeType dest_ = uninitialized_destination;
+};
+
+struct MigCol : Collection<MigCol,Index1D> {
+  MigCol() = default;
+  explicit MigCol(int64_t const bytes) : data_(bytes) { }
+
+  void moveTo(MoveMsg* msg) {
+    migrate(msg->dest_);
+  }
+
+  void epiMigrateIn() override {
+    resident.push_back(getIndex().x());
+  }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    Collection<MigCol,Index1D>::serialize(s);
+    s | data_;
+  }
+
+private:
+  std::vector<char> data_;
+};
+
+static void migrateAll(CollectionProxy<MigCol,Index1D> proxy) {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+  auto const next = (this_node + 1) % num_nodes;
+
+  auto const to_move = resident;
+  resident.clear();
+
+  for (auto&& idx : to_move) {
+    proxy[idx].send<MoveMsg,&MigCol::moveTo>(next);
+  }
+  PerfHarness::runSchedulerUntil([=]{
+    return resident.size() == static_cast<std::size_t>(elms_per_node);
+  });
+}
+
+int main(int argc, char** argv) {
+  CollectiveOps::initialize(argc, argv);
+
+  PerfHarness harness("migration_rate", argc, argv, 1);
+
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+
+  if (argc > 1 and argv[1][0] != '-') {
+    elms_per_node = atoi(argv[1]);
+  }
+  if (argc > 2 and argv[2][0] != '-') {
+    bytes_per_elm = atoll(argv[2]);
+  }
+
+  auto const range = Index1D(elms_per_node * num_nodes);
+  auto proxy = theCollection()->constructCollective<MigCol>(
+    range, [](Index1D idx) { return std::make_unique<MigCol>(bytes_per_elm); }
+  );
+
+  for (int32_t i = 0; i < elms_per_node; i++) {
+    resident.push_back(this_node * elms_per_node + i);
+  }
+
+  // Each iteration shifts every element over by one node
+  auto const iters = harness.getIters();
+  if (num_nodes == 1) {
+    fmt::print("migration_rate: skipped, at least 2 ranks required\n");
+  } else {
+    auto const ops = iters * elms_per_node;
+    harness.runCollective("migrate", ops, bytes_per_elm, [=]{
+      for (int64_t i = 0; i < iters; i++) {
+        migrateAll(proxy);
+        // let the location updates settle before moving the elements again
+        theCollective()->barrier();
+      }
+    }).param("elms_per_node", elms_per_node).param("bytes", bytes_per_elm);
+  }
+
+  harness.report();
+
+  while (!rt->isTerminated()) {
+    runScheduler();
+  }
+
+  CollectiveOps::finalize();
+
+  return 0;
+}
@@ -0,0 +1,133 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                 msg_rate.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <algorithm>
+#include <cstdint>
+
+#include <fmt/format.h>
+
+#include "vt/transport.h"
+#include "common/perf_harness.h"
+
+/*
+ * Message rate and bandwidth of theMsg()->sendMsgSz from node 0 to node 1 over
+ * a range of payload sizes. Each trial streams `iters` messages (fewer for the
+ * large sizes); node 1 acks the last one, so the time covers injection through
+ * delivery.
+ */
+
+using namespace vt;
+using namespace vt::tests::perf;
+
+static constexpr NodeType const send_node = 0;
+static constexpr NodeType const recv_node = 1;
+static constexpr int64_t const min_bytes = 8;
+static constexpr int64_t const max_bytes = 1 << 20;
+// cap the bytes in flight per trial so the large sizes do not exhaust memory
+static constexpr int64_t const max_trial_bytes = 64 << 20;
+
+static int64_t num_msgs = 0;
+static int64_t num_recv = 0;
+static bool acked = false;
+
+struct PayloadMsg : ShortMessage { };
+
+struct AckMsg : ShortMessage { };
+
+static void ackHandler(AckMsg* msg) {
+  acked = true;
+}
+
+static void payloadHandler(PayloadMsg* msg) {
+  num_recv++;
+  if (num_recv == num_msgs) {
+    num_recv = 0;
+    auto ack = makeSharedMessage<AckMsg>();
+    theMsg()->sendMsg<AckMsg, ackHandler>(send_node, ack);
+  }
+}
+
+static void streamMsgs(int64_t const bytes) {
+  if (theContext()->getNode() != send_node) {
+    return;
+  }
+
+  acked = false;
+  for (int64_t i = 0; i < num_msgs; i++) {
+    auto msg = makeSharedMessageSz<PayloadMsg>(bytes);
+    theMsg()->sendMsgSz<PayloadMsg, payloadHandler>(
+      recv_node, msg, sizeof(PayloadMsg) + bytes
+    );
+  }
+  PerfHarness::runSchedulerUntil([]{ return acked; });
+}
+
+int main(int argc, char** argv) {
+  CollectiveOps::initialize(argc, argv);
+
+  PerfHarness harness("msg_rate", argc, argv, 1000);
+
+  if (theContext()->getNumNodes() == 1) {
+    fmt::print("msg_rate: skipped, at least 2 ranks required\n");
+  } else {
+    for (int64_t bytes = min_bytes; bytes <= max_bytes; bytes *= 4) {
+      num_msgs = std::max<int64_t>(
+        1, std::min(harness.getIters(), max_trial_bytes / bytes)
+      );
+      harness.runCollective(
+        "send", num_msgs, bytes, [=]{ streamMsgs(bytes); }
+      ).param("bytes", bytes);
+    }
+  }
+
+  harness.report();
+
+  while (!rt->isTerminated()) {
+    runScheduler();
+  }
+
+  CollectiveOps::finalize();
+
+  return 0;
+}
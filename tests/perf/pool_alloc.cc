@@ -0,0 +1,131 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                                pool_alloc.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "vt/transport.h"
+#include "vt/pool/pool.h"
+#include "common/perf_harness.h"
+
+/*
+ * Allocation and deallocation rate of the memory pool over sizes spanning the
+ * small, medium and malloc tiers, with std::malloc as the baseline.
+ *
+ *  - pool_pair / malloc_pair:   allocate and immediately free one buffer
+ *  - pool_batch / malloc_batch: allocate `iters` buffers (fewer for the large
+ *                               sizes), then free them all
+ */
+
+using namespace vt;
+using namespace vt::tests::perf;
+
+static constexpr int64_t const min_bytes = 16;
+static constexpr int64_t const max_bytes = 65536;
+// cap the memory held live by the batch variants
+static constexpr int64_t const max_batch_bytes = 64 << 20;
+
+int main(int argc, char** argv) {
+  CollectiveOps::initialize(argc, argv);
+
+  PerfHarness harness("pool_alloc", argc, argv, 100000);
+
+  auto const iters = harness.getIters();
+  std::vector<void*> bufs(iters, nullptr);
+
+  for (int64_t bytes = min_bytes; bytes <= max_bytes; bytes *= 4) {
+    auto const size = static_cast<std::size_t>(bytes);
+    auto const batch = std::min(iters, max_batch_bytes / bytes);
+
+    harness.runLocal("pool_pair", iters, bytes, [=]{
+      for (int64_t i = 0; i < iters; i++) {
+        auto buf = thePool()->alloc(size);
+        static_cast<char*>(buf)[0] = 0;
+        thePool()->dealloc(buf);
+      }
+    }).param("bytes", bytes);
+
+    harness.runLocal("malloc_pair", iters, bytes, [=]{
+      for (int64_t i = 0; i < iters; i++) {
+        auto buf = std::malloc(size);
+        static_cast<char*>(buf)[0] = 0;
+        std::free(buf);
+      }
+    }).param("bytes", bytes);
+
+    harness.runLocal("pool_batch", batch, bytes, [=,&bufs]{
+      for (int64_t i = 0; i < batch; i++) {
+        bufs[i] = thePool()->alloc(size);
+        static_cast<char*>(bufs[i])[0] = 0;
+      }
+      for (int64_t i = 0; i < batch; i++) {
+        thePool()->dealloc(bufs[i]);
+      }
+    }).param("bytes", bytes);
+
+    harness.runLocal("malloc_batch", batch, bytes, [=,&bufs]{
+      for (int64_t i = 0; i < batch; i++) {
+        bufs[i] = std::malloc(size);
+        static_cast<char*>(bufs[i])[0] = 0;
+      }
+      for (int64_t i = 0; i < batch; i++) {
+        std::free(bufs[i]);
+      }
+    }).param("bytes", bytes);
+  }
+
+  harness.report();
+
+  while (!rt->isTerminated()) {
+    runScheduler();
+  }
+
+  CollectiveOps::finalize();
+
+  return 0;
+}
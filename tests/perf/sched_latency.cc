@@ -0,0 +1,171 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               sched_latency.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <cstdint>
+#include <cstdlib>
+
+#include <fmt/format.h>
+
+#include "vt/transport.h"
+#include "common/perf_harness.h"
+
+/*
+ * Per-message latency through the scheduler, to compare adaptive polling with
+ * the original loop: run once as is and once with --vt_sched_poll_compat and
+ * compare the us/op of each result (the "adaptive" param tells them apart).
+ *
+ *  - ping_pong:   round trips of a short active message between node 0 and
+ *                 node 1; us/op is the round trip time
+ *  - local_chain: a chain of collection sends, each element forwarding to the
+ *                 next element on the same node; us/op is the time per hop
+ *
+ * Both keep a single message in flight, so the time per op is dominated by
+ * how soon the scheduler gets back to the component holding it.
+ */
+
+using namespace vt;
+using namespace vt::tests::perf;
+
+static constexpr NodeType const ping_node = 0;
+static constexpr NodeType const pong_node = 1;
+
+static int32_t elms_per_node = 16;
+static int64_t num_ops = 0;
+static int64_t num_pongs = 0;
+static int64_t num_hops = 0;
+
+struct PingMsg : ShortMessage { };
+
+static void pingHandler(PingMsg* msg);
+
+static void pongHandler(PingMsg* msg) {
+  num_pongs++;
+  if (num_pongs < num_ops) {
+    auto ping = makeSharedMessage<PingMsg>();
+    theMsg()->sendMsg<PingMsg, pingHandler>(pong_node, ping);
+  }
+}
+
+static void pingHandler(PingMsg* msg) {
+  auto pong = makeSharedMessage<PingMsg>();
+  theMsg()->sendMsg<PingMsg, pongHandler>(ping_node, pong);
+}
+
+static void pingPong() {
+  if (theContext()->getNode() != ping_node) {
+    return;
+  }
+
+  num_pongs = 0;
+  auto ping = makeSharedMessage<PingMsg>();
+  theMsg()->sendMsg<PingMsg, pingHandler>(pong_node, ping);
+  PerfHarness::runSchedulerUntil([]{ return num_pongs == num_ops; });
+}
+
+struct ChainCol;
+
+struct HopMsg : CollectionMessage<ChainCol> { };
+
+static CollectionProxy<ChainCol,Index1D> chain_proxy;
+
+struct ChainCol : Collection<ChainCol,Index1D> {
+  ChainCol() = default;
+
+  void hop(HopMsg* msg) {
+    num_hops++;
+    if (num_hops < num_ops) {
+      auto const base = theContext()->getNode() * elms_per_node;
+      auto const next = base + (getIndex().x() - base + 1) % elms_per_node;
+      chain_proxy[next].send<HopMsg,&ChainCol::hop>();
+    }
+  }
+};
+
+static void localChain() {
+  num_hops = 0;
+  chain_proxy[theContext()->getNode() * elms_per_node]
+    .send<HopMsg,&ChainCol::hop>();
+  PerfHarness::runSchedulerUntil([]{ return num_hops == num_ops; });
+}
+
+int main(int argc, char** argv) {
+  CollectiveOps::initialize(argc, argv);
+
+  PerfHarness harness("sched_latency", argc, argv, 10000);
+
+  auto const num_nodes = theContext()->getNumNodes();
+  int64_t const adaptive = theSched()->isAdaptive() ? 1 : 0;
+
+  if (argc > 1 and argv[1][0] != '-') {
+    elms_per_node = atoi(argv[1]);
+  }
+
+  num_ops = harness.getIters();
+
+  if (num_nodes > 1) {
+    harness.runCollective("ping_pong", num_ops, 0, pingPong)
+      .param("adaptive", adaptive);
+  } else if (theContext()->getNode() == 0) {
+    fmt::print("sched_latency: skipping ping_pong, it needs two nodes\n");
+  }
+
+  auto const range = Index1D(elms_per_node * num_nodes);
+  chain_proxy = theCollection()->constructCollective<ChainCol>(
+    range, [](Index1D idx) { return std::make_unique<ChainCol>(); }
+  );
+
+  harness.runCollective("local_chain", num_ops, 0, localChain)
+    .param("adaptive", adaptive)
+    .param("elms_per_node", elms_per_node);
+
+  harness.report();
+
+  while (!rt->isTerminated()) {
+    runScheduler();
+  }
+
+  CollectiveOps::finalize();
+
+  return 0;
+}
@@ -0,0 +1,90 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             test_comm_matrix.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#include <gtest/gtest.h>
+
+#include "test_harness.h"
+
+#include "vt/transport.h"
+#include "vt/messaging/comm_matrix.h"
+
+#include <string>
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::messaging;
+
+struct TestCommMatrix : TestHarness { };
+
+TEST_F(TestCommMatrix, test_comm_matrix_row) {
+  CommMatrix::RowType row;
+  {
+    CommMatrix matrix;
+    matrix.send(3, 32, false);
+    matrix.send(3, 32, false);
+    matrix.send(1, 8, true);
+
+    row = matrix.getRow();
+    ASSERT_EQ(row.size(), 2ul);
+    EXPECT_EQ(row[3].messages_, 2ul);
+    EXPECT_EQ(row[3].bytes_, 64ul);
+    EXPECT_EQ(row[3].bcasts_, 0ul);
+    EXPECT_EQ(row[1].messages_, 1ul);
+    EXPECT_EQ(row[1].bcasts_, 1ul);
+
+    // The phase is written out and the next one starts empty
+    matrix.endPhase(0);
+    EXPECT_TRUE(matrix.getRow().empty());
+  }
+
+  // Sorted by destination
+  EXPECT_EQ(
+    CommMatrix::formatRow(4, 0, row),
+    std::string{"4,0,1,1,8,1\n4,0,3,2,64,0\n"}
+  );
+}
+
+}}} // end namespace vt::tests::unit
@@ -0,0 +1,127 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           test_delivery_latency.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+
+#include "vt/transport.h"
+#include "vt/messaging/latency_histogram.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::tests::unit;
+using namespace vt::messaging;
+
+using LatencyMsg = collective::ReduceTMsg<DeliveryLatency>;
+
+struct TestDeliveryLatency : TestParallelHarness {
+  struct Verify {
+    void operator()(LatencyMsg* msg) {
+      auto const num_nodes = theContext()->getNumNodes();
+      auto const& latency = msg->getConstVal();
+      auto const& wait = latency.getWait(MsgCategory::Collection);
+      auto const& exec = latency.getExec(MsgCategory::Collection);
+      EXPECT_EQ(wait.count(), num_nodes);
+      EXPECT_EQ(wait.min(), 1000);
+      EXPECT_EQ(wait.max(), 1000 * num_nodes);
+      EXPECT_EQ(exec.count(), num_nodes);
+      EXPECT_EQ(latency.getWait(MsgCategory::Active).count(), 0);
+    }
+  };
+};
+
+TEST_F(TestDeliveryLatency, test_latency_histogram_buckets) {
+  // Buckets are contiguous, and never wider than 1/8 of their values
+  for (std::size_t b = 0; b + 1 < latency_hist_buckets; b++) {
+    auto const lower = LatencyHistogram::bucketLower(b);
+    auto const upper = LatencyHistogram::bucketUpper(b);
+    EXPECT_EQ(upper + 1, LatencyHistogram::bucketLower(b + 1));
+    EXPECT_EQ(LatencyHistogram::bucketOf(lower), b);
+    EXPECT_EQ(LatencyHistogram::bucketOf(upper), b);
+    EXPECT_LE(upper - lower, std::max(lower / 8, int64_t{0}));
+  }
+  EXPECT_EQ(
+    LatencyHistogram::bucketOf(std::numeric_limits<int64_t>::max()),
+    latency_hist_buckets - 1
+  );
+}
+
+TEST_F(TestDeliveryLatency, test_latency_histogram_percentile) {
+  LatencyHistogram hist;
+  for (int64_t i = 1; i <= 1000; i++) {
+    hist.add(i * 1000);
+  }
+  EXPECT_EQ(hist.count(), 1000);
+  EXPECT_EQ(hist.min(), 1000);
+  EXPECT_EQ(hist.max(), 1000000);
+  EXPECT_DOUBLE_EQ(hist.mean(), 500500.0);
+
+  // Within one bucket (1/8) of the exact percentile
+  auto const p50 = hist.percentile(0.5);
+  EXPECT_GE(p50, 500000);
+  EXPECT_LE(p50, 500000 + 500000 / 8);
+  EXPECT_EQ(hist.percentile(1.0), 1000000);
+}
+
+TEST_F(TestDeliveryLatency, test_delivery_latency_reduce) {
+  auto const this_node = theContext()->getNode();
+
+  DeliveryLatency latency;
+  latency.add(MsgCategory::Collection, 1000 * (this_node + 1), 10);
+
+  using OpType = collective::PlusOp<DeliveryLatency>;
+
+  auto msg = makeSharedMessage<LatencyMsg>(std::move(latency));
+  theCollective()->reduce<
+    LatencyMsg, LatencyMsg::msgHandler<LatencyMsg, OpType, Verify>
+  >(0, msg);
+}
+
+}}} // end namespace vt::tests::unit
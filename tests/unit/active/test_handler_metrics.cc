@@ -0,0 +1,143 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           test_handler_metrics.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+#include "data_message.h"
+
+#include "vt/transport.h"
+#include "vt/messaging/handler_metrics.h"
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::tests::unit;
+
+struct TestHandlerMetrics : TestParallelHarness {
+  using TestMsg = TestStaticBytesShortMsg<16>;
+
+  static int num_msg_sent;
+
+  static void test_handler(TestMsg* msg) { }
+};
+
+/*static*/ int TestHandlerMetrics::num_msg_sent = 8;
+
+TEST_F(TestHandlerMetrics, test_handler_metrics_diff) {
+  using messaging::MetricsSnapshot;
+
+  MetricsSnapshot earlier;
+  earlier.handlers_[1].add(1.0);
+  earlier.handlers_[1].bytes_recv_ = 100;
+  earlier.ranks_[0].messages_ = 2;
+  earlier.ranks_[0].bytes_ = 40;
+
+  MetricsSnapshot later = earlier;
+  later.handlers_[1].add(3.0);
+  later.handlers_[1].bytes_recv_ = 150;
+  later.handlers_[2].add(0.5);
+  later.ranks_[0].messages_ = 5;
+  later.ranks_[0].bytes_ = 100;
+
+  auto const delta = later.diff(earlier);
+  ASSERT_EQ(delta.handlers_.size(), 2ul);
+  EXPECT_EQ(delta.handlers_.at(1).count_, 1ul);
+  EXPECT_DOUBLE_EQ(delta.handlers_.at(1).total_time_, 3.0);
+  EXPECT_EQ(delta.handlers_.at(1).bytes_recv_, 50ul);
+  EXPECT_EQ(delta.handlers_.at(2).count_, 1ul);
+  EXPECT_EQ(delta.ranks_.at(0).messages_, 3ul);
+  EXPECT_EQ(delta.ranks_.at(0).bytes_, 60ul);
+
+  // Nothing changed: the diff is empty
+  EXPECT_TRUE(later.diff(later).handlers_.empty());
+  EXPECT_TRUE(later.diff(later).ranks_.empty());
+
+  MetricsSnapshot merged = earlier;
+  merged.merge(later);
+  EXPECT_EQ(merged.handlers_.at(1).count_, 3ul);
+  EXPECT_DOUBLE_EQ(merged.handlers_.at(1).min_time_, 1.0);
+  EXPECT_DOUBLE_EQ(merged.handlers_.at(1).max_time_, 3.0);
+}
+
+TEST_F(TestHandlerMetrics, test_handler_metrics_send) {
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+
+  if (num_nodes < 2) {
+    return;
+  }
+
+  theMsg()->getMetrics().reset();
+
+  if (this_node == 0) {
+    for (int i = 0; i < num_msg_sent; i++) {
+      auto msg = makeSharedMessage<TestMsg>();
+      theMsg()->sendMsg<TestMsg, test_handler>(1, msg);
+    }
+  }
+
+  theTerm()->addAction([=]{
+    auto const snap = theMsg()->getMetrics().snapshot();
+    if (this_node == 0) {
+      auto iter = snap.ranks_.find(1);
+      ASSERT_NE(iter, snap.ranks_.end());
+      EXPECT_GE(iter->second.messages_, static_cast<uint64_t>(num_msg_sent));
+    } else if (this_node == 1) {
+      auto const han = auto_registry::makeAutoHandler<TestMsg, test_handler>(
+        nullptr
+      );
+      auto iter = snap.handlers_.find(han);
+      ASSERT_NE(iter, snap.handlers_.end());
+      EXPECT_EQ(iter->second.count_, static_cast<uint64_t>(num_msg_sent));
+      EXPECT_GE(
+        iter->second.bytes_recv_, num_msg_sent * sizeof(TestMsg)
+      );
+      EXPECT_LE(iter->second.min_time_, iter->second.max_time_);
+    }
+  });
+}
+
+}}} // end namespace vt::tests::unit
@@ -0,0 +1,109 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               test_lb_async.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+#include "test_lb_common.h"
+
+#include "vt/transport.h"
+
+#include <string>
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::tests::unit;
+
+struct TestLBAsync : TestParallelHarnessParam<std::string> {
+  virtual void SetUp() {
+    TestParallelHarnessParam<std::string>::SetUp();
+    arguments::ArgConfig::vt_lb = true;
+    arguments::ArgConfig::vt_lb_name = GetParam();
+    arguments::ArgConfig::vt_lb_interval = 1;
+    arguments::ArgConfig::vt_lb_async = true;
+  }
+
+  virtual void TearDown() {
+    TestParallelHarnessParam<std::string>::TearDown();
+    lbResetIterations();
+    arguments::ArgConfig::vt_lb_async = false;
+  }
+};
+
+TEST_P(TestLBAsync, test_lb_async_overlapped_migrate) {
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
+
+  if (num_nodes < 2) {
+    return;
+  }
+
+  // A balancer starts at every even boundary and its migrations are held
+  // until the odd boundary after it, so the phase it overlaps runs with the
+  // old mapping and only the one following it sees any move
+  lb_on_iter = [](int32_t iter) {
+    if (iter == 0) {
+      return;
+    }
+    auto const& prev = lb_placement[lb_placement.size() - 2];
+    auto const& current = lb_placement.back();
+    if (iter % 2 == 1) {
+      EXPECT_EQ(lbNumMoved(prev, current), 0);
+    } else if (iter == 2) {
+      EXPECT_GT(lbNumMoved(prev, current), 0);
+      EXPECT_LT(lbImbalance(current), lbImbalance(lb_placement.front()));
+    }
+  };
+
+  if (this_node == 0) {
+    lbRunIterations();
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(
+  InstantiationName, TestLBAsync,
+  ::testing::Values("GreedyLB", "GossipLB")
+);
+
+}}} // end namespace vt::tests::unit
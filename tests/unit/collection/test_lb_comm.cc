@@ -0,0 +1,110 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               test_lb_comm.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+#include "test_lb_common.h"
+
+#include "vt/transport.h"
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::tests::unit;
+
+/*
+ * Fraction of the communication edges whose two ends live on different nodes
+ * under a placement
+ */
+static double offNodeFraction(LBPlacementType const& place) {
+  int32_t off_node = 0;
+  for (int32_t idx = 0; idx < lb_num_elms; idx++) {
+    auto const to = (idx + lb_comm_stride) % lb_num_elms;
+    off_node += place[idx] != place[to] ? 1 : 0;
+  }
+  return static_cast<double>(off_node) / lb_num_elms;
+}
+
+struct TestLBComm : TestParallelHarness {
+  virtual void SetUp() {
+    TestParallelHarness::SetUp();
+    arguments::ArgConfig::vt_lb = true;
+    arguments::ArgConfig::vt_lb_name = "CommLB";
+    arguments::ArgConfig::vt_lb_interval = 1;
+  }
+
+  virtual void TearDown() {
+    TestParallelHarness::TearDown();
+    lbResetIterations();
+  }
+};
+
+TEST_F(TestLBComm, test_lb_comm_migrate) {
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
+
+  if (num_nodes < 2) {
+    return;
+  }
+
+  // Pair every element with the one half the range away: the block mapping
+  // puts those on different nodes, so every edge starts out cut
+  lb_comm_stride = lb_num_elms / 2;
+
+  lb_on_iter = [](int32_t iter) {
+    auto const initial = offNodeFraction(lb_placement.front());
+    auto const current = offNodeFraction(lb_placement.back());
+    if (iter == 0) {
+      EXPECT_DOUBLE_EQ(initial, 1.0);
+    } else if (iter == 1 or iter == lb_num_iter) {
+      EXPECT_LT(current, initial);
+    }
+  };
+
+  if (this_node == 0) {
+    lbRunIterations();
+  }
+}
+
+}}} // end namespace vt::tests::unit
@@ -0,0 +1,288 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               test_lb_common.h
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#if !defined INCLUDED_COLLECTION_TEST_LB_COMMON_H
+#define INCLUDED_COLLECTION_TEST_LB_COMMON_H
+
+#include "vt/transport.h"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace vt { namespace tests { namespace unit {
+
+/*
+ * Iteration driver shared by the load balancer tests: a 1D collection runs
+ * `lb_num_iter` + 1 iterations with a phase boundary, and thus an LB, after
+ * each but the last. Every iteration reduces the node each element ran on to
+ * the root, so a test can check what its balancer actually did with the
+ * elements rather than only that they survived it.
+ */
+
+struct LBIterCol;
+struct LBIterMsg;
+struct LBCommMsg;
+struct LBPlaceMsg;
+
+using LBProxyType     = CollectionIndexProxy<LBIterCol,Index1D>;
+using LBPlacementType = std::vector<int32_t>;
+
+static int32_t lb_num_elms = 64;
+static int32_t lb_num_iter = 4;
+
+// Size each element reports for migration cost and memory budgets; zero
+// leaves it to the element's serialized size
+static std::size_t lb_elm_bytes = 0;
+
+// When nonzero, every element sends a message to the element this far ahead
+// of it each iteration, so the balancers see some communication
+static int32_t lb_comm_stride = 0;
+
+// Node each element ran on, one entry per iteration, filled in at the root
+static std::vector<LBPlacementType> lb_placement = {};
+
+// Run at the root once the placement of an iteration is known
+static std::function<void(int32_t)> lb_on_iter = nullptr;
+
+// Busy time of each element per iteration, in microseconds. The heavy
+// elements sit at the start of the range, so the default block mapping puts
+// them all on the first node
+static int32_t lb_num_heavy = 8;
+static int64_t lb_heavy_us = 1000;
+static int64_t lb_light_us = 10;
+
+inline int64_t lbWork(int32_t idx) {
+  return idx < lb_num_heavy ? lb_heavy_us : lb_light_us;
+}
+
+/*
+ * Max over average of the per-node work under a placement. The elements spin
+ * for their work, so this is also what the balancers measure
+ */
+inline double lbImbalance(LBPlacementType const& place) {
+  auto const num_nodes = theContext()->getNumNodes();
+  std::vector<double> load(num_nodes, 0.0);
+  double total = 0.0;
+  for (int32_t idx = 0; idx < static_cast<int32_t>(place.size()); idx++) {
+    load[place[idx]] += lbWork(idx);
+    total += lbWork(idx);
+  }
+  auto const max = *std::max_element(load.begin(), load.end());
+  return max / (total / num_nodes);
+}
+
+inline int32_t lbNumMoved(
+  LBPlacementType const& before, LBPlacementType const& after
+) {
+  int32_t moved = 0;
+  for (std::size_t idx = 0; idx < before.size(); idx++) {
+    moved += before[idx] != after[idx] ? 1 : 0;
+  }
+  return moved;
+}
+
+struct LBIterCol : Collection<LBIterCol,Index1D> {
+  LBIterCol() = default;
+
+  void setValues() {
+    val1 = getIndex().x();
+    val2 = 29 * val1 + 7;
+  }
+
+  void assertValues() {
+    EXPECT_EQ(val1, getIndex().x());
+    EXPECT_EQ(val2, 29 * val1 + 7);
+  }
+
+  std::size_t getMemoryFootprint() const override {
+    return lb_elm_bytes;
+  }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    Collection<LBIterCol,Index1D>::serialize(s);
+    s | val1 | val2 | data_;
+  }
+
+  static void iterWork(LBIterMsg* msg, LBIterCol* col);
+  static void commWork(LBCommMsg* msg, LBIterCol* col);
+
+public:
+  double data_ = 1.0;
+  int64_t val1 = 0, val2 = 0;
+};
+
+struct LBIterMsg : CollectionMessage<LBIterCol> {
+  LBIterMsg() = default;
+  explicit LBIterMsg(int32_t const in_iter) : iter_(in_iter) {}
+  int32_t iter_ = 0;
+};
+
+struct LBCommMsg : CollectionMessage<LBIterCol> {
+  LBCommMsg() = default;
+  explicit LBCommMsg(int32_t const in_from) : from_(in_from) {}
+  int32_t from_ = 0;
+  std::array<double, 64> payload_ = {};
+};
+
+struct LBPlaceMsg : collective::ReduceTMsg<LBPlacementType> {
+  LBPlaceMsg() = default;
+  LBPlaceMsg(LBProxyType in_proxy, int32_t in_iter, int32_t in_idx)
+    : collective::ReduceTMsg<LBPlacementType>(
+        LBPlacementType(lb_num_elms, -1)
+      ),
+      proxy_(in_proxy), iter_(in_iter)
+  {
+    getVal()[in_idx] = theContext()->getNode();
+  }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    collective::ReduceTMsg<LBPlacementType>::invokeSerialize(s);
+    s | proxy_ | iter_;
+  }
+
+  LBProxyType proxy_ = {};
+  int32_t iter_ = 0;
+};
+
+inline void lbStartIter(int32_t const iter, LBProxyType proxy) {
+  auto msg = makeSharedMessage<LBIterMsg>(iter);
+  proxy.broadcast<LBIterMsg,LBIterCol::iterWork>(msg);
+}
+
+struct LBIterFinished {
+  void operator()(LBPlaceMsg* raw_msg) {
+    auto msg = promoteMsg(raw_msg);
+    auto const iter = msg->iter_;
+    auto const& place = msg->getConstVal();
+
+    // Every element must have run, wherever it migrated to
+    EXPECT_EQ(std::count(place.begin(), place.end(), -1), 0);
+
+    lb_placement.push_back(place);
+    if (lb_on_iter != nullptr) {
+      lb_on_iter(iter);
+    }
+
+    if (iter < lb_num_iter) {
+      theCollection()->nextPhase<LBIterCol>(msg->proxy_,iter,[=]{
+        lbStartIter(iter+1, msg->proxy_);
+      });
+    } else {
+      msg->proxy_.destroy();
+    }
+  }
+};
+
+/*static*/ inline void LBIterCol::commWork(LBCommMsg* msg, LBIterCol* col) {
+  auto const idx = col->getIndex().x();
+  EXPECT_EQ((msg->from_ + lb_comm_stride) % lb_num_elms, idx);
+}
+
+/*static*/ inline void LBIterCol::iterWork(LBIterMsg* msg, LBIterCol* col) {
+  auto const idx = col->getIndex().x();
+  auto const iter = msg->iter_;
+
+  // Spin rather than compute, so the measured load does not depend on the
+  // speed of the machine
+  auto const start = timing::Timing::getCurrentTime();
+  auto const busy = static_cast<TimeType>(lbWork(idx)) / 1000000.0;
+  while (timing::Timing::getCurrentTime() - start < busy) { }
+  col->data_ += 1.0;
+
+  if (iter == 0) {
+    col->setValues();
+  } else {
+    col->assertValues();
+  }
+
+  auto proxy = col->getCollectionProxy();
+  if (lb_comm_stride != 0) {
+    auto const to = (idx + lb_comm_stride) % lb_num_elms;
+    auto comm_msg = makeSharedMessage<LBCommMsg>(idx);
+    proxy[to].send<LBCommMsg,LBIterCol::commWork>(comm_msg);
+  }
+
+  auto reduce_msg = makeSharedMessage<LBPlaceMsg>(proxy,iter,idx);
+  theCollection()->reduceMsg<
+    LBIterCol,
+    LBPlaceMsg,
+    LBPlaceMsg::template msgHandler<
+      LBPlaceMsg, collective::MaxOp<LBPlacementType>, LBIterFinished
+    >
+  >(proxy, reduce_msg);
+}
+
+/*
+ * Construct the collection and start the first iteration; called on a single
+ * node. The iterations, and the LBs between them, run while the harness
+ * drains the scheduler at the end of the test.
+ */
+inline void lbRunIterations() {
+  auto const& range = Index1D(lb_num_elms);
+  auto proxy = theCollection()->construct<LBIterCol>(range);
+  lbStartIter(0,proxy);
+}
+
+inline void lbResetIterations() {
+  arguments::ArgConfig::vt_lb = false;
+  arguments::ArgConfig::vt_lb_name = "NoLB";
+  lb_elm_bytes = 0;
+  lb_num_heavy = 8;
+  lb_heavy_us = 1000;
+  lb_light_us = 10;
+  lb_comm_stride = 0;
+  lb_placement.clear();
+  lb_on_iter = nullptr;
+}
+
+}}} // end namespace vt::tests::unit
+
+#endif /*INCLUDED_COLLECTION_TEST_LB_COMMON_H*/
@@ -0,0 +1,117 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           test_lb_greedy_group.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+#include "test_lb_common.h"
+
+#include "vt/transport.h"
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::tests::unit;
+
+/*
+ * Run with --vt_lb_greedy_group_size as the parameter: 0 is the flat
+ * GreedyLB, against which the grouped mode is held to the same checks
+ */
+struct TestLBGreedyGroup : TestParallelHarnessParam<int32_t> {
+  virtual void TearDown() {
+    TestParallelHarnessParam<int32_t>::TearDown();
+    lbResetIterations();
+    arguments::ArgConfig::vt_lb_greedy_group_size = 0;
+  }
+};
+
+TEST_P(TestLBGreedyGroup, test_lb_greedy_group_migrate) {
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
+  auto const group_size = GetParam();
+
+  // Groups of two only take effect with more than two ranks
+  if (num_nodes < 3) {
+    return;
+  }
+
+  arguments::ArgConfig::vt_lb = true;
+  arguments::ArgConfig::vt_lb_name = "GreedyLB";
+  arguments::ArgConfig::vt_lb_interval = 1;
+  arguments::ArgConfig::vt_lb_greedy_group_size = group_size;
+
+  // GreedyLB samples object loads into 10 ms bins; keep the heavy elements
+  // well above that so the inter-group flows can be filled with them
+  lb_heavy_us = 40000;
+  lb_light_us = 400;
+
+  lb_on_iter = [group_size](int32_t iter) {
+    if (iter != 1) {
+      return;
+    }
+
+    auto const& initial = lb_placement[0];
+    auto const& balanced = lb_placement[1];
+    EXPECT_LT(lbImbalance(balanced), lbImbalance(initial));
+
+    if (group_size > 0) {
+      // All the heavy elements start out in the first group, so its surplus
+      // can only be shed by flows to the other groups
+      int32_t left_group = 0;
+      for (int32_t idx = 0; idx < lb_num_heavy; idx++) {
+        left_group += balanced[idx] / group_size != 0 ? 1 : 0;
+      }
+      EXPECT_GT(left_group, 0);
+    }
+  };
+
+  if (this_node == 0) {
+    lbRunIterations();
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(
+  InstantiationName, TestLBGreedyGroup, ::testing::Values(0, 2)
+);
+
+}}} // end namespace vt::tests::unit
@@ -0,0 +1,130 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              test_lb_memory.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+#include "test_lb_common.h"
+
+#include "vt/transport.h"
+#include "vt/vrt/collection/balance/lb_invoke/invoke.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::tests::unit;
+
+using LBManagerType = vrt::collection::balance::LBManager;
+
+static constexpr int32_t const elms_per_node = 16;
+static constexpr int32_t const max_elms_per_node = elms_per_node + 1;
+
+static LBManagerType::MigrationTotalsType const& migrationTotals() {
+  return LBManagerType::getProxy().get()->getMigrationTotals();
+}
+
+struct TestLBMemory : TestParallelHarnessParam<std::string> {
+  virtual void SetUp() {
+    TestParallelHarnessParam<std::string>::SetUp();
+    arguments::ArgConfig::vt_lb = true;
+    arguments::ArgConfig::vt_lb_name = GetParam();
+    arguments::ArgConfig::vt_lb_interval = 1;
+    lb_num_elms = elms_per_node * theContext()->getNumNodes();
+    lb_elm_bytes = 1 << 20;
+    arguments::ArgConfig::vt_lb_memory_capacity =
+      max_elms_per_node * lb_elm_bytes;
+  }
+
+  virtual void TearDown() {
+    TestParallelHarnessParam<std::string>::TearDown();
+    lbResetIterations();
+    lb_num_elms = 64;
+    arguments::ArgConfig::vt_lb_memory_capacity = 0;
+  }
+};
+
+TEST_P(TestLBMemory, test_lb_memory_capacity) {
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
+
+  if (num_nodes < 2) {
+    return;
+  }
+
+  // The first node holds nothing but heavy elements. Balancing them would
+  // send more than one to each other node, yet each has room for only one
+  lb_num_heavy = elms_per_node;
+
+  lb_on_iter = [num_nodes](int32_t iter) {
+    std::vector<int32_t> elms_on_node(num_nodes, 0);
+    for (auto&& elm_node : lb_placement.back()) {
+      elms_on_node[elm_node]++;
+    }
+    for (auto&& count : elms_on_node) {
+      EXPECT_LE(count, max_elms_per_node);
+    }
+
+    if (iter == 1) {
+      auto const& totals = migrationTotals();
+      EXPECT_GT(lbNumMoved(lb_placement[0], lb_placement[1]), 0);
+      EXPECT_LT(lbImbalance(lb_placement[1]), lbImbalance(lb_placement[0]));
+      EXPECT_GT(totals[3], 0);
+    }
+  };
+
+  if (this_node == 0) {
+    lbRunIterations();
+  }
+}
+
+INSTANTIATE_TEST_CASE_P(
+  InstantiationName, TestLBMemory,
+  ::testing::Values("GreedyLB", "HierarchicalLB")
+);
+
+}}} // end namespace vt::tests::unit
@@ -0,0 +1,141 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                          test_lb_migration_cost.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+#include "test_lb_common.h"
+
+#include "vt/transport.h"
+#include "vt/vrt/collection/balance/lb_invoke/invoke.h"
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::tests::unit;
+
+using LBManagerType = vrt::collection::balance::LBManager;
+
+static constexpr std::size_t const elm_bytes = 1024;
+
+static LBManagerType::MigrationTotalsType const& migrationTotals() {
+  return LBManagerType::getProxy().get()->getMigrationTotals();
+}
+
+struct TestLBMigrationCost : TestParallelHarness {
+  virtual void SetUp() {
+    TestParallelHarness::SetUp();
+    arguments::ArgConfig::vt_lb = true;
+    arguments::ArgConfig::vt_lb_name = "HierarchicalLB";
+    arguments::ArgConfig::vt_lb_interval = 1;
+  }
+
+  virtual void TearDown() {
+    TestParallelHarness::TearDown();
+    lbResetIterations();
+    arguments::ArgConfig::vt_lb_migration_horizon = 0;
+    arguments::ArgConfig::vt_lb_migration_bandwidth = 1e9;
+  }
+};
+
+TEST_F(TestLBMigrationCost, test_lb_migration_cost_reject) {
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
+
+  if (num_nodes < 2) {
+    return;
+  }
+
+  // At one byte per second and a one phase horizon no move can pay off
+  arguments::ArgConfig::vt_lb_migration_horizon = 1;
+  arguments::ArgConfig::vt_lb_migration_bandwidth = 1.0;
+  lb_elm_bytes = elm_bytes;
+
+  lb_on_iter = [](int32_t iter) {
+    if (iter == 0) {
+      return;
+    }
+    auto const& totals = migrationTotals();
+    EXPECT_EQ(lbNumMoved(lb_placement.front(), lb_placement.back()), 0);
+    EXPECT_EQ(totals[1], 0);
+    EXPECT_GT(totals[2], 0);
+  };
+
+  if (this_node == 0) {
+    lbRunIterations();
+  }
+}
+
+TEST_F(TestLBMigrationCost, test_lb_migration_cost_accept) {
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
+
+  if (num_nodes < 2) {
+    return;
+  }
+
+  // A kilobyte takes about a microsecond to move, far less than even a light
+  // element saves over ten phases
+  arguments::ArgConfig::vt_lb_migration_horizon = 10;
+  arguments::ArgConfig::vt_lb_migration_bandwidth = 1e9;
+  lb_elm_bytes = elm_bytes;
+
+  lb_on_iter = [](int32_t iter) {
+    if (iter != 1) {
+      return;
+    }
+    auto const& totals = migrationTotals();
+    auto const moved = lbNumMoved(lb_placement[0], lb_placement[1]);
+    EXPECT_GT(moved, 0);
+    EXPECT_LT(lbImbalance(lb_placement[1]), lbImbalance(lb_placement[0]));
+    // Every accepted move is counted once, at the node the element left
+    EXPECT_EQ(totals[1] % static_cast<int64_t>(elm_bytes), 0);
+    EXPECT_GE(totals[1], moved * static_cast<int64_t>(elm_bytes));
+  };
+
+  if (this_node == 0) {
+    lbRunIterations();
+  }
+}
+
+}}} // end namespace vt::tests::unit
@@ -0,0 +1,100 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               test_lb_model.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_harness.h"
+
+#include "vt/transport.h"
+#include "vt/vrt/collection/balance/load_model.h"
+
+#include <vector>
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::vrt::collection::balance;
+
+struct TestLBModel : TestHarness { };
+
+TEST_F(TestLBModel, test_lb_model_persistence) {
+  PersistenceModel model;
+  LoadModel::HistoryType history = {1.0, 2.0, 3.0};
+  EXPECT_DOUBLE_EQ(model.predict(history, 0), 1.0);
+  EXPECT_DOUBLE_EQ(model.predict(history, 2), 3.0);
+}
+
+TEST_F(TestLBModel, test_lb_model_ema) {
+  EMAModel model(0.5);
+  LoadModel::HistoryType history = {4.0, 2.0, 1.0};
+  EXPECT_DOUBLE_EQ(model.predict(history, 0), 4.0);
+  EXPECT_DOUBLE_EQ(model.predict(history, 1), 3.0);
+  EXPECT_DOUBLE_EQ(model.predict(history, 2), 2.0);
+}
+
+TEST_F(TestLBModel, test_lb_model_trend) {
+  LinearTrendModel model(3);
+  LoadModel::HistoryType history = {10.0, 1.0, 2.0, 3.0, 1.0, 0.0};
+  // Too little history falls back to persistence
+  EXPECT_DOUBLE_EQ(model.predict(history, 0), 10.0);
+  // Only the last three phases are fitted
+  EXPECT_DOUBLE_EQ(model.predict(history, 3), 4.0);
+  // A falling trend never predicts a negative load
+  EXPECT_DOUBLE_EQ(model.predict(history, 5), 0.0);
+}
+
+TEST_F(TestLBModel, test_lb_model_periodic) {
+  LoadModel::HistoryType history = {5.0, 1.0, 1.0, 5.0, 1.0, 1.0};
+
+  PeriodicModel period(3, 4);
+  EXPECT_DOUBLE_EQ(period.predict(history, 1), 1.0);
+  EXPECT_DOUBLE_EQ(period.predict(history, 2), 5.0);
+  EXPECT_DOUBLE_EQ(period.predict(history, 5), 5.0);
+
+  PeriodicModel window(0, 2);
+  EXPECT_DOUBLE_EQ(window.predict(history, 3), 5.0);
+  EXPECT_DOUBLE_EQ(window.predict(history, 5), 1.0);
+}
+
+}}} // end namespace vt::tests::unit
@@ -0,0 +1,131 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                           test_lb_stats_summary.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#include <gtest/gtest.h>
+
+#include "test_harness.h"
+
+#include "vt/transport.h"
+#include "vt/vrt/collection/balance/stats_summary.h"
+
+#include <string>
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::vrt::collection::balance;
+
+struct TestLBStatsSummary : TestHarness { };
+
+TEST_F(TestLBStatsSummary, test_lb_stats_summary_histogram_bucket) {
+  EXPECT_EQ(histogramBucket(0.0), 0u);
+  EXPECT_EQ(histogramBucket(0.5e-6), 0u);
+  EXPECT_EQ(histogramBucket(1e-6), 1u);
+  EXPECT_EQ(histogramBucket(3e-6), 2u);
+  EXPECT_EQ(histogramBucket(4e-6), 3u);
+  EXPECT_EQ(histogramBucket(1e6), stats_hist_buckets - 1);
+}
+
+TEST_F(TestLBStatsSummary, test_lb_stats_summary_merge) {
+  StatsSummary s1{3}, s2{3};
+  s1.addObject(1, 0, 1.0, 10);
+  s1.addObject(2, 0, 4.0, 10);
+  s1.addProcessor(5.0);
+  s1.addStatistic(lb::Statistic::P_l, LoadData(5.0));
+  s2.addObject(3, 1, 3.0, 10);
+  s2.addObject(4, 1, 2.0, 20);
+  s2.addObject(5, 1, 5.0, 20);
+  s2.addProcessor(10.0);
+  s2.addStatistic(lb::Statistic::P_l, LoadData(10.0));
+
+  auto s = s1 + s2;
+
+  // The three heaviest objects, heaviest first
+  ASSERT_EQ(s.top_.size(), 3u);
+  EXPECT_EQ(std::get<0>(s.top_[0]), 5u);
+  EXPECT_EQ(std::get<0>(s.top_[1]), 2u);
+  EXPECT_EQ(std::get<0>(s.top_[2]), 3u);
+  EXPECT_EQ(std::get<1>(s.top_[0]), 1);
+
+  int64_t objs = 0, procs = 0;
+  for (std::size_t i = 0; i < stats_hist_buckets; i++) {
+    objs += s.obj_hist_[i];
+    procs += s.proc_hist_[i];
+  }
+  EXPECT_EQ(objs, 5);
+  EXPECT_EQ(procs, 2);
+
+  ASSERT_EQ(s.collections_.size(), 2u);
+  EXPECT_EQ(s.collections_[10].N_, 3);
+  EXPECT_DOUBLE_EQ(s.collections_[20].sum(), 7.0);
+
+  auto const& p_l = s.stats_[static_cast<std::size_t>(lb::Statistic::P_l)];
+  EXPECT_DOUBLE_EQ(p_l.max(), 10.0);
+  EXPECT_DOUBLE_EQ(p_l.avg(), 7.5);
+}
+
+TEST_F(TestLBStatsSummary, test_lb_stats_summary_json) {
+  StatsSummary s{1};
+  s.addObject(7, 0, 2.0, 10);
+  s.addProcessor(2.0);
+  s.addStatistic(lb::Statistic::P_l, LoadData(2.0));
+
+  auto const json = s.toJSON(4);
+  EXPECT_NE(json.find("\"phase\":4"), std::string::npos);
+  EXPECT_NE(json.find("\"P_l\":{"), std::string::npos);
+  EXPECT_NE(json.find("\"hist_unit\":\"log2_us\""), std::string::npos);
+  EXPECT_NE(json.find("\"O_l_hist\":["), std::string::npos);
+  EXPECT_NE(json.find("\"P_l_hist\":["), std::string::npos);
+  EXPECT_NE(json.find("\"top\":[{\"id\":7,\"node\":0"), std::string::npos);
+  EXPECT_NE(json.find("\"collections\":[{\"proxy\":10"), std::string::npos);
+  // Statistics without samples are left out
+  EXPECT_EQ(json.find("\"O_c\""), std::string::npos);
+  // The skewness of a single sample is not finite
+  EXPECT_NE(json.find("\"skw\":null"), std::string::npos);
+  EXPECT_EQ(json.find("nan"), std::string::npos);
+  EXPECT_EQ(json.find('\n'), std::string::npos);
+}
+
+}}} // end namespace vt::tests::unit
@@ -0,0 +1,104 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                              test_lb_timers.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+
+#include "vt/transport.h"
+#include "vt/timing/timing.h"
+
+#include <string>
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::timing;
+
+struct TestLBTimers : TestParallelHarnessParam<std::string> {
+  virtual void TearDown() {
+    TestParallelHarnessParam<std::string>::TearDown();
+    arguments::ArgConfig::vt_lb_timer = "mpi";
+    arguments::ArgConfig::vt_lb_cpu_time = false;
+    Timing::initializeLBTimers();
+  }
+};
+
+static double spin(double secs) {
+  double val = 1.0;
+  auto const start = Timing::getMonotonicRawTime();
+  while (Timing::getMonotonicRawTime() - start < secs) {
+    val = val * 1.000001 + 0.5;
+  }
+  return val;
+}
+
+TEST_P(TestLBTimers, test_lb_timer_elapsed) {
+  arguments::ArgConfig::vt_lb_timer = GetParam();
+  arguments::ArgConfig::vt_lb_cpu_time = true;
+  Timing::initializeLBTimers();
+  EXPECT_TRUE(Timing::recordCPUTime());
+
+  auto const secs = 0.05;
+  auto const wall0 = Timing::getLBTime();
+  auto const cpu0 = Timing::getThreadCPUTime();
+  auto const val = spin(secs);
+  auto const wall = Timing::getLBTime() - wall0;
+  auto const cpu = Timing::getThreadCPUTime() - cpu0;
+
+  EXPECT_GT(val, 0.0);
+  // Every backend measures seconds
+  EXPECT_GE(wall, secs * 0.9);
+  EXPECT_LT(wall, secs * 10.0);
+  // A busy thread accrues CPU time, though never more than the wall time
+  EXPECT_GT(cpu, 0.0);
+  EXPECT_LE(cpu, wall * 1.1);
+}
+
+INSTANTIATE_TEST_CASE_P(
+  InstantiationName, TestLBTimers,
+  ::testing::Values("mpi", "tsc", "monotonic")
+);
+
+}}} // end namespace vt::tests::unit
@@ -48,6 +48,12 @@ namespace vt { namespace tests { namespace unit {
 
 struct TestReduceCollection : TestParallelHarnessParam<int> {};
 
+#if ENABLE_REDUCE_EXPR_CALLBACK
+  static constexpr int const num_reduce_cases = 8;
+#else
+  static constexpr int const num_reduce_cases = 5;
+#endif
+
 TEST_P(TestReduceCollection, test_reduce_op) {
   using namespace reduce;
 
@@ -73,6 +79,18 @@ TEST_P(TestReduceCollection, test_reduce_op) {
         case 6: proxy.broadcast<ColMsg, colHanPartialMulti>(msg); break;
         case 7: proxy.broadcast<ColMsg, colHanPartialProxy>(msg); break;
       #endif
+      case num_reduce_cases:
+        proxy.broadcast<ColMsg, colHanContribute>(msg);
+        break;
+      case num_reduce_cases + 1:
+        proxy.broadcast<ColMsg, colHanContributeRounds>(msg);
+        break;
+      case num_reduce_cases + 2:
+        proxy.broadcast<ColMsg, colHanContributeMixed>(msg);
+        break;
+      case num_reduce_cases + 3:
+        proxy.broadcast<ColMsg, colHanContributeMigrate>(msg);
+        break;
       default: vtAbort("Failure: should not be reached");
     }
   }
@@ -80,11 +98,11 @@ TEST_P(TestReduceCollection, test_reduce_op) {
 
 #if ENABLE_REDUCE_EXPR_CALLBACK
   INSTANTIATE_TEST_CASE_P(
-    InstantiationName, TestReduceCollection, ::testing::Range(0, 8),
+    InstantiationName, TestReduceCollection, ::testing::Range(0, 12),
   );
 #else
   INSTANTIATE_TEST_CASE_P(
-    InstantiationName, TestReduceCollection, ::testing::Range(0, 5),
+    InstantiationName, TestReduceCollection, ::testing::Range(0, 9),
   );
 #endif
 
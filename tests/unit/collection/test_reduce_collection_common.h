@@ -106,6 +106,24 @@ struct CheckVec {
   }
 };
 
+using ContributeMsg = vt::collective::ReduceTMsg<int>;
+
+struct CheckContribute {
+  void operator()(ContributeMsg* msg) {
+    auto const value = msg->getConstVal();
+    debug_print(reduce, node, "final contribute value={}\n", value);
+    EXPECT_EQ(value, reduce::collect_size * (reduce::collect_size - 1) / 2);
+  }
+};
+
+struct CheckContributeDouble {
+  void operator()(ContributeMsg* msg) {
+    auto const value = msg->getConstVal();
+    debug_print(reduce, node, "final contribute double value={}\n", value);
+    EXPECT_EQ(value, reduce::collect_size * (reduce::collect_size - 1));
+  }
+};
+
 struct NoneReduce {
   void operator()(MyReduceNoneMsg* msg) { }
 };
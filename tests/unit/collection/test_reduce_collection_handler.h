@@ -146,6 +146,98 @@ void colHanNoneCB(ColMsg* msg, MyCol* col) {
   proxy.reduce(rmsg.get(),cb);
 }
 
+void colHanContribute(ColMsg* msg, MyCol* col) {
+  auto const& idx = col->getIndex();
+  debug_print(
+    reduce, node,
+    "colHanContribute: received: ptr={}, idx={}, getIndex={}\n",
+    print_ptr(col), idx.x(), col->getIndex().x()
+  );
+
+  auto proxy = col->getCollectionProxy();
+  auto cb = vt::theCB()->makeSend<CheckContribute>(0);
+  vtAssertExpr(cb.valid());
+  proxy.contribute<vt::collective::PlusOp<int>>(
+    idx, static_cast<int>(idx.x()), cb
+  );
+}
+
+void colHanContributeRounds(ColMsg* msg, MyCol* col) {
+  auto const& idx = col->getIndex();
+  debug_print(
+    reduce, node,
+    "colHanContributeRounds: received: ptr={}, idx={}\n",
+    print_ptr(col), idx.x()
+  );
+
+  // Two reductions with the same tag in flight: each must only see its own
+  // round of contributions
+  auto proxy = col->getCollectionProxy();
+  auto cb1 = vt::theCB()->makeSend<CheckContribute>(0);
+  auto cb2 = vt::theCB()->makeSend<CheckContributeDouble>(0);
+  proxy.contribute<vt::collective::PlusOp<int>>(
+    idx, static_cast<int>(idx.x()), cb1
+  );
+  proxy.contribute<vt::collective::PlusOp<int>>(
+    idx, static_cast<int>(idx.x() * 2), cb2
+  );
+}
+
+void colHanContributeMixed(ColMsg* msg, MyCol* col) {
+  auto const& idx = col->getIndex();
+  debug_print(
+    reduce, node,
+    "colHanContributeMixed: received: ptr={}, idx={}\n",
+    print_ptr(col), idx.x()
+  );
+
+  // A plain reduction of the same message type with the default tag, in
+  // flight alongside a round of contributions: they must not merge
+  auto proxy = col->getCollectionProxy();
+  auto cb1 = vt::theCB()->makeSend<CheckContribute>(0);
+  auto cb2 = vt::theCB()->makeSend<CheckContributeDouble>(0);
+  proxy.contribute<vt::collective::PlusOp<int>>(
+    idx, static_cast<int>(idx.x()), cb1
+  );
+  auto reduce_msg = vt::makeSharedMessage<ContributeMsg>(
+    static_cast<int>(idx.x() * 2)
+  );
+  proxy.reduce<vt::collective::PlusOp<int>>(reduce_msg,cb2);
+}
+
+void colHanContributeArrived(ColMsg* msg, MyCol* col) {
+  auto const& idx = col->getIndex();
+  auto proxy = col->getCollectionProxy();
+  auto cb = vt::theCB()->makeSend<CheckContributeDouble>(0);
+  proxy.contribute<vt::collective::PlusOp<int>>(
+    idx, static_cast<int>(idx.x() * 2), cb
+  );
+}
+
+void colHanContributeMigrate(ColMsg* msg, MyCol* col) {
+  auto const idx = col->getIndex();
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+  debug_print(
+    reduce, node,
+    "colHanContributeMigrate: received: ptr={}, idx={}\n",
+    print_ptr(col), idx.x()
+  );
+
+  // Move on to the next node while the first round may still be open on
+  // both nodes, and contribute to the second round from there
+  auto proxy = col->getCollectionProxy();
+  auto cb = vt::theCB()->makeSend<CheckContribute>(0);
+  proxy.contribute<vt::collective::PlusOp<int>>(
+    idx, static_cast<int>(idx.x()), cb
+  );
+  if (num_nodes > 1) {
+    col->migrate((this_node + 1) % num_nodes);
+  }
+  auto next_msg = vt::makeSharedMessage<ColMsg>(this_node);
+  proxy[idx].send<ColMsg, colHanContributeArrived>(next_msg);
+}
+
 // Using reduceExpr with callback is broken and has fundamental flaws.
 // These tests are disabled for now.
 #if ENABLE_REDUCE_EXPR_CALLBACK
@@ -0,0 +1,237 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               test_section.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+#include "test_collection_common.h"
+
+#include "vt/transport.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace vt { namespace tests { namespace unit {
+
+struct TestSection : TestParallelHarness { };
+
+static constexpr int32_t const num_elms_per_node = 8;
+static constexpr int32_t const num_multicasts = 5;
+
+// Number of nodes each multicasting num_multicasts times in the current test
+static int32_t num_senders = 1;
+
+struct SectionMsg;
+struct MigrateMsg;
+
+struct SectionTest : Collection<SectionTest,Index1D> {
+  SectionTest() : origin_(theContext()->getNode()) { }
+
+  virtual ~SectionTest() {
+    // The copy left behind by a migration is destroyed before it receives
+    // anything; its counts are checked where it lands
+    if (migrated_out_) {
+      return;
+    }
+    auto const expected =
+      inSection(this->getIndex()) ? num_multicasts * num_senders : 0;
+    EXPECT_EQ(num_recv_, expected);
+  }
+
+  static bool inSection(Index1D const& idx) {
+    return idx.x() % 3 == 0;
+  }
+
+  void work(SectionMsg* msg);
+  void migrateAway(MigrateMsg* msg);
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    Collection<SectionTest,Index1D>::serialize(s);
+    s | num_recv_ | origin_ | migrated_;
+  }
+
+  int32_t num_recv_ = 0;
+  NodeType origin_ = uninitialized_destination;
+  bool migrated_ = false;
+  bool migrated_out_ = false;
+};
+
+struct SectionMsg : CollectionMessage<SectionTest> {};
+struct MigrateMsg : CollectionMessage<SectionTest> {};
+
+void SectionTest::work(SectionMsg* msg) {
+  EXPECT_TRUE(inSection(this->getIndex()));
+  if (migrated_) {
+    EXPECT_NE(theContext()->getNode(), origin_);
+  }
+  num_recv_++;
+}
+
+void SectionTest::migrateAway(MigrateMsg* msg) {
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
+  // An element may see the broadcast again on the node it moved to
+  if (inSection(this->getIndex()) and num_nodes > 1 and not migrated_) {
+    migrated_ = true;
+    migrated_out_ = true;
+    this->migrate((this_node + 1) % num_nodes);
+  }
+}
+
+struct SectionBcastMsg : ::vt::Message {
+  SectionBcastMsg() = default;
+  explicit SectionBcastMsg(CollectionSection<SectionTest> const& in_section)
+    : section_(in_section)
+  { }
+
+  CollectionSection<SectionTest> section_;
+};
+
+static void multicastSection(CollectionSection<SectionTest> const& section) {
+  for (int i = 0; i < num_multicasts; i++) {
+    section.multicast<SectionMsg,&SectionTest::work>();
+  }
+}
+
+static void sectionBcastHandler(SectionBcastMsg* msg) {
+  multicastSection(msg->section_);
+}
+
+TEST_F(TestSection, test_section_multicast_idx_list_1) {
+  num_senders = 1;
+
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
+  if (this_node == 0) {
+    auto const& num_elms = num_nodes * num_elms_per_node;
+    auto const& range = Index1D(num_elms);
+    auto proxy = theCollection()->construct<SectionTest>(range);
+
+    std::vector<Index1D> idxs;
+    for (int32_t i = 0; i < num_elms; i++) {
+      if (SectionTest::inSection(Index1D(i))) {
+        idxs.emplace_back(i);
+      }
+    }
+
+    auto section = theCollection()->createSection(proxy, idxs);
+    for (int i = 0; i < num_multicasts; i++) {
+      section.multicast<SectionMsg,&SectionTest::work>();
+    }
+  }
+}
+
+TEST_F(TestSection, test_section_multicast_predicate_1) {
+  num_senders = 1;
+
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
+  if (this_node == 0) {
+    auto const& range = Index1D(num_nodes * num_elms_per_node);
+    auto proxy = theCollection()->construct<SectionTest>(range);
+    auto section = theCollection()->createSection<SectionTest,Index1D>(
+      proxy, SectionTest::inSection
+    );
+    for (int i = 0; i < num_multicasts; i++) {
+      section.multicast<SectionMsg,&SectionTest::work>();
+    }
+  }
+}
+
+TEST_F(TestSection, test_section_multicast_non_root_1) {
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
+
+  // Every node multicasts: all but the root go through the section root
+  num_senders = num_nodes;
+
+  if (this_node == 0) {
+    auto const& range = Index1D(num_nodes * num_elms_per_node);
+    auto proxy = theCollection()->construct<SectionTest>(range);
+    auto section = theCollection()->createSection<SectionTest,Index1D>(
+      proxy, SectionTest::inSection
+    );
+
+    auto msg = makeSharedMessage<SectionBcastMsg>(section);
+    theMsg()->broadcastMsg<SectionBcastMsg,sectionBcastHandler>(msg);
+    multicastSection(section);
+  }
+}
+
+TEST_F(TestSection, test_section_multicast_migrated_1) {
+  auto const& this_node = theContext()->getNode();
+  auto const& num_nodes = theContext()->getNumNodes();
+
+  num_senders = 1;
+
+  CollectionProxy<SectionTest,Index1D> proxy;
+  CollectionSection<SectionTest> section;
+
+  // Build the section while every element is on its home node
+  theTerm()->scope.collective([&]{
+    if (this_node == 0) {
+      auto const& range = Index1D(num_nodes * num_elms_per_node);
+      proxy = theCollection()->construct<SectionTest>(range);
+      section = theCollection()->createSection<SectionTest,Index1D>(
+        proxy, SectionTest::inSection
+      );
+    }
+  });
+
+  // Move every section member off the node its cached route points at
+  theTerm()->scope.collective([&]{
+    if (this_node == 0) {
+      proxy.broadcast<MigrateMsg,&SectionTest::migrateAway>();
+    }
+  });
+
+  theTerm()->scope.collective([&]{
+    if (this_node == 0) {
+      multicastSection(section);
+    }
+  });
+}
+
+}}} // end namespace vt::tests::unit
@@ -0,0 +1,137 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             test_stats_binary.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+
+#include "vt/transport.h"
+#include "vt/vrt/collection/balance/stats_binary.h"
+
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::vrt::collection::balance;
+
+struct TestStatsBinary : TestParallelHarnessParam<bool> { };
+
+static StatsPhaseData makePhase(PhaseType phase, NodeType this_node) {
+  std::unordered_map<ElementIDType,TimeType> load;
+  std::unordered_map<ElementIDType,TimeType> cpu;
+  std::unordered_map<ElementIDType,ElementIDType> temp_to_perm;
+  CommMapType comm;
+
+  for (ElementIDType i = 1; i <= 8; i++) {
+    auto const temp = (i << 32) | static_cast<ElementIDType>(this_node);
+    load[temp] = 0.001 * i + phase;
+    // Only some phases carry CPU times, as with --vt_lb_cpu_time
+    if (phase % 2 == 1) {
+      cpu[temp] = 0.0005 * i + phase;
+    }
+    temp_to_perm[temp] = 100 + i;
+    if (i > 1) {
+      auto const from = ((i - 1) << 32) | static_cast<ElementIDType>(this_node);
+      LBCommKey key(
+        LBCommKey::CollectionTag{}, 100 + i - 1, from, 100 + i, temp, false
+      );
+      comm[key] = static_cast<CommBytesType>(64 * i);
+    }
+  }
+
+  LBCommKey node_key(
+    LBCommKey::NodeToCollectionTag{}, this_node, 101,
+    (ElementIDType{1} << 32) | static_cast<ElementIDType>(this_node), false
+  );
+  comm[node_key] = 16;
+
+  return StatsPhaseData(phase, load, cpu, temp_to_perm, comm);
+}
+
+TEST_P(TestStatsBinary, test_stats_binary_round_trip) {
+  auto const this_node = theContext()->getNode();
+  auto const compress = GetParam();
+  auto const file_name = fmt::format(
+    "test_stats_binary.{}.{}", this_node, compress ? "bin.gz" : "bin"
+  );
+  PhaseType const num_phases = 3;
+
+  {
+    StatsBinaryWriter writer(file_name, this_node, compress);
+    for (PhaseType phase = 0; phase < num_phases; phase++) {
+      writer.writePhase(makePhase(phase, this_node));
+    }
+  }
+
+  StatsBinaryReader reader(file_name);
+  ASSERT_TRUE(reader.good());
+  EXPECT_EQ(reader.getNode(), this_node);
+
+  StatsPhaseData data;
+  for (PhaseType phase = 0; phase < num_phases; phase++) {
+    ASSERT_TRUE(reader.readPhase(data));
+    auto const expected = makePhase(phase, this_node);
+    EXPECT_EQ(data.phase_, phase);
+    EXPECT_EQ(data.obj_perm_, expected.obj_perm_);
+    EXPECT_EQ(data.obj_temp_, expected.obj_temp_);
+    EXPECT_EQ(data.obj_load_, expected.obj_load_);
+    EXPECT_EQ(data.obj_cpu_, expected.obj_cpu_);
+    EXPECT_EQ(data.hasCPU(), phase % 2 == 1);
+    EXPECT_EQ(data.edge_cat_, expected.edge_cat_);
+    EXPECT_EQ(data.edge_bytes_, expected.edge_bytes_);
+    EXPECT_EQ(data.makeCommMap(), expected.makeCommMap());
+  }
+  EXPECT_FALSE(reader.readPhase(data));
+
+  std::remove(file_name.c_str());
+}
+
+INSTANTIATE_TEST_CASE_P(
+  InstantiationName, TestStatsBinary, ::testing::Values(false, true)
+);
+
+}}} // end namespace vt::tests::unit
@@ -198,6 +198,63 @@ TEST_F(TestLocation, test_migrate_entity) /* NOLINT */ {
   }
 }
 
+TEST_F(TestLocation, test_migrate_entity_push_location) /* NOLINT */ {
+
+  auto const nb_nodes = vt::theContext()->getNumNodes();
+
+  // cannot observe the pushed location if less than 3 nodes
+  if (nb_nodes > 2) {
+    auto const my_node  = vt::theContext()->getNode();
+    auto const entity   = location::default_entity;
+    auto const old_home = 0;
+    auto const new_home = 1;
+    int nb_received     = 0;
+
+    if (my_node == old_home) {
+      vt::theLocMan()->virtual_loc->registerEntity(
+        entity, my_node, [&nb_received](vt::BaseMessage*) { nb_received++; }
+      );
+    }
+
+    vt::theCollective()->barrier();
+
+    // every other node sends to the entity so the old home tracks them
+    if (my_node != old_home) {
+      auto msg = vt::makeMessage<location::ShortMsg>(entity, my_node);
+      vt::theLocMan()->virtual_loc->routeMsg<location::ShortMsg>(
+        entity, old_home, msg
+      );
+    } else {
+      while (nb_received < nb_nodes - 1) {
+        vt::runScheduler();
+      }
+    }
+
+    vt::theCollective()->barrier();
+
+    if (my_node == old_home) {
+      vt::theLocMan()->virtual_loc->entityMigrated(entity, new_home);
+    } else if (my_node == new_home) {
+      vt::theLocMan()->virtual_loc->registerEntityMigrated(entity, my_node);
+    }
+
+    if (my_node > new_home) {
+      // the new home pushes its location to the previous senders
+      while (not location::isCached(entity)) {
+        vt::runScheduler();
+      }
+
+      vt::theLocMan()->virtual_loc->getLocation(
+        entity, old_home, [=](vt::NodeType node) {
+          EXPECT_EQ(node, new_home);
+        }
+      );
+    }
+
+    vt::theCollective()->barrier();
+  }
+}
+
 TEST_F(TestLocation, test_migrate_multiple_entities) /* NOLINT */ {
 
   auto const nb_nodes = vt::theContext()->getNumNodes();
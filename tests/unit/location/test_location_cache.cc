@@ -0,0 +1,137 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                            test_location_cache.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_harness.h"
+
+#include "vt/transport.h"
+#include "vt/topos/location/cache/cache.h"
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt::tests::unit;
+
+struct TestLocationCache : TestHarness { };
+
+using CacheType = location::LocationCache<int64_t, int64_t>;
+
+TEST_F(TestLocationCache, test_insert_find_remove) /* NOLINT */ {
+  CacheType cache{16};
+
+  for (int64_t i = 0; i < 16; i++) {
+    cache.insert(i, i * 10);
+  }
+
+  EXPECT_EQ(cache.getNumEntries(), 16UL);
+
+  for (int64_t i = 0; i < 16; i++) {
+    auto val = cache.find(i);
+    ASSERT_NE(val, nullptr);
+    EXPECT_EQ(*val, i * 10);
+  }
+
+  for (int64_t i = 0; i < 16; i += 2) {
+    cache.remove(i);
+  }
+
+  for (int64_t i = 0; i < 16; i++) {
+    EXPECT_EQ(cache.exists(i), i % 2 == 1);
+  }
+
+  EXPECT_EQ(cache.getNumEntries(), 8UL);
+  EXPECT_EQ(cache.getStats().hits_, 16UL);
+  EXPECT_EQ(cache.getStats().misses_, 0UL);
+}
+
+TEST_F(TestLocationCache, test_update_existing) /* NOLINT */ {
+  CacheType cache{4};
+
+  cache.insert(1, 10);
+  cache.insert(1, 20);
+
+  EXPECT_EQ(cache.getNumEntries(), 1UL);
+  EXPECT_EQ(cache.get(1), 20);
+  EXPECT_EQ(cache.find(2), nullptr);
+  EXPECT_EQ(cache.getStats().misses_, 1UL);
+}
+
+TEST_F(TestLocationCache, test_clock_eviction) /* NOLINT */ {
+  static constexpr int64_t const capacity = 8;
+
+  CacheType cache{capacity};
+
+  for (int64_t i = 0; i < capacity; i++) {
+    cache.insert(i, i);
+  }
+
+  // Inserting past the capacity must evict, never grow
+  for (int64_t i = capacity; i < capacity * 4; i++) {
+    cache.insert(i, i);
+    EXPECT_EQ(cache.getNumEntries(), static_cast<std::size_t>(capacity));
+  }
+
+  EXPECT_EQ(cache.getStats().evictions_, static_cast<uint64_t>(capacity * 3));
+
+  // The most recently inserted key always survives
+  EXPECT_TRUE(cache.exists(capacity * 4 - 1));
+}
+
+TEST_F(TestLocationCache, test_clock_second_chance) /* NOLINT */ {
+  CacheType cache{2};
+
+  cache.insert(1, 1);
+  cache.insert(2, 2);
+
+  // Touching the first key gives it a second chance: the untouched key must be
+  // the one evicted regardless of where the hand starts
+  EXPECT_NE(cache.find(1), nullptr);
+  cache.insert(3, 3);
+
+  EXPECT_TRUE(cache.exists(1));
+  EXPECT_FALSE(cache.exists(2));
+  EXPECT_TRUE(cache.exists(3));
+}
+
+}}} // end namespace vt::tests::unit
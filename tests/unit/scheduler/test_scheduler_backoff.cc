@@ -0,0 +1,122 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                          test_scheduler_backoff.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+
+#include "vt/transport.h"
+#include "vt/scheduler/poll_backoff.h"
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::tests::unit;
+
+struct TestSchedulerBackoff : TestParallelHarness { };
+
+// Count the passes skipped before the component is polled again
+static int skippedPasses(sched::PollBackoff& backoff) {
+  int skipped = 0;
+  while (not backoff.shouldPoll()) {
+    skipped++;
+  }
+  return skipped;
+}
+
+TEST_F(TestSchedulerBackoff, test_scheduler_backoff_doubles) {
+  sched::PollBackoff backoff(8);
+
+  EXPECT_TRUE(backoff.shouldPoll());
+  for (int expected : {1, 2, 4, 8, 8}) {
+    backoff.record(false);
+    EXPECT_EQ(backoff.getInterval(), static_cast<uint32_t>(expected));
+    EXPECT_EQ(skippedPasses(backoff), expected);
+  }
+
+  // Productive polls reset the backoff
+  backoff.record(true);
+  EXPECT_EQ(backoff.getInterval(), 0u);
+  EXPECT_TRUE(backoff.shouldPoll());
+}
+
+TEST_F(TestSchedulerBackoff, test_scheduler_backoff_wakeup) {
+  sched::PollBackoff backoff(16);
+  for (int i = 0; i < 4; i++) {
+    backoff.record(false);
+  }
+  EXPECT_FALSE(backoff.shouldPoll());
+
+  // A hint forces the next poll and is consumed by it
+  backoff.wakeup();
+  EXPECT_TRUE(backoff.shouldPoll());
+  backoff.record(false);
+  EXPECT_EQ(backoff.getInterval(), 16u);
+  EXPECT_FALSE(backoff.shouldPoll());
+}
+
+TEST_F(TestSchedulerBackoff, test_scheduler_backoff_no_max) {
+  // A zero maximum interval never skips a pass
+  sched::PollBackoff backoff(0);
+  for (int i = 0; i < 4; i++) {
+    backoff.record(false);
+    EXPECT_TRUE(backoff.shouldPoll());
+  }
+}
+
+TEST_F(TestSchedulerBackoff, test_scheduler_backoff_defaults) {
+  using sched::SchedComponent;
+
+  // Adaptive polling is on unless --vt_sched_poll_compat is passed, and never
+  // backs off from probing MPI
+  auto const sched = theSched();
+  EXPECT_TRUE(sched->isAdaptive());
+  EXPECT_EQ(sched->getBackoff(SchedComponent::Msg).getMaxInterval(), 0u);
+  EXPECT_EQ(
+    sched->getBackoff(SchedComponent::Collection).getMaxInterval(),
+    static_cast<uint32_t>(arguments::ArgConfig::vt_sched_max_backoff)
+  );
+}
+
+}}} // end namespace vt::tests::unit
@@ -0,0 +1,123 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                          test_scheduler_metrics.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+#include <gtest/gtest.h>
+
+#include "test_parallel_harness.h"
+
+#include "vt/transport.h"
+#include "vt/scheduler/scheduler_metrics.h"
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::tests::unit;
+
+struct TestSchedulerMetrics : TestParallelHarness { };
+
+TEST_F(TestSchedulerMetrics, test_scheduler_metrics_polls) {
+  using sched::SchedComponent;
+
+  sched::SchedulerMetrics metrics(4);
+  metrics.recordPoll(SchedComponent::Msg, true, 100);
+  metrics.recordPoll(SchedComponent::Msg, false, 10);
+  metrics.recordPoll(SchedComponent::Msg, false, 20);
+  metrics.recordPoll(SchedComponent::Event, false, 5);
+  metrics.recordLoop();
+
+  auto const snap = metrics.snapshot();
+  auto const& msg = snap.get(SchedComponent::Msg);
+  EXPECT_EQ(msg.polls_, 3u);
+  EXPECT_EQ(msg.productive_, 1u);
+  EXPECT_EQ(msg.emptyPolls(), 2u);
+  EXPECT_EQ(msg.cycles_, 130u);
+  EXPECT_EQ(msg.emptyCycles(), 30u);
+  EXPECT_EQ(snap.get(SchedComponent::Event).emptyPolls(), 1u);
+  EXPECT_EQ(snap.get(SchedComponent::Seq).polls_, 0u);
+  EXPECT_EQ(snap.loops_, 1u);
+
+  metrics.reset();
+  EXPECT_EQ(metrics.snapshot().get(SchedComponent::Msg).polls_, 0u);
+}
+
+TEST_F(TestSchedulerMetrics, test_scheduler_metrics_idle_timeline) {
+  sched::SchedulerMetrics metrics(2);
+
+  // Closing without an open interval records nothing
+  EXPECT_FALSE(metrics.endIdle(1.0));
+
+  for (int i = 0; i < 3; i++) {
+    metrics.beginIdle(10.0 * i);
+    // A second begin while idle keeps the original start
+    metrics.beginIdle(10.0 * i + 1.0);
+    EXPECT_TRUE(metrics.isIdle());
+    sched::IdleInterval interval;
+    EXPECT_TRUE(metrics.endIdle(10.0 * i + 2.0, &interval));
+    EXPECT_DOUBLE_EQ(interval.begin_, 10.0 * i);
+    EXPECT_DOUBLE_EQ(interval.end_, 10.0 * i + 2.0);
+    EXPECT_FALSE(metrics.isIdle());
+  }
+
+  auto const snap = metrics.snapshot();
+  EXPECT_EQ(snap.num_idle_, 3u);
+  EXPECT_DOUBLE_EQ(snap.idle_time_, 6.0);
+
+  // Only the two most recent intervals are kept, oldest first
+  ASSERT_EQ(snap.idle_timeline_.size(), 2u);
+  EXPECT_DOUBLE_EQ(snap.idle_timeline_[0].begin_, 10.0);
+  EXPECT_DOUBLE_EQ(snap.idle_timeline_[1].begin_, 20.0);
+
+  // An interval open across a reset is counted when it closes
+  metrics.beginIdle(30.0);
+  metrics.reset();
+  EXPECT_TRUE(metrics.endIdle(31.0));
+  EXPECT_EQ(metrics.snapshot().num_idle_, 1u);
+}
+
+TEST_F(TestSchedulerMetrics, test_scheduler_metrics_disabled) {
+  // Profiling is off unless --vt_sched_metrics is passed
+  EXPECT_EQ(theSched()->getMetrics(), nullptr);
+}
+
+}}} // end namespace vt::tests::unit
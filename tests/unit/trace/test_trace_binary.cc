@@ -0,0 +1,155 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             test_trace_binary.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#include <gtest/gtest.h>
+
+#include "test_harness.h"
+
+#include "vt/transport.h"
+#include "vt/trace/trace_binary.h"
+#include "vt/trace/trace_projections.h"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::trace;
+
+struct TestTraceBinary : TestHarness { };
+
+static TraceEntryIDType testEventSeq(TraceEntryIDType ep) {
+  return ep + 100;
+}
+
+TEST_F(TestTraceBinary, test_trace_binary_round_trip) {
+  auto const path = "test_trace_binary." +
+    std::to_string(theContext()->getNode()) + ".vtb";
+
+  TraceStringTable strings{""};
+  TraceIndexTable indices{TraceIndexTupleType{}};
+  TraceArena first, second;
+
+  TraceRecord begin{1000, eTraceConstants::BeginProcessing};
+  begin.data_ = 7;
+  begin.event_ = 3;
+  begin.index_ = indices.intern(TraceIndexTupleType{{5, 6, 0, 0}});
+  first.append(begin);
+
+  TraceRecord note{2000, eTraceConstants::UserSuppliedNote};
+  note.aux_ = strings.intern("a note");
+  second.append(note);
+  TraceRecord end{3000, eTraceConstants::EndProcessing};
+  end.data_ = 7;
+  end.event_ = 3;
+  end.index_ = begin.index_;
+  second.append(end);
+
+  std::string out;
+  auto write = [&out](char const* ptr, std::size_t len) {
+    out.append(ptr, len);
+  };
+
+  // Two flushes: the second must not repeat the tables of the first
+  TraceBinaryWriter writer{testEventSeq};
+  writer.writeHeader(write, 2, 4, 500);
+  writer.writeTables(write, first, strings, indices);
+  writer.writeRecords(write, first);
+  writer.writeTables(write, second, strings, indices);
+  writer.writeRecords(write, second);
+  writer.writeEnd(write, 4000);
+
+  {
+    std::ofstream file(path, std::ios::binary);
+    file.write(out.data(), static_cast<std::streamsize>(out.size()));
+  }
+
+  TraceBinaryReader reader{path};
+  ASSERT_TRUE(reader.good());
+  EXPECT_EQ(reader.getNode(), 2);
+  EXPECT_EQ(reader.getNumNodes(), 4);
+  EXPECT_EQ(reader.getStart(), 500);
+
+  std::vector<TraceRecord> recs;
+  EXPECT_TRUE(reader.read([&](TraceRecord const& rec) { recs.push_back(rec); }));
+  ASSERT_EQ(recs.size(), 3u);
+  EXPECT_EQ(recs[0].type(), eTraceConstants::BeginProcessing);
+  EXPECT_EQ(recs[2].time_, 3000);
+  EXPECT_EQ(reader.getStrings().at(recs[1].aux_), "a note");
+  EXPECT_EQ(reader.getIndices().at(recs[2].index_)[1], 6u);
+  EXPECT_EQ(reader.eventSeq(7), 107u);
+  EXPECT_TRUE(reader.hasEnd());
+  EXPECT_EQ(reader.getEnd(), 4000);
+
+  std::remove(path.c_str());
+}
+
+TEST_F(TestTraceBinary, test_trace_binary_projections_format) {
+  std::vector<std::string> strings = {"", "hello"};
+  std::vector<TraceIndexTupleType> indices = {TraceIndexTupleType{}};
+
+  ProjectionsContext ctx;
+  ctx.start_ = 1000000;
+  ctx.num_nodes_ = 2;
+  ctx.event_seq_ = testEventSeq;
+  ctx.strings_ = &strings;
+  ctx.indices_ = &indices;
+
+  TraceRecord note{3000000, eTraceConstants::UserSuppliedNote};
+  note.aux_ = 1;
+  TraceRecord idle{5000000, eTraceConstants::BeginIdle};
+  idle.node_ = 1;
+
+  std::string out;
+  formatProjectionsRecord(out, note, ctx);
+  formatProjectionsRecord(out, idle, ctx);
+  formatProjectionsFooter(out, 6000000);
+  EXPECT_EQ(out, "28 2000 5 hello\n14 4000 1\n7 6000\n");
+}
+
+}}} // end namespace vt::tests::unit
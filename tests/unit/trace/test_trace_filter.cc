@@ -0,0 +1,140 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             test_trace_filter.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#include <gtest/gtest.h>
+
+#include "test_harness.h"
+
+#include "vt/transport.h"
+#include "vt/trace/trace_filter.h"
+
+#include <string>
+#include <vector>
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::trace;
+
+struct TestTraceFilter : TestHarness {
+  virtual void TearDown() {
+    using ArgType = vt::arguments::ArgConfig;
+    ArgType::vt_trace_filter = "";
+    ArgType::vt_trace_phase_first = -1;
+    ArgType::vt_trace_phase_last = -1;
+    ArgType::vt_trace_ranks = "";
+    ArgType::vt_trace_sample = 1;
+    TestHarness::TearDown();
+  }
+};
+
+TEST_F(TestTraceFilter, test_trace_filter_rank_list) {
+  EXPECT_TRUE(TraceFilter::rankInList("0", 0));
+  EXPECT_FALSE(TraceFilter::rankInList("0", 1));
+  EXPECT_TRUE(TraceFilter::rankInList("0-3,8", 2));
+  EXPECT_TRUE(TraceFilter::rankInList("0-3,8", 3));
+  EXPECT_FALSE(TraceFilter::rankInList("0-3,8", 4));
+  EXPECT_TRUE(TraceFilter::rankInList("0-3,8", 8));
+  EXPECT_TRUE(TraceFilter::rankInList("5,,1-2", 1));
+}
+
+TEST_F(TestTraceFilter, test_trace_filter_name_match) {
+  auto const patterns = TraceFilter::parsePatterns("Greedy,::lbHan");
+  ASSERT_EQ(patterns.size(), 2ul);
+  EXPECT_TRUE(
+    TraceFilter::nameMatches("vt::GreedyLB::reduceCollect", patterns)
+  );
+  EXPECT_TRUE(TraceFilter::nameMatches("MyCol::lbHandler", patterns));
+  EXPECT_FALSE(TraceFilter::nameMatches("MyCol::work", patterns));
+  EXPECT_TRUE(TraceFilter::parsePatterns("").empty());
+}
+
+TEST_F(TestTraceFilter, test_trace_filter_sample) {
+  vt::arguments::ArgConfig::vt_trace_sample = 3;
+
+  TraceFilter filter;
+  filter.setup(theContext()->getNode());
+  EXPECT_EQ(filter.getSampleWeight(), 3);
+
+  // Each entry point is sampled on its own count, starting with the first
+  std::vector<bool> first, second;
+  for (int i = 0; i < 6; i++) {
+    first.push_back(filter.executionTraced(1));
+    second.push_back(filter.executionTraced(2));
+  }
+  std::vector<bool> const expected = {true, false, false, true, false, false};
+  EXPECT_EQ(first, expected);
+  EXPECT_EQ(second, expected);
+}
+
+TEST_F(TestTraceFilter, test_trace_filter_phase_range) {
+  vt::arguments::ArgConfig::vt_trace_phase_first = 2;
+  vt::arguments::ArgConfig::vt_trace_phase_last = 3;
+
+  TraceFilter filter;
+  filter.setup(theContext()->getNode());
+
+  std::vector<bool> traced;
+  for (PhaseType phase = 0; phase < 5; phase++) {
+    filter.setPhase(phase);
+    traced.push_back(filter.phaseTraced());
+  }
+  std::vector<bool> const expected = {false, false, true, true, false};
+  EXPECT_EQ(traced, expected);
+}
+
+TEST_F(TestTraceFilter, test_trace_filter_ranks) {
+  auto const this_node = theContext()->getNode();
+  vt::arguments::ArgConfig::vt_trace_ranks = std::to_string(this_node);
+
+  TraceFilter filter;
+  filter.setup(this_node);
+  EXPECT_TRUE(filter.rankTraced());
+
+  filter.setup(this_node + 1);
+  EXPECT_FALSE(filter.rankTraced());
+}
+
+}}} // end namespace vt::tests::unit
@@ -0,0 +1,117 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             test_trace_record.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#include <gtest/gtest.h>
+
+#include "test_harness.h"
+
+#include "vt/transport.h"
+#include "vt/trace/trace_record.h"
+#include "vt/trace/trace_arena.h"
+#include "vt/trace/trace_intern.h"
+
+#include <string>
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::trace;
+
+struct TestTraceRecord : TestHarness { };
+
+TEST_F(TestTraceRecord, test_trace_record_fields) {
+  TraceRecord rec{1234, eTraceConstants::UserSupplied};
+  rec.data_ = static_cast<uint64_t>(static_cast<uint32_t>(-5));
+  EXPECT_EQ(rec.type(), eTraceConstants::UserSupplied);
+  EXPECT_EQ(rec.userData(), -5);
+  EXPECT_FALSE(rec.userStart());
+
+  rec.setMsgLen(static_cast<TraceMsgLenType>(1) << 40);
+  EXPECT_EQ(rec.aux_, std::numeric_limits<uint32_t>::max());
+  rec.setMsgLen(64);
+  EXPECT_EQ(rec.aux_, 64u);
+}
+
+TEST_F(TestTraceRecord, test_trace_arena_append) {
+  TraceArena arena;
+  auto const num = trace_arena_block_count * 2 + 7;
+  for (std::size_t i = 0; i < num; i++) {
+    TraceRecord rec{static_cast<TraceTimeType>(i), eTraceConstants::BeginIdle};
+    arena.append(rec);
+  }
+  EXPECT_EQ(arena.size(), num);
+
+  TraceTimeType expected = 0;
+  arena.forEach([&](TraceRecord const& rec) {
+    EXPECT_EQ(rec.time_, expected++);
+  });
+  EXPECT_EQ(static_cast<std::size_t>(expected), num);
+
+  arena.clear();
+  EXPECT_TRUE(arena.empty());
+  auto& rec = arena.append(TraceRecord{42, eTraceConstants::EndIdle});
+  EXPECT_EQ(rec.time_, 42);
+  EXPECT_EQ(arena.size(), 1u);
+}
+
+TEST_F(TestTraceRecord, test_trace_intern_tables) {
+  TraceStringTable strings{""};
+  EXPECT_EQ(strings.intern(""), no_trace_string);
+  auto const a = strings.intern("a note");
+  auto const b = strings.intern("another note");
+  EXPECT_NE(a, b);
+  EXPECT_EQ(strings.intern("a note"), a);
+  EXPECT_EQ(strings.get(b), "another note");
+  EXPECT_EQ(strings.size(), 3u);
+
+  TraceIndexTable indices{TraceIndexTupleType{}};
+  auto const i = indices.intern(TraceIndexTupleType{{1, 2, 3, 4}});
+  EXPECT_NE(i, no_trace_index);
+  EXPECT_EQ(indices.intern(TraceIndexTupleType{{1, 2, 3, 4}}), i);
+  EXPECT_EQ(indices.get(i)[2], 3u);
+  EXPECT_EQ(indices.get(no_trace_index)[0], 0u);
+}
+
+}}} // end namespace vt::tests::unit
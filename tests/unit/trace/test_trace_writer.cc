@@ -0,0 +1,109 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             test_trace_writer.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+#include <gtest/gtest.h>
+
+#include "test_harness.h"
+
+#include "vt/transport.h"
+#include "vt/trace/trace_writer.h"
+
+#include <string>
+#include <cstdio>
+
+#include <zlib.h>
+
+namespace vt { namespace tests { namespace unit {
+
+using namespace vt;
+using namespace vt::trace;
+
+struct TestTraceWriter : TestHarness { };
+
+static std::string readAll(std::string const& path) {
+  gzFile file = gzopen(path.c_str(), "rb");
+  std::string out;
+  char buf[4096];
+  int len = 0;
+  while ((len = gzread(file, buf, sizeof(buf))) > 0) {
+    out.append(buf, len);
+  }
+  gzclose(file);
+  return out;
+}
+
+TEST_F(TestTraceWriter, test_trace_writer_policy_names) {
+  EXPECT_EQ(getOverflowPolicy("block"),  TraceOverflowPolicy::Block);
+  EXPECT_EQ(getOverflowPolicy("drop"),   TraceOverflowPolicy::Drop);
+  EXPECT_EQ(getOverflowPolicy("sample"), TraceOverflowPolicy::Sample);
+}
+
+TEST_F(TestTraceWriter, test_trace_writer_in_order) {
+  auto const path = "test_trace_writer." +
+    std::to_string(theContext()->getNode()) + ".log.gz";
+
+  std::string expected;
+  gzFile file = gzopen(path.c_str(), "wb");
+  {
+    // A budget smaller than one chunk: every enqueue has to wait for the
+    // queue to drain, but none may be refused
+    auto write = [file](char const* ptr, std::size_t len) {
+      gzwrite(file, ptr, static_cast<unsigned>(len));
+    };
+    TraceWriter writer(write, 16);
+    for (int i = 0; i < 100; i++) {
+      auto chunk = fmt::format("chunk {} with more than sixteen bytes\n", i);
+      expected += chunk;
+      EXPECT_TRUE(writer.enqueue(std::move(chunk), true));
+    }
+    writer.stop();
+  }
+  gzclose(file);
+
+  EXPECT_EQ(readAll(path), expected);
+  std::remove(path.c_str());
+}
+
+}}} // end namespace vt::tests::unit
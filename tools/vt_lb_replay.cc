@@ -0,0 +1,414 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                               vt_lb_replay.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+/*
+ * Offline replay of recorded LB statistics.
+ *
+ * Reads the binary statistics written with `--vt_lb_stats --vt_lb_stats_binary`
+ * (one file per rank) and runs any of the load balancers on a recorded phase
+ * without the application. Must be launched on the same number of ranks as the
+ * recording: each rank loads its own file, hands the phase to the LB as if it
+ * had just been measured, and records the migrations instead of executing
+ * them. Reports the imbalance, migration count and edge-cut before and after.
+ *
+ *   vt_lb_replay <lb_name> [first_phase] [last_phase] \
+ *     --vt_lb_stats_dir=<dir> --vt_lb_stats_file=<file>
+ */
+
+#include "vt/transport.h"
+#include "vt/vrt/collection/balance/lb_type.h"
+#include "vt/vrt/collection/balance/lb_invoke/invoke.h"
+#include "vt/vrt/collection/balance/proc_stats.h"
+#include "vt/vrt/collection/balance/stats_binary.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <unistd.h>
+
+using namespace vt;
+
+using ArgType       = vt::arguments::ArgConfig;
+using ElementIDType = vrt::collection::balance::ElementIDType;
+using LBType        = vrt::collection::balance::LBType;
+using PhaseData     = vrt::collection::balance::StatsPhaseData;
+using ProcStats     = vrt::collection::balance::ProcStats;
+using LBManager     = vrt::collection::balance::LBManager;
+
+// Mirrors the collection manager's LB message for LBManager::sysLB
+struct ReplayLBMsg {
+  PhaseType phase_             = 0;
+  LBType lb_                   = LBType::NoLB;
+  bool manual_                 = false;
+  std::size_t num_collections_ = 1;
+};
+
+struct ReplayMovesMsg : vt::Message {
+  using MoveType = std::tuple<ElementIDType, NodeType, double>;
+  using MovesType = std::vector<MoveType>;
+
+  ReplayMovesMsg() = default;
+  explicit ReplayMovesMsg(MovesType const& in_moves)
+    : moves_(in_moves)
+  { }
+
+  MovesType const& getMoves() const { return moves_; }
+
+  template <typename SerializerT>
+  void serialize(SerializerT& s) {
+    s | moves_;
+  }
+
+private:
+  MovesType moves_ = {};
+};
+
+// Layout: cut before, cut after, total bytes, migrations, then the load of
+// every rank before, then the load of every rank after
+struct ReplayResultMsg : collective::ReduceTMsg<std::vector<double>> {
+  ReplayResultMsg() = default;
+  explicit ReplayResultMsg(std::vector<double> const& in_vals)
+    : collective::ReduceTMsg<std::vector<double>>(in_vals)
+  { }
+};
+
+static constexpr std::size_t const num_result_fields = 4;
+
+struct LBReplay {
+  using ProxyType = objgroup::proxy::Proxy<LBReplay>;
+
+  void init(ProxyType in_proxy) { proxy_ = in_proxy; }
+
+  void setupPhase(PhaseData const& data);
+  void runLB(PhaseType phase, LBType lb);
+  void report();
+  void movesHandler(ReplayMovesMsg* msg);
+  void resultHandler(ReplayResultMsg* msg);
+
+private:
+  NodeType curNode(ElementIDType const obj) const;
+
+private:
+  ProxyType proxy_ = {};
+  PhaseData data_ = {};
+  std::unordered_map<ElementIDType, NodeType> local_moves_ = {};
+  std::unordered_map<ElementIDType, NodeType> all_moves_ = {};
+  double load_in_ = 0.0;
+};
+
+void LBReplay::setupPhase(PhaseData const& data) {
+  data_ = data;
+  local_moves_.clear();
+  all_moves_.clear();
+  load_in_ = 0.0;
+
+  // Install the recorded phase as if it had just been instrumented; the LB
+  // reads temp IDs, whose low bits carry the rank that held the object
+  auto const phase = data_.phase_;
+  ProcStats::clearStats();
+  ProcStats::proc_data_.resize(phase + 1);
+  ProcStats::proc_comm_.resize(phase + 1);
+  if (data_.hasCPU()) {
+    ProcStats::proc_cpu_data_.resize(phase + 1);
+  }
+  for (std::size_t i = 0; i < data_.numObjs(); i++) {
+    auto const perm = data_.obj_perm_[i];
+    auto const temp = data_.obj_temp_[i];
+    ProcStats::proc_data_[phase][temp] = data_.obj_load_[i];
+    if (data_.hasCPU()) {
+      ProcStats::proc_cpu_data_[phase][temp] = data_.obj_cpu_[i];
+    }
+    ProcStats::proc_temp_to_perm_[temp] = perm;
+    ProcStats::proc_perm_to_temp_[perm] = temp;
+    ProcStats::proc_migrate_[temp] = [this,temp](NodeType to){
+      local_moves_[temp] = to;
+    };
+  }
+  ProcStats::proc_comm_[phase] = data_.makeCommMap();
+}
+
+void LBReplay::runLB(PhaseType phase, LBType lb) {
+  ReplayLBMsg msg;
+  msg.phase_ = phase;
+  msg.lb_ = lb;
+
+  auto lbmgr = LBManager::getProxy().get();
+  lbmgr->sysLB(&msg);
+  lbmgr->waitLBCollective();
+}
+
+NodeType LBReplay::curNode(ElementIDType const obj) const {
+  auto iter = all_moves_.find(obj);
+  if (iter != all_moves_.end()) {
+    return iter->second;
+  }
+  return vrt::collection::balance::objGetNode(obj);
+}
+
+void LBReplay::report() {
+  using ReduceOp = collective::PlusOp<std::vector<double>>;
+  using vrt::collection::balance::CommCategory;
+  using vrt::collection::balance::objGetNode;
+
+  auto const this_node = theContext()->getNode();
+  auto const num_nodes = theContext()->getNumNodes();
+
+  // Share every migration so each rank can locate both ends of its edges
+  std::unordered_map<ElementIDType, double> loads;
+  for (std::size_t i = 0; i < data_.numObjs(); i++) {
+    loads[data_.obj_temp_[i]] = data_.obj_load_[i];
+  }
+
+  ReplayMovesMsg::MovesType moves;
+  for (auto&& elm : local_moves_) {
+    if (elm.second != objGetNode(elm.first)) {
+      moves.emplace_back(elm.first, elm.second, loads[elm.first]);
+    }
+  }
+
+  bool done = false;
+  auto const epoch = theTerm()->makeEpochCollective();
+  theTerm()->addAction(epoch, [&done]{ done = true; });
+  theMsg()->pushEpoch(epoch);
+  auto msg = makeMessage<ReplayMovesMsg>(moves);
+  proxy_.template broadcast<ReplayMovesMsg,&LBReplay::movesHandler>(msg);
+  theMsg()->popEpoch(epoch);
+  theTerm()->finishedEpoch(epoch);
+
+  while (not done) {
+    vt::runScheduler();
+  }
+
+  double load_before = 0.0;
+  double load_out = 0.0;
+  for (auto&& elm : loads) {
+    load_before += elm.second;
+  }
+  for (auto&& elm : moves) {
+    load_out += std::get<2>(elm);
+  }
+
+  double cut_before = 0.0, cut_after = 0.0, total = 0.0;
+  for (std::size_t i = 0; i < data_.numEdges(); i++) {
+    auto const cat = static_cast<CommCategory>(data_.edge_cat_[i]);
+    if (cat != CommCategory::SendRecv or
+        data_.edge_from_[i] == data_.edge_to_[i]) {
+      continue;
+    }
+    auto const from = data_.edge_from_temp_[i];
+    auto const to = data_.edge_to_temp_[i];
+    auto const bytes = static_cast<double>(data_.edge_bytes_[i]);
+    total += bytes;
+    if (objGetNode(from) != objGetNode(to)) {
+      cut_before += bytes;
+    }
+    if (curNode(from) != curNode(to)) {
+      cut_after += bytes;
+    }
+  }
+
+  std::vector<double> vals(num_result_fields + 2 * num_nodes, 0.0);
+  vals[0] = cut_before;
+  vals[1] = cut_after;
+  vals[2] = total;
+  vals[3] = static_cast<double>(moves.size());
+  vals[num_result_fields + this_node] = load_before;
+  vals[num_result_fields + num_nodes + this_node] =
+    load_before - load_out + load_in_;
+
+  done = false;
+  auto const red_epoch = theTerm()->makeEpochCollective();
+  theTerm()->addAction(red_epoch, [&done]{ done = true; });
+  auto cb = theCB()->makeSend<LBReplay,ReplayResultMsg,&LBReplay::resultHandler>(
+    proxy_[0]
+  );
+  theMsg()->pushEpoch(red_epoch);
+  auto rmsg = makeMessage<ReplayResultMsg>(vals);
+  proxy_.template reduce<ReduceOp>(rmsg, cb);
+  theMsg()->popEpoch(red_epoch);
+  theTerm()->finishedEpoch(red_epoch);
+
+  while (not done) {
+    vt::runScheduler();
+  }
+}
+
+void LBReplay::movesHandler(ReplayMovesMsg* msg) {
+  auto const this_node = theContext()->getNode();
+  for (auto&& elm : msg->getMoves()) {
+    all_moves_[std::get<0>(elm)] = std::get<1>(elm);
+    if (std::get<1>(elm) == this_node) {
+      load_in_ += std::get<2>(elm);
+    }
+  }
+}
+
+void LBReplay::resultHandler(ReplayResultMsg* msg) {
+  auto const& vals = msg->getConstVal();
+  auto const num_nodes = theContext()->getNumNodes();
+
+  auto imbalance = [&](std::size_t offset) {
+    double max = 0.0, sum = 0.0;
+    for (NodeType i = 0; i < num_nodes; i++) {
+      max = std::max(max, vals[offset + i]);
+      sum += vals[offset + i];
+    }
+    auto const avg = sum / num_nodes;
+    return std::make_tuple(max, avg, avg > 0.0 ? max / avg - 1.0 : 0.0);
+  };
+
+  auto const before = imbalance(num_result_fields);
+  auto const after = imbalance(num_result_fields + num_nodes);
+  auto const total = vals[2];
+
+  fmt::print(
+    "vt_lb_replay: phase={}, migrations={:.0f}\n"
+    "  load:     before max={:.6f}, avg={:.6f}, imb={:.4f}; "
+    "after max={:.6f}, avg={:.6f}, imb={:.4f}\n"
+    "  edge cut: before={:.0f} ({:.4f}), after={:.0f} ({:.4f}), "
+    "total={:.0f} bytes\n",
+    data_.phase_, vals[3],
+    std::get<0>(before), std::get<1>(before), std::get<2>(before),
+    std::get<0>(after), std::get<1>(after), std::get<2>(after),
+    vals[0], total > 0.0 ? vals[0] / total : 0.0,
+    vals[1], total > 0.0 ? vals[1] / total : 0.0,
+    total
+  );
+}
+
+static bool findLB(std::string const& name, LBType& lb) {
+  for (auto&& elm : vrt::collection::balance::lb_names_) {
+    if (elm.second == name and elm.first != LBType::NoLB) {
+      lb = elm.first;
+      return true;
+    }
+  }
+  return false;
+}
+
+static std::string statsFileName(bool compressed) {
+  auto const this_node = theContext()->getNode();
+  auto const base_file = std::string(ArgType::vt_lb_stats_file);
+  auto const dir = std::string(ArgType::vt_lb_stats_dir);
+  auto const ext = compressed ? "bin.gz" : "bin";
+  return fmt::format("{}/{}.{}.{}", dir, base_file, this_node, ext);
+}
+
+int main(int argc, char** argv) {
+  vt::initialize(argc, argv, nullptr);
+
+  auto const this_node = theContext()->getNode();
+
+  LBType lb = LBType::NoLB;
+  if (argc < 2 or not findLB(argv[1], lb)) {
+    if (this_node == 0) {
+      fmt::print(
+        "usage: {} <lb_name> [first_phase] [last_phase] "
+        "--vt_lb_stats_dir=<dir> --vt_lb_stats_file=<file>\n", argv[0]
+      );
+    }
+    vt::finalize();
+    return 0;
+  }
+
+  PhaseType const first = argc > 2 ? std::strtoull(argv[2], nullptr, 10) : 0;
+  PhaseType const last = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : first;
+
+  // Replaying must not append to the statistics being read
+  ArgType::vt_lb_stats = false;
+
+  auto file_name = statsFileName(true);
+  if (access(file_name.c_str(), R_OK) != 0) {
+    file_name = statsFileName(false);
+  }
+
+  using ReaderType = vrt::collection::balance::StatsBinaryReader;
+  auto reader = std::make_unique<ReaderType>(file_name);
+  vtAbortIf(
+    not reader->good() or reader->getNode() != this_node,
+    fmt::format("vt_lb_replay: can not read stats file \"{}\"", file_name)
+  );
+
+  auto proxy = theObjGroup()->makeCollective<LBReplay>();
+  proxy.get()->init(proxy);
+
+  // Phases are stored in order, so read forward and keep the one past the
+  // requested phase for the next iteration
+  PhaseData next;
+  bool have_next = reader->readPhase(next);
+
+  for (PhaseType phase = first; phase <= last; phase++) {
+    while (have_next and next.phase_ < phase) {
+      have_next = reader->readPhase(next);
+    }
+
+    // A rank without objects in this phase still takes part in the LB
+    PhaseData data;
+    data.phase_ = phase;
+    if (have_next and next.phase_ == phase) {
+      data = std::move(next);
+      have_next = reader->readPhase(next);
+    }
+
+    proxy.get()->setupPhase(data);
+    proxy.get()->runLB(phase, lb);
+    proxy.get()->report();
+  }
+
+  reader = nullptr;
+
+  while (!vt::rt->isTerminated()) {
+    vt::runScheduler();
+  }
+
+  vt::finalize();
+
+  return 0;
+}
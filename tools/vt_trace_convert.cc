@@ -0,0 +1,146 @@
+/*
+//@HEADER
+// *****************************************************************************
+//
+//                             vt_trace_convert.cc
+//                           DARMA Toolkit v. 1.0.0
+//                       DARMA/vt => Virtual Transport
+//
+// Copyright 2019 National Technology & Engineering Solutions of Sandia, LLC
+// (NTESS). Under the terms of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are met:
+//
+// * Redistributions of source code must retain the above copyright notice,
+//   this list of conditions and the following disclaimer.
+//
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the following disclaimer in the documentation
+//   and/or other materials provided with the distribution.
+//
+// * Neither the name of the copyright holder nor the names of its
+//   contributors may be used to endorse or promote products derived from this
+//   software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+// LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+// CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+// SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+// INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+// CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+// ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+// POSSIBILITY OF SUCH DAMAGE.
+//
+// Questions? Contact darma@sandia.gov
+//
+// *****************************************************************************
+//@HEADER
+*/
+
+
+/*
+ * Offline conversion of binary traces to Projections logs.
+ *
+ * Reads the per-rank traces written with `--vt_trace --vt_trace_binary` and
+ * writes each one as the gzipped Projections log that tracing writes without
+ * `--vt_trace_binary`. The control (.sts) file is written by rank 0 either way.
+ *
+ *   vt_trace_convert <name>.<node>.vtb [<name>.<node>.vtb ...]
+ *
+ * produces <name>.<node>.log.gz next to each input. Runs serially, without
+ * initializing the runtime.
+ */
+
+#include "vt/config.h"
+#include "vt/trace/trace_binary.h"
+#include "vt/trace/trace_projections.h"
+
+#include <algorithm>
+#include <string>
+
+#include "fmt/format.h"
+
+#include <zlib.h>
+
+using namespace vt::trace;
+
+static std::string outputName(std::string const& in) {
+  std::string const ext = ".vtb";
+  auto const len = in.size();
+  if (len >= ext.size() and in.compare(len - ext.size(), ext.size(), ext) == 0) {
+    return in.substr(0, len - ext.size()) + ".log.gz";
+  }
+  return in + ".log.gz";
+}
+
+static bool convert(std::string const& in_name) {
+  TraceBinaryReader reader{in_name};
+  if (not reader.good()) {
+    fmt::print(stderr, "vt_trace_convert: \"{}\" is not a binary trace\n", in_name);
+    return false;
+  }
+
+  auto const out_name = outputName(in_name);
+  gzFile file = gzopen(out_name.c_str(), "wb");
+  if (file == nullptr) {
+    fmt::print(stderr, "vt_trace_convert: can not open \"{}\"\n", out_name);
+    return false;
+  }
+
+  ProjectionsContext ctx;
+  ctx.start_ = reader.getStart();
+  ctx.num_nodes_ = reader.getNumNodes();
+  ctx.event_seq_ = [&reader](TraceEntryIDType ep) {
+    return reader.eventSeq(ep);
+  };
+  ctx.strings_ = &reader.getStrings();
+  ctx.indices_ = &reader.getIndices();
+
+  std::string out;
+  formatProjectionsHeader(out);
+
+  TraceTimeType last = reader.getStart();
+  auto const complete = reader.read([&](TraceRecord const& rec) {
+    formatProjectionsRecord(out, rec, ctx);
+    last = std::max(last, rec.time_);
+    if (out.size() >= trace_write_buffer_size) {
+      gzwrite(file, out.data(), static_cast<unsigned>(out.size()));
+      out.clear();
+    }
+  });
+
+  // A trace cut short ends at its last record
+  auto const end = reader.hasEnd() ? reader.getEnd() : last;
+  formatProjectionsFooter(out, end - reader.getStart());
+  gzwrite(file, out.data(), static_cast<unsigned>(out.size()));
+  gzclose(file);
+
+  if (not complete or not reader.hasEnd()) {
+    fmt::print(
+      stderr, "vt_trace_convert: \"{}\" is incomplete; converted what was "
+      "readable\n", in_name
+    );
+  }
+  fmt::print("{} -> {}\n", in_name, out_name);
+  return complete;
+}
+
+int main(int argc, char** argv) {
+  if (argc < 2) {
+    fmt::print(stderr, "usage: {} <trace.vtb> [<trace.vtb> ...]\n", argv[0]);
+    return 1;
+  }
+
+  int ret = 0;
+  for (int i = 1; i < argc; i++) {
+    if (not convert(argv[i])) {
+      ret = 1;
+    }
+  }
+  return ret;
+}